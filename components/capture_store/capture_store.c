@@ -0,0 +1,717 @@
+/**
+ * @file capture_store.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements capture store and rendering of its views
+ */
+#include "capture_store.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+#include "run_arena.h"
+
+static const char *TAG = "capture_store";
+
+/**
+ * @brief Records buffer is extended in run arena by multiples of this size, so the arena isn't locked on every frame
+ */
+#define RECORDS_GROW_STEP 1024
+
+/**
+ * @brief Heap chunks for frames that don't fit into run arena are allocated by at least this size
+ */
+#define OVERFLOW_CHUNK_SIZE 4096
+
+/**
+ * @brief Heap below this size is left to Wi-Fi stack and webserver, overflow chunks are never allocated from it
+ */
+#define OVERFLOW_MIN_FREE_HEAP 32768
+
+/**
+ * @brief Header of every stored frame.
+ *
+ * Frame data follow the header and are padded to 4 bytes, so every header and frame stays aligned.
+ */
+typedef struct {
+    uint32_t ts_usec;
+    uint16_t size;
+    uint16_t reserved;
+} record_header_t;
+
+/**
+ * @brief Heap chunk with frame records appended after run arena got full. Record never crosses end of chunk.
+ */
+typedef struct records_chunk {
+    struct records_chunk *next;
+    size_t size;
+    size_t capacity;
+    uint8_t data[];
+} records_chunk_t;
+
+static SemaphoreHandle_t store_mutex = NULL;
+static capture_store_meta_t meta = { 0 };
+/**
+ * @brief Records in run arena, followed by records in overflow chunks
+ */
+//@{
+static uint8_t *records = NULL;
+static size_t records_size = 0;
+static size_t records_capacity = 0;
+static records_chunk_t *overflow_head = NULL;
+static records_chunk_t *overflow_tail = NULL;
+static size_t overflow_size = 0;
+static size_t overflow_capacity = 0;
+//@}
+static unsigned frame_count = 0;
+/**
+ * @brief HCCAPX buffer and serializer context used by rendering, reserved in run arena before any records
+ */
+//@{
+static hccapx_t *scratch_hccapx = NULL;
+static void *scratch_hccapx_ctx = NULL;
+//@}
+static capture_store_frame_cb_t frame_listener = NULL;
+static void *frame_listener_arg = NULL;
+
+static size_t record_total_size(unsigned frame_size){
+    return sizeof(record_header_t) + ((frame_size + 3) & ~3u);
+}
+
+/**
+ * @brief Drops records and render scratch memory. Expects store_mutex to be taken.
+ *
+ * Arena memory is released by run_arena_reset(). Overflow chunks are returned, so they can be freed by free_chunks() after the lock is released.
+ * @return records_chunk_t* detached overflow chunks
+ */
+static records_chunk_t *drop_records(){
+    records_chunk_t *chunks = overflow_head;
+    records = NULL;
+    records_size = 0;
+    records_capacity = 0;
+    overflow_head = NULL;
+    overflow_tail = NULL;
+    overflow_size = 0;
+    overflow_capacity = 0;
+    frame_count = 0;
+    scratch_hccapx = NULL;
+    scratch_hccapx_ctx = NULL;
+    return chunks;
+}
+
+static void free_chunks(records_chunk_t *chunk){
+    while(chunk != NULL){
+        records_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+}
+
+/**
+ * @brief Reserves render scratch memory in run arena, so rendering doesn't touch heap. Expects store_mutex to be taken and no records stored.
+ *
+ * If arena is full, rendering falls back to heap.
+ */
+static void reserve_render_scratch(){
+    size_t hccapx_size = (sizeof(hccapx_t) + 3) & ~3u;
+    uint8_t *scratch = run_arena_alloc(hccapx_size + hccapx_serializer_get_size());
+    if(scratch != NULL){
+        scratch_hccapx = (hccapx_t *) scratch;
+        scratch_hccapx_ctx = &scratch[hccapx_size];
+    }
+}
+
+static size_t overflow_chunk_capacity(size_t record_size){
+    return (record_size > OVERFLOW_CHUNK_SIZE) ? record_size : OVERFLOW_CHUNK_SIZE;
+}
+
+/**
+ * @brief Says whether new overflow chunk for record of given size may be allocated. Expects store_mutex to be taken.
+ */
+static bool overflow_allowed(size_t record_size){
+    size_t capacity = overflow_chunk_capacity(record_size);
+    return (overflow_capacity + capacity <= CONFIG_CAPTURE_STORE_OVERFLOW_SIZE)
+        && (esp_get_free_heap_size() >= OVERFLOW_MIN_FREE_HEAP + capacity);
+}
+
+/**
+ * @brief Allocates empty overflow chunk. Heap is never allocated under store_mutex, so frames don't wait for allocator.
+ */
+static records_chunk_t *alloc_chunk(size_t record_size){
+    size_t capacity = overflow_chunk_capacity(record_size);
+    records_chunk_t *chunk = (records_chunk_t *) malloc(sizeof(records_chunk_t) + capacity);
+    if(chunk == NULL){
+        ESP_LOGW(TAG, "Failed to allocate %u bytes for frames", capacity);
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->size = 0;
+    chunk->capacity = capacity;
+    return chunk;
+}
+
+/**
+ * @brief Takes space for new record at the end of records. Expects store_mutex to be taken.
+ *
+ * Records are stored in run arena until it's full, then in overflow chunks, so they stay in order of arrival.
+ * @param record_size size of record including header and padding
+ * @param spare empty chunk allocated by alloc_chunk() or \c NULL. It's appended to records and set to \c NULL if it was needed.
+ * @return uint8_t* space for the record, \c NULL if new overflow chunk is needed
+ */
+static uint8_t *take_record_space(size_t record_size, records_chunk_t **spare){
+    uint8_t *space = NULL;
+    if(overflow_head == NULL){
+        size_t required = records_size + record_size;
+        if(required > records_capacity){
+            size_t new_capacity = (required + RECORDS_GROW_STEP - 1) / RECORDS_GROW_STEP * RECORDS_GROW_STEP;
+            uint8_t *extended_records = run_arena_extend(records, new_capacity);
+            if(extended_records == NULL){
+                // end of arena may still fit exact size
+                new_capacity = required;
+                extended_records = run_arena_extend(records, new_capacity);
+            }
+            if(extended_records != NULL){
+                records = extended_records;
+                records_capacity = new_capacity;
+            }
+        }
+        if(required <= records_capacity){
+            space = &records[records_size];
+            records_size = required;
+            return space;
+        }
+    }
+    if((overflow_tail == NULL) || (overflow_tail->size + record_size > overflow_tail->capacity)){
+        if((spare == NULL) || (*spare == NULL) || ((*spare)->capacity < record_size)
+            || (overflow_capacity + (*spare)->capacity > CONFIG_CAPTURE_STORE_OVERFLOW_SIZE)){
+            return NULL;
+        }
+        if(overflow_head == NULL){
+            ESP_LOGW(TAG, "Run arena full, storing frames on heap");
+            overflow_head = *spare;
+        }
+        else {
+            overflow_tail->next = *spare;
+        }
+        overflow_tail = *spare;
+        overflow_capacity += overflow_tail->capacity;
+        *spare = NULL;
+    }
+    space = &overflow_tail->data[overflow_tail->size];
+    overflow_tail->size += record_size;
+    overflow_size += record_size;
+    return space;
+}
+
+/**
+ * @brief Takes space for new record, allocating overflow chunk if needed. Expects store_mutex to be taken, it's released during allocation.
+ *
+ * @param unused output parameter for allocated chunk that turned out not to be needed, caller frees it after releasing the lock
+ * @return uint8_t* space for the record, \c NULL if overflow limit is reached or heap is exhausted
+ */
+static uint8_t *alloc_record(size_t record_size, records_chunk_t **unused){
+    *unused = NULL;
+    uint8_t *space = take_record_space(record_size, NULL);
+    if((space == NULL) && overflow_allowed(record_size)){
+        xSemaphoreGive(store_mutex);
+        records_chunk_t *chunk = alloc_chunk(record_size);
+        xSemaphoreTake(store_mutex, portMAX_DELAY);
+        // store may have changed meanwhile, so the chunk doesn't have to be needed anymore
+        space = take_record_space(record_size, &chunk);
+        *unused = chunk;
+    }
+    return space;
+}
+
+void capture_store_init(){
+    store_mutex = xSemaphoreCreateMutex();
+    if(store_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create store mutex");
+    }
+}
+
+void capture_store_reset(const uint8_t *ssid, unsigned ssid_len, const uint8_t *bssid){
+    if(ssid_len > 32){
+        ESP_LOGW(TAG, "SSID too long (%u), truncating", ssid_len);
+        ssid_len = 32;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    records_chunk_t *chunks = drop_records();
+    reserve_render_scratch();
+    memset(&meta, 0, sizeof(meta));
+    memcpy(meta.ssid, ssid, ssid_len);
+    meta.ssid_len = ssid_len;
+    memcpy(meta.bssid, bssid, 6);
+    xSemaphoreGive(store_mutex);
+    free_chunks(chunks);
+}
+
+void capture_store_clear(){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    records_chunk_t *chunks = drop_records();
+    memset(&meta, 0, sizeof(meta));
+    xSemaphoreGive(store_mutex);
+    free_chunks(chunks);
+}
+
+esp_err_t capture_store_append_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec){
+    if((size == 0) || (size > UINT16_MAX)){
+        ESP_LOGD(TAG, "Invalid frame size %u. Not appending anything.", size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    esp_err_t err = ESP_OK;
+    records_chunk_t *unused_chunk;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    uint8_t *record = alloc_record(record_total_size(size), &unused_chunk);
+    if(record == NULL){
+        ESP_LOGE(TAG, "Capture memory full! Frame was not stored.");
+        if(meta.dropped_frames < UINT16_MAX){
+            meta.dropped_frames++;
+        }
+        err = ESP_ERR_NO_MEM;
+    }
+    else {
+        record_header_t header = { .ts_usec = ts_usec, .size = size, .reserved = 0 };
+        memcpy(record, &header, sizeof(record_header_t));
+        memcpy(&record[sizeof(record_header_t)], frame, size);
+        frame_count++;
+    }
+    xSemaphoreGive(store_mutex);
+    free(unused_chunk);
+    capture_store_frame_cb_t listener = frame_listener;
+    if((err == ESP_OK) && (listener != NULL)){
+        listener(frame, size, ts_usec, frame_listener_arg);
+    }
+    return err;
+}
+
+void capture_store_set_frame_listener(capture_store_frame_cb_t frame_cb, void *arg){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    frame_listener_arg = arg;
+    frame_listener = frame_cb;
+    xSemaphoreGive(store_mutex);
+}
+
+void capture_store_set_sta_mac(const uint8_t *mac_sta){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    memcpy(meta.mac_sta, mac_sta, 6);
+    xSemaphoreGive(store_mutex);
+}
+
+esp_err_t capture_store_add_pmkid(const uint8_t *pmkid){
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if(meta.pmkid_count >= CAPTURE_STORE_MAX_PMKIDS){
+        ESP_LOGW(TAG, "PMKID table full, PMKID not stored");
+        err = ESP_ERR_NO_MEM;
+    }
+    else {
+        memcpy(meta.pmkids[meta.pmkid_count], pmkid, 16);
+        meta.pmkid_count++;
+    }
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+unsigned capture_store_get_frame_count(){
+    return frame_count;
+}
+
+unsigned capture_store_get_dropped_frames(){
+    return meta.dropped_frames;
+}
+
+/**
+ * @brief Callback for each stored frame. Expects store_mutex to be taken.
+ */
+typedef esp_err_t (*frame_cb_t)(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg);
+
+static esp_err_t foreach_frame_in(const uint8_t *data, size_t size, frame_cb_t frame_cb, void *arg){
+    size_t offset = 0;
+    while(offset < size){
+        record_header_t header;
+        memcpy(&header, &data[offset], sizeof(record_header_t));
+        esp_err_t err = frame_cb(&data[offset + sizeof(record_header_t)], header.size, header.ts_usec, arg);
+        if(err != ESP_OK){
+            return err;
+        }
+        offset += record_total_size(header.size);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t foreach_frame(frame_cb_t frame_cb, void *arg){
+    esp_err_t err = foreach_frame_in(records, records_size, frame_cb, arg);
+    for(records_chunk_t *chunk = overflow_head; (chunk != NULL) && (err == ESP_OK); chunk = chunk->next){
+        err = foreach_frame_in(chunk->data, chunk->size, frame_cb, arg);
+    }
+    return err;
+}
+
+/**
+ * @brief Finds contiguous part of records starting at given offset. Expects store_mutex to be taken.
+ *
+ * @return size_t size of the part, 0 if offset is at the end of records or beyond
+ */
+static size_t find_segment(size_t offset, const uint8_t **data){
+    if(offset < records_size){
+        *data = &records[offset];
+        return records_size - offset;
+    }
+    offset -= records_size;
+    for(records_chunk_t *chunk = overflow_head; chunk != NULL; chunk = chunk->next){
+        if(offset < chunk->size){
+            *data = &chunk->data[offset];
+            return chunk->size - offset;
+        }
+        offset -= chunk->size;
+    }
+    *data = NULL;
+    return 0;
+}
+
+/**
+ * @brief Output of currently rendered view
+ */
+typedef struct {
+    capture_store_write_cb_t write_cb;
+    void *arg;
+} render_output_t;
+
+static esp_err_t write_raw_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg){
+    render_output_t *output = (render_output_t *) arg;
+    return output->write_cb(frame, size, output->arg);
+}
+
+static esp_err_t write_pcap_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg){
+    render_output_t *output = (render_output_t *) arg;
+    return pcap_serializer_write_frame(output->write_cb, output->arg, frame, size, ts_usec);
+}
+
+static esp_err_t write_pcapng_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg){
+    render_output_t *output = (render_output_t *) arg;
+    return pcapng_serializer_write_frame(output->write_cb, output->arg, frame, size, ts_usec);
+}
+
+static esp_err_t add_hccapx_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg){
+    hccapx_serializer_add_frame((hccapx_ctx_t *) arg, (data_frame_t *) frame);
+    return ESP_OK;
+}
+
+/**
+ * @brief Writes data as lowercase hex string using small stack buffer.
+ */
+static esp_err_t write_hex(render_output_t *output, const uint8_t *data, unsigned size){
+    static const char hex_digits[] = "0123456789abcdef";
+    uint8_t hex[64];
+    unsigned hex_len = 0;
+    for(unsigned i = 0; i < size; i++){
+        hex[hex_len++] = hex_digits[data[i] >> 4];
+        hex[hex_len++] = hex_digits[data[i] & 0x0f];
+        if((hex_len == sizeof(hex)) || (i == size - 1)){
+            esp_err_t err = output->write_cb(hex, hex_len, output->arg);
+            if(err != ESP_OK){
+                return err;
+            }
+            hex_len = 0;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t write_string(render_output_t *output, const char *string){
+    return output->write_cb((const uint8_t *) string, strlen(string), output->arg);
+}
+
+/**
+ * @brief Builds HCCAPX by replaying all stored frames through new serializer context.
+ *
+ * Context is placed into render scratch memory if it was reserved, heap is used otherwise.
+ * @param hccapx output buffer
+ * @return esp_err_t ESP_ERR_NOT_FOUND if no crackable message pair was captured
+ */
+static esp_err_t build_hccapx(hccapx_t *hccapx){
+    if(frame_count == 0){
+        return ESP_ERR_NOT_FOUND;
+    }
+    hccapx_ctx_t *ctx;
+    if(scratch_hccapx_ctx != NULL){
+        ctx = hccapx_serializer_init(scratch_hccapx_ctx, meta.ssid, meta.ssid_len);
+    }
+    else {
+        ctx = hccapx_serializer_create(meta.ssid, meta.ssid_len);
+    }
+    if(ctx == NULL){
+        return ESP_ERR_NO_MEM;
+    }
+    foreach_frame(add_hccapx_frame, ctx);
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    hccapx_t *result = hccapx_serializer_get(ctx);
+    if(result != NULL){
+        memcpy(hccapx, result, sizeof(hccapx_t));
+        err = ESP_OK;
+    }
+    if(ctx != scratch_hccapx_ctx){
+        hccapx_serializer_destroy(ctx);
+    }
+    return err;
+}
+
+static esp_err_t render_status(render_output_t *output){
+    if(meta.pmkid_count > 0){
+        // MAC_STA + MAC_AP + SSID size + SSID + PMKID * count
+        esp_err_t err = output->write_cb(meta.mac_sta, 6, output->arg);
+        if(err == ESP_OK){
+            err = output->write_cb(meta.bssid, 6, output->arg);
+        }
+        if(err == ESP_OK){
+            err = output->write_cb(&meta.ssid_len, 1, output->arg);
+        }
+        if((err == ESP_OK) && (meta.ssid_len > 0)){
+            err = output->write_cb(meta.ssid, meta.ssid_len, output->arg);
+        }
+        if(err == ESP_OK){
+            err = output->write_cb(meta.pmkids[0], meta.pmkid_count * 16, output->arg);
+        }
+        return err;
+    }
+    if(frame_count == 0){
+        return ESP_ERR_NOT_FOUND;
+    }
+    return foreach_frame(write_raw_frame, output);
+}
+
+/**
+ * @param hccapx scratch buffer allocated by caller outside of store lock
+ */
+static esp_err_t render_hccapx(render_output_t *output, hccapx_t *hccapx){
+    esp_err_t err = build_hccapx(hccapx);
+    if(err == ESP_OK){
+        err = output->write_cb((uint8_t *) hccapx, sizeof(hccapx_t), output->arg);
+    }
+    return err;
+}
+
+/**
+ * @param hccapx scratch buffer allocated by caller outside of store lock
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=cracking_wpawpa2
+ */
+static esp_err_t render_22000(render_output_t *output, hccapx_t *hccapx){
+    esp_err_t err = ESP_OK;
+    if(meta.pmkid_count > 0){
+        // WPA*01*PMKID*MAC_AP*MAC_STA*ESSID***
+        for(unsigned i = 0; (i < meta.pmkid_count) && (err == ESP_OK); i++){
+            err = write_string(output, "WPA*01*");
+            if(err == ESP_OK) err = write_hex(output, meta.pmkids[i], 16);
+            if(err == ESP_OK) err = write_string(output, "*");
+            if(err == ESP_OK) err = write_hex(output, meta.bssid, 6);
+            if(err == ESP_OK) err = write_string(output, "*");
+            if(err == ESP_OK) err = write_hex(output, meta.mac_sta, 6);
+            if(err == ESP_OK) err = write_string(output, "*");
+            if(err == ESP_OK) err = write_hex(output, meta.ssid, meta.ssid_len);
+            if(err == ESP_OK) err = write_string(output, "***\n");
+        }
+        return err;
+    }
+
+    err = build_hccapx(hccapx);
+    if(err == ESP_OK){
+        // WPA*02*MIC*MAC_AP*MAC_STA*ESSID*ANONCE*EAPOL*MESSAGEPAIR
+        err = write_string(output, "WPA*02*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->keymic, 16);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->mac_ap, 6);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->mac_sta, 6);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->essid, hccapx->essid_len);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->nonce_ap, 32);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, hccapx->eapol, hccapx->eapol_len);
+        if(err == ESP_OK) err = write_string(output, "*");
+        if(err == ESP_OK) err = write_hex(output, &hccapx->message_pair, 1);
+        if(err == ESP_OK) err = write_string(output, "\n");
+    }
+    return err;
+}
+
+esp_err_t capture_store_render(capture_view_t view, capture_store_write_cb_t write_cb, void *arg){
+    render_output_t output = { .write_cb = write_cb, .arg = arg };
+    esp_err_t err;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    hccapx_t *hccapx = scratch_hccapx;
+    hccapx_t *allocated_hccapx = NULL;
+    if((hccapx == NULL) && ((view == CAPTURE_VIEW_HCCAPX) || (view == CAPTURE_VIEW_22000))){
+        // no render scratch memory in run arena, allocation doesn't hold back frames waiting for store lock
+        xSemaphoreGive(store_mutex);
+        allocated_hccapx = (hccapx_t *) malloc(sizeof(hccapx_t));
+        if(allocated_hccapx == NULL){
+            return ESP_ERR_NO_MEM;
+        }
+        xSemaphoreTake(store_mutex, portMAX_DELAY);
+        hccapx = (scratch_hccapx != NULL) ? scratch_hccapx : allocated_hccapx;
+    }
+    switch(view){
+        case CAPTURE_VIEW_STATUS:
+            err = render_status(&output);
+            break;
+        case CAPTURE_VIEW_PCAP:
+            if(frame_count == 0){
+                err = ESP_ERR_NOT_FOUND;
+                break;
+            }
+            err = pcap_serializer_write_header(write_cb, arg);
+            if(err == ESP_OK){
+                err = foreach_frame(write_pcap_frame, &output);
+            }
+            break;
+        case CAPTURE_VIEW_PCAPNG:
+            if(frame_count == 0){
+                err = ESP_ERR_NOT_FOUND;
+                break;
+            }
+            err = pcapng_serializer_write_header(write_cb, arg);
+            if(err == ESP_OK){
+                err = foreach_frame(write_pcapng_frame, &output);
+            }
+            break;
+        case CAPTURE_VIEW_HCCAPX:
+            err = render_hccapx(&output, hccapx);
+            break;
+        case CAPTURE_VIEW_22000:
+            err = render_22000(&output, hccapx);
+            break;
+        default:
+            ESP_LOGE(TAG, "Unknown view %d", view);
+            err = ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreGive(store_mutex);
+    free(allocated_hccapx);
+    return err;
+}
+
+static esp_err_t count_size(const uint8_t *data, size_t size, void *arg){
+    *(size_t *) arg += size;
+    return ESP_OK;
+}
+
+size_t capture_store_get_view_size(capture_view_t view){
+    size_t size = 0;
+    if(capture_store_render(view, count_size, &size) != ESP_OK){
+        return 0;
+    }
+    return size;
+}
+
+void capture_store_lock(){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+}
+
+void capture_store_unlock(){
+    xSemaphoreGive(store_mutex);
+}
+
+void capture_store_get_meta(capture_store_meta_t *meta_out){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    memcpy(meta_out, &meta, sizeof(capture_store_meta_t));
+    xSemaphoreGive(store_mutex);
+}
+
+void capture_store_get_raw(const capture_store_meta_t **meta_out, size_t *size_out){
+    // records may be dropped by capture_store_clear() as soon as the lock is released
+    configASSERT(xSemaphoreGetMutexHolder(store_mutex) == xTaskGetCurrentTaskHandle());
+    *meta_out = &meta;
+    *size_out = records_size + overflow_size;
+}
+
+size_t capture_store_get_segment(size_t offset, const uint8_t **data){
+    configASSERT(xSemaphoreGetMutexHolder(store_mutex) == xTaskGetCurrentTaskHandle());
+    return find_segment(offset, data);
+}
+
+esp_err_t capture_store_get_delta(capture_store_meta_t *meta_out, size_t offset, const uint8_t **delta, size_t *delta_size){
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    memcpy(meta_out, &meta, sizeof(capture_store_meta_t));
+    if(offset > records_size + overflow_size){
+        err = ESP_ERR_INVALID_ARG;
+        *delta = NULL;
+        *delta_size = 0;
+    }
+    else {
+        // records are only appended, arena block is extended in place and chunks never move, so stored part doesn't change until next reset
+        *delta_size = find_segment(offset, delta);
+    }
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+esp_err_t capture_store_restore(const capture_store_meta_t *restored_meta, size_t size, capture_store_read_cb_t read_cb, void *arg){
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    records_chunk_t *chunks = drop_records();
+    reserve_render_scratch();
+    esp_err_t err = ESP_OK;
+    if((restored_meta->ssid_len > 32) || (restored_meta->pmkid_count > CAPTURE_STORE_MAX_PMKIDS)){
+        err = ESP_ERR_INVALID_ARG;
+    }
+    // records are read one by one directly into their place, so they never cross end of arena or chunk
+    size_t offset = 0;
+    while((err == ESP_OK) && (offset < size)){
+        record_header_t header;
+        if(offset + sizeof(record_header_t) > size){
+            err = ESP_ERR_INVALID_ARG;
+            break;
+        }
+        err = read_cb(offset, (uint8_t *) &header, sizeof(record_header_t), arg);
+        if(err != ESP_OK){
+            break;
+        }
+        size_t record_size = record_total_size(header.size);
+        if(offset + record_size > size){
+            err = ESP_ERR_INVALID_ARG;
+            break;
+        }
+        records_chunk_t *unused_chunk;
+        uint8_t *record = alloc_record(record_size, &unused_chunk);
+        free(unused_chunk);
+        if(record == NULL){
+            err = ESP_ERR_NO_MEM;
+            break;
+        }
+        memcpy(record, &header, sizeof(record_header_t));
+        err = read_cb(offset + sizeof(record_header_t), &record[sizeof(record_header_t)], record_size - sizeof(record_header_t), arg);
+        offset += record_size;
+        frame_count++;
+    }
+    if(err == ESP_OK){
+        memcpy(&meta, restored_meta, sizeof(capture_store_meta_t));
+        ESP_LOGD(TAG, "Restored %u frames (%u bytes)", frame_count, size);
+    }
+    else {
+        if(err == ESP_ERR_INVALID_ARG){
+            ESP_LOGE(TAG, "Persisted capture is malformed");
+        }
+        else if(err == ESP_ERR_NO_MEM){
+            ESP_LOGE(TAG, "Persisted capture doesn't fit into memory");
+        }
+        free_chunks(drop_records());
+    }
+    xSemaphoreGive(store_mutex);
+    free_chunks(chunks);
+    return err;
+}
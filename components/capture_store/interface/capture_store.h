@@ -0,0 +1,241 @@
+/**
+ * @file capture_store.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to single store of captured frames and attack metadata
+ * 
+ * Captured frames are stored only once. All export formats (views) are rendered from the store on demand,
+ * so adding new export format doesn't need another buffer.
+ */
+#ifndef CAPTURE_STORE_H
+#define CAPTURE_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Maximum number of PMKIDs kept in metadata
+ */
+#define CAPTURE_STORE_MAX_PMKIDS 8
+
+/**
+ * @brief Views that can be rendered from the store
+ */
+typedef enum {
+    CAPTURE_VIEW_STATUS,    ///< attack status content - PMKID result or raw concatenated frames
+    CAPTURE_VIEW_PCAP,      ///< LibPCAP file
+    CAPTURE_VIEW_PCAPNG,    ///< PCAPNG file
+    CAPTURE_VIEW_HCCAPX,    ///< hashcat HCCAPX (mode 2500)
+    CAPTURE_VIEW_22000      ///< hashcat WPA-PBKDF2-PMKID+EAPOL lines (mode 22000)
+} capture_view_t;
+
+/**
+ * @brief Metadata of captured data
+ */
+typedef struct {
+    uint8_t ssid[33];
+    uint8_t ssid_len;
+    uint8_t bssid[6];
+    uint8_t mac_sta[6];     ///< MAC of STA that requested PMKID
+    uint8_t pmkid_count;
+    uint8_t pmkids[CAPTURE_STORE_MAX_PMKIDS][16];
+    uint16_t dropped_frames;    ///< frames not stored because capture memory was full, capture is truncated if non-zero
+} capture_store_meta_t;
+
+/**
+ * @brief Callback used to output rendered view.
+ * 
+ * @param data rendered data
+ * @param size size of rendered data
+ * @param arg user argument passed to capture_store_render()
+ * @return esp_err_t ESP_OK if all data were written
+ */
+typedef esp_err_t (*capture_store_write_cb_t)(const uint8_t *data, size_t size, void *arg);
+
+/**
+ * @brief Callback used to read persisted frame records by capture_store_restore().
+ * 
+ * @param offset offset in persisted records, records are read from start to end
+ * @param buffer output buffer
+ * @param size number of bytes to read
+ * @param arg user argument passed to capture_store_restore()
+ * @return esp_err_t ESP_OK if all data were read
+ */
+typedef esp_err_t (*capture_store_read_cb_t)(size_t offset, uint8_t *buffer, size_t size, void *arg);
+
+/**
+ * @brief Callback notified about every frame appended to the store.
+ * 
+ * Called from task that appended the frame after the store is unlocked, so it must not block.
+ * @param frame frame buffer, valid only during the call
+ * @param size size of frame buffer
+ * @param ts_usec timestamp of captured frame in microseconds
+ * @param arg user argument passed to capture_store_set_frame_listener()
+ */
+typedef void (*capture_store_frame_cb_t)(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg);
+
+/**
+ * @brief Initialises store resources. This function should be called only once.
+ */
+void capture_store_init();
+
+/**
+ * @brief Frees all stored frames and starts new capture for given AP.
+ * 
+ * @param ssid SSID of target AP
+ * @param ssid_len length of SSID (max 32)
+ * @param bssid BSSID of target AP
+ */
+void capture_store_reset(const uint8_t *ssid, unsigned ssid_len, const uint8_t *bssid);
+
+/**
+ * @brief Frees all stored frames and clears metadata.
+ */
+void capture_store_clear();
+
+/**
+ * @brief Appends captured frame to the store.
+ * 
+ * Frames are stored in run arena. When it's full, they are stored in heap chunks of at least 4 kB, up to
+ * CONFIG_CAPTURE_STORE_OVERFLOW_SIZE bytes and only while enough heap stays free for Wi-Fi stack and webserver.
+ * Frames beyond that are dropped and counted in capture_store_meta_t::dropped_frames.
+ * 
+ * @param frame frame buffer
+ * @param size size of frame buffer
+ * @param ts_usec timestamp of captured frame in microseconds
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if the store cannot grow (frame is dropped)
+ */
+esp_err_t capture_store_append_frame(const uint8_t *frame, unsigned size, uint32_t ts_usec);
+
+/**
+ * @brief Sets listener notified about every appended frame. Only one listener is supported.
+ * 
+ * @param frame_cb listener, NULL removes it
+ * @param arg user argument for frame_cb
+ */
+void capture_store_set_frame_listener(capture_store_frame_cb_t frame_cb, void *arg);
+
+/**
+ * @brief Sets MAC address of STA that was used to request PMKID.
+ * 
+ * @param mac_sta 6 bytes MAC address
+ */
+void capture_store_set_sta_mac(const uint8_t *mac_sta);
+
+/**
+ * @brief Adds PMKID to metadata. 
+ * 
+ * @param pmkid 16 bytes PMKID
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if metadata are full
+ */
+esp_err_t capture_store_add_pmkid(const uint8_t *pmkid);
+
+/**
+ * @brief Returns number of stored frames.
+ * 
+ * @return unsigned 
+ */
+unsigned capture_store_get_frame_count();
+
+/**
+ * @brief Returns number of frames that were not stored because run arena was full.
+ *
+ * @return unsigned 0 if capture is complete
+ */
+unsigned capture_store_get_dropped_frames();
+
+/**
+ * @brief Renders given view and passes it to write callback.
+ * 
+ * @param view view to be rendered
+ * @param write_cb output callback
+ * @param arg user argument for write_cb
+ * @return esp_err_t ESP_OK on success
+ * @return ESP_ERR_NOT_FOUND if there is no data for the view (e.g. no crackable handshake)
+ * @return error returned by write_cb
+ */
+esp_err_t capture_store_render(capture_view_t view, capture_store_write_cb_t write_cb, void *arg);
+
+/**
+ * @brief Returns size of rendered view in bytes.
+ * 
+ * @param view 
+ * @return size_t 0 if there is no data for the view
+ */
+size_t capture_store_get_view_size(capture_view_t view);
+
+/**
+ * @brief Takes store lock, so content returned by capture_store_get_raw() stays valid.
+ *
+ * No other store function may be called by the holder until capture_store_unlock(). Frames appended meanwhile wait for the lock.
+ */
+void capture_store_lock();
+
+/**
+ * @brief Releases store lock taken by capture_store_lock().
+ */
+void capture_store_unlock();
+
+/**
+ * @brief Copies metadata of current capture.
+ *
+ * @param meta output parameter for metadata
+ */
+void capture_store_get_meta(capture_store_meta_t *meta);
+
+/**
+ * @brief Returns raw store content for persistence.
+ *
+ * Returned pointer points into the store, caller must hold capture_store_lock() while using it.
+ * Frame records are read by capture_store_get_segment().
+ * @param meta output parameter for metadata pointer
+ * @param size output parameter for size of serialized frame records
+ */
+void capture_store_get_raw(const capture_store_meta_t **meta, size_t *size);
+
+/**
+ * @brief Returns contiguous part of serialized frame records starting at given offset.
+ * 
+ * Records are stored in run arena and, after it gets full, in heap chunks, so they are contiguous only within
+ * one of these segments. Caller must hold capture_store_lock().
+ * @param offset offset in serialized frame records
+ * @param data output parameter for pointer to records at offset, \c NULL if offset is at the end
+ * @return size_t size of contiguous part, 0 if offset is at the end of records or beyond
+ */
+size_t capture_store_get_segment(size_t offset, const uint8_t **data);
+
+/**
+ * @brief Copies metadata and returns contiguous part of frame records appended after given offset.
+ * 
+ * Unlike capture_store_get_raw() it doesn't need store lock and is safe to call while frames are being appended, so it's used for checkpoints of running capture.
+ * Records never move during capture, so returned part stays valid until next reset. If delta_size is smaller than all new records,
+ * the rest continues in next segment and is returned by call with offset increased by delta_size.
+ * 
+ * @param meta output parameter for copy of metadata
+ * @param offset size of records that were already persisted
+ * @param delta output parameter for pointer to new records. \c NULL if there are no new records.
+ * @param delta_size output parameter for size of new records
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if offset is beyond stored records
+ */
+esp_err_t capture_store_get_delta(capture_store_meta_t *meta, size_t offset, const uint8_t **delta, size_t *delta_size);
+
+/**
+ * @brief Replaces store content with previously persisted one.
+ * 
+ * Records are read one by one by read_cb directly into run arena or heap chunks, the same way as frames are appended, so no
+ * intermediate buffer of whole capture is needed. Records are validated while being read.
+ * 
+ * @param meta persisted metadata
+ * @param size size of records
+ * @param read_cb callback that reads persisted records
+ * @param arg user argument passed to read_cb
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if records are malformed, ESP_ERR_NO_MEM if they don't fit into memory
+ * or error returned by read_cb. Store is empty in case of any error.
+ */
+esp_err_t capture_store_restore(const capture_store_meta_t *meta, size_t size, capture_store_read_cb_t read_cb, void *arg);
+
+#endif
\ No newline at end of file
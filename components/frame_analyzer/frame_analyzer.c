@@ -22,6 +22,10 @@
 static const char *TAG = "frame_analyzer";
 static uint8_t target_bssid[6];
 static search_type_t search_type = -1;
+/**
+ * @brief Analysis counters. Written only by event loop task.
+ */
+static frame_analyzer_counters_t counters;
 
 
 /**
@@ -35,11 +39,13 @@ static search_type_t search_type = -1;
 static void data_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
     ESP_LOGV(TAG, "Handling DATA frame");
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
+    counters.frames++;
 
     if(!is_frame_bssid_matching(frame, target_bssid)){
         ESP_LOGV(TAG, "Not matching BSSIDs.");
         return;
     }
+    counters.bssid_matched++;
 
     eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
     if(eapol_packet == NULL){
@@ -52,19 +58,25 @@ static void data_frame_handler(void *args, esp_event_base_t event_base, int32_t
         ESP_LOGV(TAG, "Not an EAPOL-Key packet");
         return;
     }
+    counters.eapol_key++;
 
     if(search_type == SEARCH_HANDSHAKE){
         // TODO handle timeouts properly by e.g. for cycle
-        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len, portMAX_DELAY));
+        if(ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len, portMAX_DELAY)) != ESP_OK){
+            counters.post_failures++;
+        }
         return;
     }
 
     if(search_type == SEARCH_PMKID){
-        pmkid_item_t *pmkid_items;
-        if((pmkid_items = parse_pmkid(eapol_key_packet)) == NULL){
+        pmkid_list_t pmkid_list;
+        unsigned pmkid_count = parse_pmkid(eapol_key_packet, &pmkid_list);
+        if(pmkid_count == 0){
             return;
         }
-        ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_items, sizeof(pmkid_item_t *), portMAX_DELAY));
+        counters.pmkids += pmkid_count;
+        // list is copied into event loop, nothing to free
+        ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_list, sizeof(pmkid_list_t), portMAX_DELAY));
         return;
     }
 }
@@ -79,3 +91,7 @@ void frame_analyzer_capture_start(search_type_t search_type_arg, const uint8_t *
 void frame_analyzer_capture_stop(){
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &data_frame_handler));
 }
+
+void frame_analyzer_get_counters(frame_analyzer_counters_t *counters_out){
+    memcpy(counters_out, &counters, sizeof(frame_analyzer_counters_t));
+}
@@ -86,19 +86,21 @@ eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet){
 }
 
 /**
- * @brief Parses all PMKIDs to linked list structure 
+ * @brief Parses all PMKIDs into list
  * 
  * It crawlers through key data buffer and looks for PMKIDs.
  * If PMKID element is found, its saved into the list of PMKIDs.
+ * PMKIDs beyond PMKID_LIST_MAX are skipped.
  * @param key_data 
  * @param length of key data
- * @return pmkid_item_t* 
+ * @param list output list of PMKIDs
+ * @return unsigned number of PMKIDs found
  */
-static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t length){
+static unsigned parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t length, pmkid_list_t *list){
     uint8_t *key_data_index = key_data;
     uint8_t *key_data_max_index = key_data + length;
 
-    pmkid_item_t *pmkid_item_head = NULL;
+    list->count = 0;
     key_data_field_t *key_data_field;
     do{
         key_data_field = (key_data_field_t *) key_data_index;
@@ -124,31 +126,35 @@ static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t
             continue;
         }
 
+        if(list->count >= PMKID_LIST_MAX){
+            ESP_LOGW(TAG, "Too many PMKIDs in key data, skipping");
+            continue;
+        }
+
         ESP_LOGI(TAG, "Found PMKID: ");
-        pmkid_item_t *pmkid_item = (pmkid_item_t *) malloc(sizeof(pmkid_item_t));
-        pmkid_item->next = pmkid_item_head;
-        pmkid_item_head = pmkid_item;
+        uint8_t *pmkid = list->pmkids[list->count++];
         for(unsigned i = 0; i < 16; i++){
-            pmkid_item->pmkid[i] = key_data_field->data[i];
-            printf("%02x", pmkid_item->pmkid[i]);
+            pmkid[i] = key_data_field->data[i];
+            printf("%02x", pmkid[i]);
         }
         printf("\n");
 
     } while((key_data_index = key_data_field->data + key_data_field->length - 4 + 1) < key_data_max_index); 
 
-    return pmkid_item_head;
+    return list->count;
 }
 
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key){
+unsigned parse_pmkid(eapol_key_packet_t *eapol_key, pmkid_list_t *list){
+    list->count = 0;
     if(eapol_key->key_data_length == 0){
         ESP_LOGD(TAG, "Empty Key Data");
-        return NULL;
+        return 0;
     }
 
     if(eapol_key->key_information.encrypted_key_data == 1){
         ESP_LOGD(TAG, "Key Data encrypted");
-        return NULL;
+        return 0;
     }
 
-    return parse_pmkid_from_key_data(eapol_key->key_data, ntohs(eapol_key->key_data_length));
+    return parse_pmkid_from_key_data(eapol_key->key_data, ntohs(eapol_key->key_data_length), list);
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #ifndef FRAME_ANALYZER_H
 #define FRAME_ANALYZER_H
 
+#include <stdint.h>
+
 #include "esp_event.h"
 
 ESP_EVENT_DECLARE_BASE(FRAME_ANALYZER_EVENTS);
@@ -28,6 +30,17 @@ typedef enum {
     SEARCH_PMKID
 } search_type_t;
 
+/**
+ * @brief Number of frames processed by frame analyzer since boot, per analysis stage
+ */
+typedef struct {
+    uint32_t frames;        ///< data frames received from sniffer
+    uint32_t bssid_matched; ///< data frames of target AP
+    uint32_t eapol_key;     ///< EAPoL-Key frames of target AP
+    uint32_t pmkids;        ///< PMKIDs parsed from EAPoL-Key frames
+    uint32_t post_failures; ///< results that couldn't be posted to event loop
+} frame_analyzer_counters_t;
+
 /**
  * @brief Starts frame analysis based on given search type and BSSID.
  * 
@@ -42,4 +55,11 @@ void frame_analyzer_capture_start(search_type_t search_type, const uint8_t *bssi
  */
 void frame_analyzer_capture_stop();
 
+/**
+ * @brief Copies analysis counters. Counters only grow, rates are computed from differences.
+ * 
+ * @param counters output parameter
+ */
+void frame_analyzer_get_counters(frame_analyzer_counters_t *counters);
+
 #endif
\ No newline at end of file
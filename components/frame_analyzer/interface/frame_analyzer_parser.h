@@ -47,11 +47,10 @@ eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet);
  * @brief Parses PMKIDs from EAPoL-Key packet
  * 
  * @param eapol_key 
- * @return pmkid_item_t* linked list of PMKIDs if parsing successful
- * @return \c NULL if no key data present
- * @return \c NULL if key data are encrypted
- * @return \c NULL parsing fails
+ * @param list output parameter for found PMKIDs, at most PMKID_LIST_MAX
+ * @return unsigned number of PMKIDs found
+ * @return 0 if no key data present, key data are encrypted or parsing fails
  */
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key);
+unsigned parse_pmkid(eapol_key_packet_t *eapol_key, pmkid_list_t *list);
 
 #endif
\ No newline at end of file
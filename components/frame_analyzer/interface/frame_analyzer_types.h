@@ -150,11 +150,16 @@ typedef struct __attribute__((__packed__)) {
 } key_data_field_t;
 
 /**
- * @brief linked list of PMKIDs
+ * @brief Maximum number of PMKIDs parsed from single EAPoL-Key packet
  */
-typedef struct pmkid_item {
-    uint8_t pmkid[16];
-    struct pmkid_item *next;
-} pmkid_item_t;
+#define PMKID_LIST_MAX 4
+
+/**
+ * @brief PMKIDs parsed from single EAPoL-Key packet. Passed by value, so it can be posted as event data without allocation.
+ */
+typedef struct {
+    uint8_t count;
+    uint8_t pmkids[PMKID_LIST_MAX][16];
+} pmkid_list_t;
 
 #endif
\ No newline at end of file
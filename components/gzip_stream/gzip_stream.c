@@ -0,0 +1,362 @@
+/**
+ * @file gzip_stream.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements streaming GZIP compressor
+ *
+ * Compressor uses greedy LZ77 matching over small sliding window and encodes output with fixed Huffman codes,
+ * so no frequency tables have to be built or stored. Output is standard GZIP (DEFLATE) stream, that can be
+ * decoded by any HTTP client or gzip tool.
+ *
+ * @see Ref: RFC 1951 (DEFLATE), RFC 1952 (GZIP)
+ */
+#include "gzip_stream.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include "esp_log.h"
+#include "esp_err.h"
+
+static const char *TAG = "gzip_stream";
+
+/**
+ * @brief Constants according to reference
+ *
+ * @see Ref: RFC 1951 [3.2.5]
+ */
+//@{
+#define MIN_MATCH 3
+#define MAX_MATCH 258
+#define END_OF_BLOCK 256
+//@}
+
+/**
+ * @brief Compressor tuning constants
+ */
+//@{
+#define BUFFER_SIZE (2 * GZIP_STREAM_WINDOW_SIZE)
+#define HASH_BITS 10
+#define HASH_SIZE (1 << HASH_BITS)
+#define MAX_CHAIN 16
+#define OUT_BUFFER_SIZE 256
+#define NIL 0xffff
+//@}
+
+struct gzip_stream {
+    gzip_stream_write_cb_t write_cb;
+    void *arg;
+    esp_err_t err;                  ///< first error returned by write callback
+    uint8_t window[BUFFER_SIZE];    ///< already encoded history followed by lookahead data
+    unsigned fill;                  ///< number of valid bytes in window
+    unsigned pos;                   ///< position of next byte to be encoded
+    uint16_t head[HASH_SIZE];       ///< latest position for each hash
+    uint16_t prev[BUFFER_SIZE];     ///< previous position with the same hash
+    uint32_t bit_buffer;
+    unsigned bit_count;
+    uint8_t out[OUT_BUFFER_SIZE];
+    unsigned out_len;
+    uint32_t crc;
+    uint32_t input_size;
+};
+
+/**
+ * @brief Base values and extra bits for length and distance codes
+ *
+ * @see Ref: RFC 1951 [3.2.5]
+ */
+//@{
+static const uint16_t length_base[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t length_extra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t distance_base[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t distance_extra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+//@}
+
+/**
+ * @brief CRC-32 (IEEE 802.3) lookup table for 4 bits at time.
+ *
+ * @see Ref: RFC 1952 [8]
+ */
+static const uint32_t crc_table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t size){
+    crc = ~crc;
+    for(size_t i = 0; i < size; i++){
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc_table[crc & 0x0f];
+        crc = (crc >> 4) ^ crc_table[crc & 0x0f];
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Passes buffered output to write callback.
+ *
+ * @param stream
+ */
+static void flush_output(gzip_stream_t *stream){
+    if((stream->out_len > 0) && (stream->err == ESP_OK)){
+        stream->err = stream->write_cb(stream->out, stream->out_len, stream->arg);
+    }
+    stream->out_len = 0;
+}
+
+static void put_byte(gzip_stream_t *stream, uint8_t byte){
+    stream->out[stream->out_len++] = byte;
+    if(stream->out_len == OUT_BUFFER_SIZE){
+        flush_output(stream);
+    }
+}
+
+/**
+ * @brief Writes bits into output, least significant bit first.
+ *
+ * @param stream
+ * @param value
+ * @param count number of bits from value to be written (max 16)
+ */
+static void put_bits(gzip_stream_t *stream, uint32_t value, unsigned count){
+    stream->bit_buffer |= value << stream->bit_count;
+    stream->bit_count += count;
+    while(stream->bit_count >= 8){
+        put_byte(stream, stream->bit_buffer & 0xff);
+        stream->bit_buffer >>= 8;
+        stream->bit_count -= 8;
+    }
+}
+
+/**
+ * @brief Writes Huffman code. Huffman codes are packed starting with most significant bit.
+ *
+ * @see Ref: RFC 1951 [3.1.1]
+ */
+static void put_code(gzip_stream_t *stream, uint32_t code, unsigned count){
+    uint32_t reversed = 0;
+    for(unsigned i = 0; i < count; i++){
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    put_bits(stream, reversed, count);
+}
+
+/**
+ * @brief Writes literal/length symbol using fixed Huffman code.
+ *
+ * @see Ref: RFC 1951 [3.2.6]
+ */
+static void put_literal_length(gzip_stream_t *stream, unsigned symbol){
+    if(symbol < 144){
+        put_code(stream, 0x30 + symbol, 8);
+    }
+    else if(symbol < 256){
+        put_code(stream, 0x190 + (symbol - 144), 9);
+    }
+    else if(symbol < 280){
+        put_code(stream, symbol - 256, 7);
+    }
+    else {
+        put_code(stream, 0xc0 + (symbol - 280), 8);
+    }
+}
+
+static void put_match(gzip_stream_t *stream, unsigned length, unsigned distance){
+    unsigned code = 0;
+    while((code < 28) && (length_base[code + 1] <= length)){
+        code++;
+    }
+    put_literal_length(stream, 257 + code);
+    put_bits(stream, length - length_base[code], length_extra[code]);
+
+    code = 0;
+    while((code < 29) && (distance_base[code + 1] <= distance)){
+        code++;
+    }
+    put_code(stream, code, 5);
+    put_bits(stream, distance - distance_base[code], distance_extra[code]);
+}
+
+static unsigned hash(const uint8_t *data){
+    return ((data[0] << 6) ^ (data[1] << 3) ^ data[2]) & (HASH_SIZE - 1);
+}
+
+/**
+ * @brief Inserts position into hash chains. Needs at least MIN_MATCH bytes available from position.
+ */
+static void insert_position(gzip_stream_t *stream, unsigned pos){
+    if(pos + MIN_MATCH > stream->fill){
+        return;
+    }
+    unsigned h = hash(&stream->window[pos]);
+    stream->prev[pos] = stream->head[h];
+    stream->head[h] = pos;
+}
+
+/**
+ * @brief Finds longest match for current position within the window.
+ *
+ * @param stream
+ * @param distance output parameter for match distance
+ * @return unsigned length of the match, 0 if no usable match was found
+ */
+static unsigned find_match(gzip_stream_t *stream, unsigned *distance){
+    unsigned pos = stream->pos;
+    unsigned max_length = stream->fill - pos;
+    if(max_length > MAX_MATCH){
+        max_length = MAX_MATCH;
+    }
+    if(max_length < MIN_MATCH){
+        return 0;
+    }
+
+    unsigned best_length = 0;
+    unsigned candidate = stream->head[hash(&stream->window[pos])];
+    for(unsigned chain = 0; (chain < MAX_CHAIN) && (candidate != NIL) && (candidate < pos); chain++){
+        if(pos - candidate > GZIP_STREAM_WINDOW_SIZE){
+            break;
+        }
+        unsigned length = 0;
+        while((length < max_length) && (stream->window[candidate + length] == stream->window[pos + length])){
+            length++;
+        }
+        if(length > best_length){
+            best_length = length;
+            *distance = pos - candidate;
+            if(length == max_length){
+                break;
+            }
+        }
+        candidate = stream->prev[candidate];
+    }
+    return (best_length >= MIN_MATCH) ? best_length : 0;
+}
+
+/**
+ * @brief Encodes buffered data.
+ *
+ * Unless finishing, enough lookahead is kept in window so the longest possible match can be found.
+ * @param stream
+ * @param finish encode all buffered data
+ */
+static void compress(gzip_stream_t *stream, bool finish){
+    while(stream->pos < stream->fill){
+        if(!finish && (stream->fill - stream->pos < MAX_MATCH)){
+            break;
+        }
+        unsigned distance = 0;
+        unsigned length = find_match(stream, &distance);
+        if(length == 0){
+            put_literal_length(stream, stream->window[stream->pos]);
+            insert_position(stream, stream->pos);
+            stream->pos++;
+            continue;
+        }
+        put_match(stream, length, distance);
+        for(unsigned i = 0; i < length; i++){
+            insert_position(stream, stream->pos + i);
+        }
+        stream->pos += length;
+    }
+}
+
+static uint16_t slide_position(uint16_t position){
+    return ((position == NIL) || (position < GZIP_STREAM_WINDOW_SIZE)) ? NIL : position - GZIP_STREAM_WINDOW_SIZE;
+}
+
+/**
+ * @brief Drops oldest half of the buffer, which is already out of the window, and rebases hash chains.
+ */
+static void slide_window(gzip_stream_t *stream){
+    memmove(stream->window, &stream->window[GZIP_STREAM_WINDOW_SIZE], stream->fill - GZIP_STREAM_WINDOW_SIZE);
+    stream->fill -= GZIP_STREAM_WINDOW_SIZE;
+    stream->pos -= GZIP_STREAM_WINDOW_SIZE;
+    for(unsigned i = 0; i < HASH_SIZE; i++){
+        stream->head[i] = slide_position(stream->head[i]);
+    }
+    for(unsigned i = 0; i < GZIP_STREAM_WINDOW_SIZE; i++){
+        stream->prev[i] = slide_position(stream->prev[i + GZIP_STREAM_WINDOW_SIZE]);
+    }
+}
+
+size_t gzip_stream_get_size(){
+    return sizeof(gzip_stream_t);
+}
+
+gzip_stream_t *gzip_stream_create(gzip_stream_write_cb_t write_cb, void *arg){
+    void *buffer = malloc(sizeof(gzip_stream_t));
+    if(buffer == NULL){
+        ESP_LOGE(TAG, "Failed to allocate compressor (%u bytes)", sizeof(gzip_stream_t));
+        return NULL;
+    }
+    return gzip_stream_init(buffer, write_cb, arg);
+}
+
+gzip_stream_t *gzip_stream_init(void *buffer, gzip_stream_write_cb_t write_cb, void *arg){
+    gzip_stream_t *stream = (gzip_stream_t *) buffer;
+    memset(stream, 0, sizeof(gzip_stream_t));
+    stream->write_cb = write_cb;
+    stream->arg = arg;
+    memset(stream->head, 0xff, sizeof(stream->head));
+
+    // Ref: RFC 1952 [2.3] - deflate, no flags, no mtime, unknown OS
+    static const uint8_t gzip_header[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff };
+    for(unsigned i = 0; i < sizeof(gzip_header); i++){
+        put_byte(stream, gzip_header[i]);
+    }
+    // Whole stream is one non-final block with fixed Huffman codes (BFINAL = 0, BTYPE = 01)
+    put_bits(stream, 0, 1);
+    put_bits(stream, 1, 2);
+    return stream;
+}
+
+esp_err_t gzip_stream_write(gzip_stream_t *stream, const uint8_t *data, size_t size){
+    stream->crc = crc32_update(stream->crc, data, size);
+    stream->input_size += size;
+    while(size > 0){
+        unsigned chunk = BUFFER_SIZE - stream->fill;
+        if(chunk > size){
+            chunk = size;
+        }
+        memcpy(&stream->window[stream->fill], data, chunk);
+        stream->fill += chunk;
+        data += chunk;
+        size -= chunk;
+
+        compress(stream, false);
+        if(stream->fill == BUFFER_SIZE){
+            slide_window(stream);
+        }
+    }
+    return stream->err;
+}
+
+esp_err_t gzip_stream_finish(gzip_stream_t *stream){
+    compress(stream, true);
+    put_literal_length(stream, END_OF_BLOCK);
+    // Empty final block terminates the stream (BFINAL = 1, BTYPE = 01)
+    put_bits(stream, 1, 1);
+    put_bits(stream, 1, 2);
+    put_literal_length(stream, END_OF_BLOCK);
+    // Align to byte boundary
+    put_bits(stream, 0, (8 - stream->bit_count) % 8);
+
+    // Ref: RFC 1952 [2.3.1] - CRC32 and size of uncompressed input, little endian
+    for(unsigned i = 0; i < 4; i++){
+        put_byte(stream, (stream->crc >> (8 * i)) & 0xff);
+    }
+    for(unsigned i = 0; i < 4; i++){
+        put_byte(stream, (stream->input_size >> (8 * i)) & 0xff);
+    }
+    flush_output(stream);
+    ESP_LOGD(TAG, "Compressed %u bytes", stream->input_size);
+    return stream->err;
+}
+
+void gzip_stream_destroy(gzip_stream_t *stream){
+    free(stream);
+}
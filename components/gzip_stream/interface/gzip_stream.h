@@ -0,0 +1,93 @@
+/**
+ * @file gzip_stream.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface for streaming GZIP compressor with small memory footprint
+ */
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Size of LZ77 window in bytes. Back references never point further than this.
+ */
+#define GZIP_STREAM_WINDOW_SIZE 2048
+
+/**
+ * @brief Callback used by compressor to write compressed output.
+ * 
+ * @param data compressed data
+ * @param size size of compressed data
+ * @param arg user argument passed to gzip_stream_create()
+ * @return esp_err_t ESP_OK if all data were written
+ */
+typedef esp_err_t (*gzip_stream_write_cb_t)(const uint8_t *data, size_t size, void *arg);
+
+/**
+ * @brief Opaque streaming compressor state.
+ */
+typedef struct gzip_stream gzip_stream_t;
+
+/**
+ * @brief Creates new compressor. GZIP header is only buffered, write_cb isn't called yet.
+ * 
+ * Failure of write_cb is first reported by gzip_stream_write() or gzip_stream_finish(), so creation
+ * doesn't tell whether the sink is writable.
+ * @param write_cb callback that receives compressed output
+ * @param arg user argument passed to write_cb
+ * @return gzip_stream_t* newly allocated compressor
+ * @return \c NULL if allocation failed
+ */
+gzip_stream_t *gzip_stream_create(gzip_stream_write_cb_t write_cb, void *arg);
+
+/**
+ * @brief Returns size of compressor state, so caller can provide memory for gzip_stream_init().
+ * 
+ * @return size_t size in bytes
+ */
+size_t gzip_stream_get_size();
+
+/**
+ * @brief Creates new compressor in memory provided by caller. Behaves as gzip_stream_create() otherwise.
+ * 
+ * Memory stays owned by caller, so gzip_stream_destroy() must not be called on returned compressor.
+ * @param buffer memory of at least gzip_stream_get_size() bytes aligned to 4 bytes
+ * @param write_cb callback that receives compressed output
+ * @param arg user argument passed to write_cb
+ * @return gzip_stream_t* compressor placed at the start of buffer
+ */
+gzip_stream_t *gzip_stream_init(void *buffer, gzip_stream_write_cb_t write_cb, void *arg);
+
+/**
+ * @brief Compresses given data. Output may be buffered until more data arrive or gzip_stream_finish() is called.
+ * 
+ * @param stream compressor
+ * @param data uncompressed data
+ * @param size size of uncompressed data
+ * @return esp_err_t ESP_OK on success, error returned by write callback otherwise
+ */
+esp_err_t gzip_stream_write(gzip_stream_t *stream, const uint8_t *data, size_t size);
+
+/**
+ * @brief Flushes all pending data and writes GZIP trailer.
+ * 
+ * No more data can be written after this call.
+ * @param stream compressor
+ * @return esp_err_t ESP_OK on success, error returned by write callback otherwise
+ */
+esp_err_t gzip_stream_finish(gzip_stream_t *stream);
+
+/**
+ * @brief Frees compressor created by gzip_stream_create(). 
+ * 
+ * @param stream compressor to be freed, may be \c NULL
+ */
+void gzip_stream_destroy(gzip_stream_t *stream);
+
+#endif
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "hccapx_serializer.h"
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
@@ -29,33 +30,21 @@
 #define HCCAPX_KEYVER_WPA 1
 #define HCCAPX_KEYVER_WPA2 2
 #define HCCAPX_MAX_EAPOL_SIZE 256
+#define HCCAPX_MAX_ESSID_SIZE 32
 //@}
 
 static char *TAG = "hccapx_serializer";
 
 /**
- * @brief Default values for hccapx buffer
+ * @brief Serializer context holding one HCCAPX buffer and the handshake state machine for it.
  */
-static hccapx_t hccapx = { 
-    .signature = HCCAPX_SIGNATURE, 
-    .version = 4, 
-    .message_pair = 255,
-    .keyver = HCCAPX_KEYVER_WPA2
+struct hccapx_ctx {
+    hccapx_t hccapx;        ///< HCCAPX buffer being built
+    unsigned message_ap;    ///< last processed message from AP
+    unsigned message_sta;   ///< last processed message from STA
+    unsigned eapol_source;  ///< number of message from which was the EAPoL packet saved
 };
 
-/**
- * @brief Stores last processed message
- */
-//@{
-static unsigned message_ap = 0;
-static unsigned message_sta = 0;
-//@}
-
-/**
- * @brief Stores number of message from which was the EAPoL packet saved.  
- */
-static unsigned eapol_source = 0;
-
 /**
  * @brief Says whether array contains only zero values or not
  * 
@@ -73,18 +62,49 @@ static bool is_array_zero(uint8_t *array, unsigned size){
     return true;
 }
 
-void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
-    hccapx.essid_len = size;
-    memcpy(hccapx.essid, ssid, size);
-    hccapx.message_pair = 255;
+hccapx_ctx_t *hccapx_serializer_create(const uint8_t *ssid, unsigned size){
+    if(size > HCCAPX_MAX_ESSID_SIZE){
+        ESP_LOGE(TAG, "SSID is too long (%u/%u)", size, HCCAPX_MAX_ESSID_SIZE);
+        return NULL;
+    }
+    void *buffer = malloc(sizeof(hccapx_ctx_t));
+    if(buffer == NULL){
+        ESP_LOGE(TAG, "Failed to allocate HCCAPX serializer context");
+        return NULL;
+    }
+    return hccapx_serializer_init(buffer, ssid, size);
+}
+
+size_t hccapx_serializer_get_size(){
+    return sizeof(hccapx_ctx_t);
+}
+
+hccapx_ctx_t *hccapx_serializer_init(void *buffer, const uint8_t *ssid, unsigned size){
+    if(size > HCCAPX_MAX_ESSID_SIZE){
+        ESP_LOGE(TAG, "SSID is too long (%u/%u)", size, HCCAPX_MAX_ESSID_SIZE);
+        return NULL;
+    }
+    hccapx_ctx_t *ctx = (hccapx_ctx_t *) buffer;
+    memset(ctx, 0, sizeof(hccapx_ctx_t));
+    ctx->hccapx.signature = HCCAPX_SIGNATURE;
+    ctx->hccapx.version = HCCAPX_VERSION;
+    ctx->hccapx.message_pair = 255;
+    ctx->hccapx.keyver = HCCAPX_KEYVER_WPA2;
+    ctx->hccapx.essid_len = size;
+    memcpy(ctx->hccapx.essid, ssid, size);
+    return ctx;
+}
+
+void hccapx_serializer_destroy(hccapx_ctx_t *ctx){
+    free(ctx);
 }
 
-hccapx_t *hccapx_serializer_get(){
-    if(hccapx.message_pair == 255){
+hccapx_t *hccapx_serializer_get(hccapx_ctx_t *ctx){
+    if((ctx == NULL) || (ctx->hccapx.message_pair == 255)){
         return NULL;
     }
     
-    return &hccapx;
+    return &ctx->hccapx;
 }
 
 /**
@@ -92,27 +112,28 @@ hccapx_t *hccapx_serializer_get(){
  * 
  * Also sets Key MIC value to the one present in the given EAPoL-Key packet
  * 
+ * @param ctx serializer context
  * @param eapol_packet EAPoL packet to be saved that includes also EAPoL header
  * @param eapol_key_packet EAPoL-Key parsed to get key MIC from it
  * @return unsigned
  * @return 1 if error occured
  * @return 0 if successfully saved
  */
-static unsigned save_eapol(eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet){
+static unsigned save_eapol(hccapx_ctx_t *ctx, eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet){
     unsigned eapol_len = 0;
     eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
     if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
         ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
         return 1;
     }
-    hccapx.eapol_len = eapol_len;
-    memcpy(hccapx.eapol, eapol_packet, hccapx.eapol_len);
-    memcpy(hccapx.keymic, eapol_key_packet->key_mic, 16);
+    ctx->hccapx.eapol_len = eapol_len;
+    memcpy(ctx->hccapx.eapol, eapol_packet, ctx->hccapx.eapol_len);
+    memcpy(ctx->hccapx.keymic, eapol_key_packet->key_mic, 16);
     // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
     // This is not documented in HCCAPX reference.
     // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
     // MIC key on 77 bytes offset inside EAPoL-Key + 4 bytes EAPoL header.
-    memset(&hccapx.eapol[81], 0x0, 16);
+    memset(&ctx->hccapx.eapol[81], 0x0, 16);
     return 0;
 }
 
@@ -121,64 +142,67 @@ static unsigned save_eapol(eapol_packet_t *eapol_packet, eapol_key_packet_t *eap
  * 
  * This message is from AP. It always contains ANonce.
  * 
+ * @param ctx serializer context
  * @param eapol_key_packet parsed EAPoL-Key packet
  */
-static void ap_message_m1(eapol_key_packet_t *eapol_key_packet){
+static void ap_message_m1(hccapx_ctx_t *ctx, eapol_key_packet_t *eapol_key_packet){
     ESP_LOGD(TAG, "From AP M1");
-    message_ap = 1;
-    memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+    ctx->message_ap = 1;
+    memcpy(ctx->hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
 }
 
 /**
  * @brief Handles third message of WPA handshake - from AP to STA
  * 
+ * @param ctx serializer context
  * @param eapol_packet 
  * @param eapol_key_packet 
  */
-static void ap_message_m3(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
+static void ap_message_m3(hccapx_ctx_t *ctx, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
     ESP_LOGD(TAG, "From AP M3");
-    message_ap = 3;
-    if(message_ap == 0){
+    ctx->message_ap = 3;
+    if(ctx->message_ap == 0){
         // No AP message was processed yet. ANonce has to be copied into HCCAPX buffer.
-        memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+        memcpy(ctx->hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
     }
-    if(eapol_source == 2){
+    if(ctx->eapol_source == 2){
         // EAPoL packet was already saved from message #2. No need to resave it.
-        hccapx.message_pair = 2;
+        ctx->hccapx.message_pair = 2;
         return;
     }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
+    if(save_eapol(ctx, eapol_packet, eapol_key_packet) != 0){
         return;
     }
-    eapol_source = 3;
-    if(message_sta == 2){
-        hccapx.message_pair = 3;
+    ctx->eapol_source = 3;
+    if(ctx->message_sta == 2){
+        ctx->hccapx.message_pair = 3;
     }
 }
 
 /**
  * @brief Handles messages from AP - handshake M1 and M3.
  * 
+ * @param ctx serializer context
  * @param frame 
  * @param eapol_packet 
  * @param eapol_key_packet 
  */
-static void ap_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if((!is_array_zero(hccapx.mac_sta, 6)) && (memcmp(frame->mac_header.addr1, hccapx.mac_sta, 6) != 0)){
+static void ap_message(hccapx_ctx_t *ctx, data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
+    if((!is_array_zero(ctx->hccapx.mac_sta, 6)) && (memcmp(frame->mac_header.addr1, ctx->hccapx.mac_sta, 6) != 0)){
         ESP_LOGE(TAG, "Different STA");
         return;
     }
-    if(message_ap == 0){
-        memcpy(hccapx.mac_ap, frame->mac_header.addr2, 6);
+    if(ctx->message_ap == 0){
+        memcpy(ctx->hccapx.mac_ap, frame->mac_header.addr2, 6);
     }
     // Determine which message this is by Key MIC
     // Key MIC is always empty in M1 and always present in M3
     // Ref: 802.11i-2004 [8.5.3]
     if(is_array_zero(eapol_key_packet->key_mic, 16)){
-        ap_message_m1(eapol_key_packet);
+        ap_message_m1(ctx, eapol_key_packet);
     } 
     else {
-        ap_message_m3(eapol_packet, eapol_key_packet);
+        ap_message_m3(ctx, eapol_packet, eapol_key_packet);
     }
 }
 
@@ -188,19 +212,20 @@ static void ap_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_
  * Saves EAPoL packet as this is the first time key MIC is present.
  * Saves SNonce.
  * 
+ * @param ctx serializer context
  * @param eapol_packet 
  * @param eapol_key_packet 
  */
-static void sta_message_m2(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
+static void sta_message_m2(hccapx_ctx_t *ctx, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
     ESP_LOGD(TAG, "From STA M2");
-    message_sta = 2;
-    memcpy(hccapx.nonce_sta, eapol_key_packet->key_nonce, 32);
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
+    ctx->message_sta = 2;
+    memcpy(ctx->hccapx.nonce_sta, eapol_key_packet->key_nonce, 32);
+    if(save_eapol(ctx, eapol_packet, eapol_key_packet) != 0){
         return;
     }
-    eapol_source = 2;
-    if(message_ap == 1){
-        hccapx.message_pair = 0;
+    ctx->eapol_source = 2;
+    if(ctx->message_ap == 1){
+        ctx->hccapx.message_pair = 0;
         return;
     }
 }
@@ -209,49 +234,51 @@ static void sta_message_m2(eapol_packet_t* eapol_packet, eapol_key_packet_t *eap
  * @brief Handles fourth message of the handshake. From STA to AP.
  * 
  * 
+ * @param ctx serializer context
  * @param eapol_packet 
  * @param eapol_key_packet 
  */
-static void sta_message_m4(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
+static void sta_message_m4(hccapx_ctx_t *ctx, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
     ESP_LOGD(TAG, "From STA M4");
-    if((message_sta == 2) && (eapol_source != 0)){
+    if((ctx->message_sta == 2) && (ctx->eapol_source != 0)){
         // If message 2 was already fully processed, there is no need to process M4 again 
         ESP_LOGD(TAG, "Already have M2, not worth");
         return;
     }
-    if(message_ap == 0){
+    if(ctx->message_ap == 0){
         // If there was no AP message processed yet, ANonce will be always missing.
         ESP_LOGE(TAG, "Not enought handshake messages received.");
         return;
     }
-    if(eapol_source == 3){
-        hccapx.message_pair = 4;
+    if(ctx->eapol_source == 3){
+        ctx->hccapx.message_pair = 4;
         return;
     }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
+    if(save_eapol(ctx, eapol_packet, eapol_key_packet) != 0){
         return;
     }
-    eapol_source = 4;
-    if(message_ap == 1){
-        hccapx.message_pair = 1;
+    ctx->eapol_source = 4;
+    if(ctx->message_ap == 1){
+        ctx->hccapx.message_pair = 1;
     }
-    if(message_ap == 3){
-        hccapx.message_pair = 5;
+    if(ctx->message_ap == 3){
+        ctx->hccapx.message_pair = 5;
     }
 }
 
 /**
  * @brief Handles messages from STA - M2 and M4
  * 
+ * @param ctx serializer context
  * @param frame 
  * @param eapol_packet 
  * @param eapol_key_packet 
  */
-static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if(is_array_zero(hccapx.mac_sta, 6)){
-        memcpy(hccapx.mac_sta, frame->mac_header.addr2, 6);
+static void sta_message(hccapx_ctx_t *ctx, data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
+    if(is_array_zero(ctx->hccapx.mac_sta, 6)){
+        memcpy(ctx->hccapx.mac_sta, frame->mac_header.addr2, 6);
     }
-    else if(memcmp(frame->mac_header.addr2, hccapx.mac_sta, 6) != 0){
+    else if(memcmp(frame->mac_header.addr2, ctx->hccapx.mac_sta, 6) != 0){
         ESP_LOGE(TAG, "Different STA");
         return;
     }
@@ -259,10 +286,10 @@ static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol
     // SNonce is present in M2, empty in M4
     // Ref: 802.11i-2004 [8.5.3]
     if(!is_array_zero(eapol_key_packet->key_nonce, 16)){
-        sta_message_m2(eapol_packet, eapol_key_packet);
+        sta_message_m2(ctx, eapol_packet, eapol_key_packet);
     } 
     else {
-        sta_message_m4(eapol_packet, eapol_key_packet);
+        sta_message_m4(ctx, eapol_packet, eapol_key_packet);
     }
 }
 
@@ -277,17 +304,27 @@ static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol
  * | <--------- M4
  * @endcode
  * 
+ * @param ctx serializer context
  * @param frame 
  */
-void hccapx_serializer_add_frame(data_frame_t *frame){
+void hccapx_serializer_add_frame(hccapx_ctx_t *ctx, data_frame_t *frame){
+    if(ctx == NULL){
+        return;
+    }
     eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
+    if(eapol_packet == NULL){
+        return;
+    }
     eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+    if(eapol_key_packet == NULL){
+        return;
+    }
     // Determine direction of the frame by comparing BSSID (addr3) with source address (addr2)
     if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) == 0){
-        ap_message(frame, eapol_packet, eapol_key_packet);
+        ap_message(ctx, frame, eapol_packet, eapol_key_packet);
     } 
     else if(memcmp(frame->mac_header.addr1, frame->mac_header.addr3, 6) == 0){
-        sta_message(frame, eapol_packet, eapol_key_packet);
+        sta_message(ctx, frame, eapol_packet, eapol_key_packet);
     } 
     else {
         ESP_LOGE(TAG, "Unknown frame format. BSSID is not source nor destionation.");
@@ -9,6 +9,7 @@
 #ifndef HCCAPX_SERIALIZER_H
 #define HCCAPX_SERIALIZER_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "frame_analyzer_types.h"
@@ -35,30 +36,70 @@ typedef struct __attribute__((__packed__)){
 } hccapx_t;
 
 /**
- * @brief Creates new HCCAPX buffer for given SSID.
+ * @brief Opaque HCCAPX serializer context.
  * 
- * This will clear any previous HCCAPX. If you want to save it, first call hccapx_serializer_get() and copy buffer somewhere else.
+ * Each context holds its own HCCAPX buffer and handshake state, so multiple handshake streams
+ * can be serialized independently.
+ */
+typedef struct hccapx_ctx hccapx_ctx_t;
+
+/**
+ * @brief Creates new HCCAPX serializer context for given SSID.
+ * 
+ * Returned context starts from clean state. Call hccapx_serializer_destroy() when it's no longer needed.
  * @param ssid SSID of AP from which the handshake frames will be comming.
- * @param size length of SSID string (including \0)
+ * @param size length of SSID string (without \0, max 32)
+ * @return hccapx_ctx_t* newly allocated context
+ * @return \c NULL if allocation failed or SSID is too long
+ */
+hccapx_ctx_t *hccapx_serializer_create(const uint8_t *ssid, unsigned size);
+
+/**
+ * @brief Returns size of serializer context, so caller can provide memory for hccapx_serializer_init().
+ * 
+ * @return size_t size in bytes
+ */
+size_t hccapx_serializer_get_size();
+
+/**
+ * @brief Creates new HCCAPX serializer context in memory provided by caller.
+ * 
+ * Memory stays owned by caller, so hccapx_serializer_destroy() must not be called on returned context.
+ * @param buffer memory of at least hccapx_serializer_get_size() bytes aligned to 4 bytes
+ * @param ssid SSID of AP from which the handshake frames will be comming.
+ * @param size length of SSID string (without \0, max 32)
+ * @return hccapx_ctx_t* context placed at the start of buffer
+ * @return \c NULL if SSID is too long
+ */
+hccapx_ctx_t *hccapx_serializer_init(void *buffer, const uint8_t *ssid, unsigned size);
+
+/**
+ * @brief Frees HCCAPX serializer context created by hccapx_serializer_create().
+ * 
+ * Pointer returned by hccapx_serializer_get() for this context is invalid afterwards.
+ * @param ctx context to be freed, may be \c NULL
  */
-void hccapx_serializer_init(const uint8_t *ssid, unsigned size);
+void hccapx_serializer_destroy(hccapx_ctx_t *ctx);
 
 /**
  * @brief Returns pointer to buffer with HCCAPX formatted binary data 
  * 
+ * @param ctx serializer context
  * @return hccapx_t* 
+ * @return \c NULL if no crackable message pair was captured yet
  */
-hccapx_t *hccapx_serializer_get();
+hccapx_t *hccapx_serializer_get(hccapx_ctx_t *ctx);
 
 /**
- * @brief Adds new handshake frames into current HCCAPX.
+ * @brief Adds new handshake frames into HCCAPX of given context.
  * 
  * This function will process given frames and extract data that are relevant.
  * If frame contains handshake from another STA than the one that was already added before,
  * frame will be skipped and error message will be printed.
  * 
+ * @param ctx serializer context, \c NULL is ignored
  * @param frame data frame with EAPoL-Key packet
  */
-void hccapx_serializer_add_frame(data_frame_t *frame);
+void hccapx_serializer_add_frame(hccapx_ctx_t *ctx, data_frame_t *frame);
 
 #endif
\ No newline at end of file
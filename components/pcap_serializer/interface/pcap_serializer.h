@@ -4,12 +4,15 @@
  * @date 2021-04-05
  * @copyright Copyright (c) 2021
  * 
- * @brief Provides interface to generate PCAP formatted binary from raw frame bytes 
+ * @brief Provides interface to generate PCAP and PCAPNG formatted binary from raw frame bytes 
  */
 #ifndef PCAP_SERIALIZER_H
 #define PCAP_SERIALIZER_H
 
 #include <stdint.h>
+#include <stddef.h>
+
+#include "esp_err.h"
 
 /**
  * @brief PCAP global header
@@ -39,44 +42,67 @@ typedef struct {
 } pcap_record_header_t;
 
 /**
- * @brief Prepares new empty buffer for PCAP formatted binary data. 
+ * @brief PCAPNG general block header
  * 
- * Has always to be called before pcap_serializer_append_frame()
- * @return uint8_t* pointer to newly allocated PCAP buffer.
- * @return \c NULL initialisation failed
+ * @see Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html#section-3.1
  */
-uint8_t *pcap_serializer_init();
+typedef struct {
+        uint32_t block_type;            /* block type */
+        uint32_t block_total_length;    /* total length of block including header and trailing length */
+} pcapng_block_header_t;
 
 /**
- * @brief Appends new frame to existing PCAP buffer.
+ * @brief Callback used by serializer to write formatted binary data.
  * 
- * Expects pcap_serializer_append_frame() was already called.
- * @param buffer frame buffer that should be appended to PCAP
- * @param size size of frame buffer
- * @param ts_usec timestamp of captured frame in microseconds
+ * @param data formatted data
+ * @param size size of formatted data
+ * @param arg user argument passed to serializer function
+ * @return esp_err_t ESP_OK if all data were written
  */
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec);
+typedef esp_err_t (*pcap_serializer_write_cb_t)(const uint8_t *data, size_t size, void *arg);
 
 /**
- * @brief Frees PCAP buffer and resets all values.
+ * @brief Writes PCAP global header.
  * 
- * After calling this function, you have to call pcap_serializer_init() to append new frames again.
+ * Has always to be written before first pcap_serializer_write_frame()
+ * @param write_cb output callback
+ * @param arg user argument for write_cb
+ * @return esp_err_t error returned by write_cb
+ */
+esp_err_t pcap_serializer_write_header(pcap_serializer_write_cb_t write_cb, void *arg);
+
+/**
+ * @brief Writes single PCAP record - record header followed by frame.
  * 
+ * @param write_cb output callback
+ * @param arg user argument for write_cb
+ * @param buffer frame buffer that should be written to PCAP
+ * @param size size of frame buffer
+ * @param ts_usec timestamp of captured frame in microseconds
+ * @return esp_err_t error returned by write_cb
  */
-void pcap_serializer_deinit();
+esp_err_t pcap_serializer_write_frame(pcap_serializer_write_cb_t write_cb, void *arg, const uint8_t *buffer, unsigned size, unsigned ts_usec);
 
 /**
- * @brief Returns size of PCAP buffer in bytes
+ * @brief Writes PCAPNG Section Header Block and Interface Description Block.
  * 
- * @return unsigned
+ * Has always to be written before first pcapng_serializer_write_frame()
+ * @param write_cb output callback
+ * @param arg user argument for write_cb
+ * @return esp_err_t error returned by write_cb
  */
-unsigned pcap_serializer_get_size();
+esp_err_t pcapng_serializer_write_header(pcap_serializer_write_cb_t write_cb, void *arg);
 
 /**
- * @brief Return pointer to PCAP buffer
+ * @brief Writes frame as PCAPNG Enhanced Packet Block.
  * 
- * @return uint8_t* 
+ * @param write_cb output callback
+ * @param arg user argument for write_cb
+ * @param buffer frame buffer that should be written to PCAPNG
+ * @param size size of frame buffer
+ * @param ts_usec timestamp of captured frame in microseconds
+ * @return esp_err_t error returned by write_cb
  */
-uint8_t *pcap_serializer_get_buffer();
+esp_err_t pcapng_serializer_write_frame(pcap_serializer_write_cb_t write_cb, void *arg, const uint8_t *buffer, unsigned size, unsigned ts_usec);
 
 #endif
\ No newline at end of file
@@ -4,12 +4,11 @@
  * @date 2021-04-05
  * @copyright Copyright (c) 2021
  * 
- * @brief Implementation of PCAP serializer
+ * @brief Implementation of PCAP and PCAPNG serializer
  */
 #include "pcap_serializer.h"
 
 #include <stdint.h>
-#include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
@@ -34,12 +33,19 @@ static const char *TAG = "pcap_serializer";
  */
 #define LINKTYPE_IEEE802_11 105
 
-static unsigned pcap_size = 0;
-static uint8_t *pcap_buffer = NULL;
+/**
+ * @brief Constants according to reference
+ * 
+ * @see Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html
+ */
+//@{
+#define PCAPNG_BLOCK_TYPE_SHB 0x0A0D0D0A
+#define PCAPNG_BLOCK_TYPE_IDB 0x00000001
+#define PCAPNG_BLOCK_TYPE_EPB 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+//@}
 
-uint8_t *pcap_serializer_init(){
-    // Make sure memory from previous attack is freed
-    free(pcap_buffer);
+esp_err_t pcap_serializer_write_header(pcap_serializer_write_cb_t write_cb, void *arg){
     // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
     pcap_global_header_t pcap_global_header = {
         .magic_number = PCAP_MAGIC_NUMBER,
@@ -50,16 +56,13 @@ uint8_t *pcap_serializer_init(){
         .snaplen = SNAPLEN,
         .network = LINKTYPE_IEEE802_11
     };
-    pcap_buffer = (uint8_t *)malloc(sizeof(pcap_global_header_t));
-    pcap_size = sizeof(pcap_global_header_t);
-    memcpy(pcap_buffer, &pcap_global_header, sizeof(pcap_global_header_t));
-    return pcap_buffer;
+    return write_cb((uint8_t *) &pcap_global_header, sizeof(pcap_global_header_t), arg);
 }
 
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec){
+esp_err_t pcap_serializer_write_frame(pcap_serializer_write_cb_t write_cb, void *arg, const uint8_t *buffer, unsigned size, unsigned ts_usec){
     if(size == 0){
-        ESP_LOGD(TAG, "Frame size is 0. Not appending anything.");
-        return;
+        ESP_LOGD(TAG, "Frame size is 0. Not writing anything.");
+        return ESP_OK;
     }
     // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
     pcap_record_header_t pcap_record_header = {
@@ -75,27 +78,92 @@ void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned
         pcap_record_header.incl_len = SNAPLEN;
     }
 
-    uint8_t *reallocated_pcap_buffer = realloc(pcap_buffer, pcap_size + sizeof(pcap_record_header_t) + size);
-    if(reallocated_pcap_buffer == NULL){
-        ESP_LOGE(TAG, "Error reallocating PCAP buffer! PCAP buffer may not be complete.");
-        return;
+    esp_err_t err = write_cb((uint8_t *) &pcap_record_header, sizeof(pcap_record_header_t), arg);
+    if(err != ESP_OK){
+        return err;
     }
-    memcpy(&reallocated_pcap_buffer[pcap_size], &pcap_record_header, sizeof(pcap_record_header_t));
-    memcpy(&reallocated_pcap_buffer[pcap_size + sizeof(pcap_record_header_t)], buffer, size);
-    pcap_buffer = reallocated_pcap_buffer;
-    pcap_size += sizeof(pcap_record_header_t) + size;
+    return write_cb(buffer, size, arg);
 }
 
-void pcap_serializer_deinit(){
-    free(pcap_buffer);
-    pcap_buffer = NULL;
-    pcap_size = 0;
-}
+esp_err_t pcapng_serializer_write_header(pcap_serializer_write_cb_t write_cb, void *arg){
+    // Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html#section-4.1
+    struct __attribute__((__packed__)) {
+        pcapng_block_header_t header;
+        uint32_t byte_order_magic;
+        uint16_t major_version;
+        uint16_t minor_version;
+        int64_t section_length;
+        uint32_t block_total_length;
+    } section_header_block = {
+        .header = { .block_type = PCAPNG_BLOCK_TYPE_SHB, .block_total_length = sizeof(section_header_block) },
+        .byte_order_magic = PCAPNG_BYTE_ORDER_MAGIC,
+        .major_version = 1,
+        .minor_version = 0,
+        .section_length = -1,   // not specified
+        .block_total_length = sizeof(section_header_block)
+    };
+    esp_err_t err = write_cb((uint8_t *) &section_header_block, sizeof(section_header_block), arg);
+    if(err != ESP_OK){
+        return err;
+    }
 
-unsigned pcap_serializer_get_size(){
-    return pcap_size;
+    // Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html#section-4.2
+    // No options, so default timestamp resolution (microseconds) is used
+    struct __attribute__((__packed__)) {
+        pcapng_block_header_t header;
+        uint16_t link_type;
+        uint16_t reserved;
+        uint32_t snaplen;
+        uint32_t block_total_length;
+    } interface_description_block = {
+        .header = { .block_type = PCAPNG_BLOCK_TYPE_IDB, .block_total_length = sizeof(interface_description_block) },
+        .link_type = LINKTYPE_IEEE802_11,
+        .reserved = 0,
+        .snaplen = SNAPLEN,
+        .block_total_length = sizeof(interface_description_block)
+    };
+    return write_cb((uint8_t *) &interface_description_block, sizeof(interface_description_block), arg);
 }
 
-uint8_t *pcap_serializer_get_buffer(){
-    return pcap_buffer;
+esp_err_t pcapng_serializer_write_frame(pcap_serializer_write_cb_t write_cb, void *arg, const uint8_t *buffer, unsigned size, unsigned ts_usec){
+    if(size == 0){
+        ESP_LOGD(TAG, "Frame size is 0. Not writing anything.");
+        return ESP_OK;
+    }
+    if(size > SNAPLEN){
+        size = SNAPLEN;
+    }
+    // Packet data are padded to 32 bits
+    unsigned padding = (4 - (size % 4)) % 4;
+    uint32_t block_total_length = sizeof(pcapng_block_header_t) + 5 * sizeof(uint32_t) + size + padding + sizeof(uint32_t);
+
+    // Ref: https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html#section-4.3
+    struct __attribute__((__packed__)) {
+        pcapng_block_header_t header;
+        uint32_t interface_id;
+        uint32_t timestamp_high;
+        uint32_t timestamp_low;
+        uint32_t captured_length;
+        uint32_t original_length;
+    } enhanced_packet_block = {
+        .header = { .block_type = PCAPNG_BLOCK_TYPE_EPB, .block_total_length = block_total_length },
+        .interface_id = 0,
+        .timestamp_high = 0,
+        .timestamp_low = ts_usec,
+        .captured_length = size,
+        .original_length = size
+    };
+    const uint8_t padding_bytes[3] = { 0 };
+
+    esp_err_t err = write_cb((uint8_t *) &enhanced_packet_block, sizeof(enhanced_packet_block), arg);
+    if(err == ESP_OK){
+        err = write_cb(buffer, size, arg);
+    }
+    if((err == ESP_OK) && (padding > 0)){
+        err = write_cb(padding_bytes, padding, arg);
+    }
+    if(err == ESP_OK){
+        err = write_cb((uint8_t *) &block_total_length, sizeof(uint32_t), arg);
+    }
+    return err;
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file result_log.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to append-only result log on dedicated data partition
+ * 
+ * Every record is framed by header with its own CRC and CRC of payload. Records are only appended,
+ * when the partition is full, writing continues from its beginning and the oldest sectors are erased.
+ * Compact index of records (offset, length, type, sequence number) is kept in RAM and rebuilt at boot
+ * by walking record headers only.
+ */
+#ifndef RESULT_LOG_H
+#define RESULT_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Partition used for result log
+ * 
+ * @see partitions.csv
+ * @{
+ */
+#define RESULT_LOG_PARTITION_LABEL "reslog"
+#define RESULT_LOG_PARTITION_SUBTYPE 0x40
+//@}
+
+/**
+ * @brief Index entry of single record
+ */
+typedef struct {
+    uint32_t seq;       ///< sequence number, increasing with every appended record
+    uint32_t offset;    ///< offset of payload in the partition
+    uint32_t length;    ///< length of payload
+    uint16_t type;      ///< record type defined by user of the log
+    uint16_t reserved;
+} result_log_entry_t;
+
+/**
+ * @brief Part of record payload, see result_log_append()
+ */
+typedef struct {
+    const void *data;
+    size_t size;
+} result_log_part_t;
+
+/**
+ * @brief Finds result log partition and builds index of stored records. This function should be called only once.
+ * 
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if partition is missing
+ */
+esp_err_t result_log_init();
+
+/**
+ * @brief Appends new record to the log.
+ * 
+ * Payload is gathered from given parts, so callers don't have to concatenate data into one buffer.
+ * If there is not enough erased space, the oldest records are erased.
+ * 
+ * @param type record type
+ * @param parts payload parts
+ * @param part_count number of parts
+ * @param entry optional output parameter for index entry of new record
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t result_log_append(uint16_t type, const result_log_part_t *parts, unsigned part_count, result_log_entry_t *entry);
+
+/**
+ * @brief Returns the newest record of one of given types.
+ * 
+ * @param types array of record types
+ * @param type_count number of types
+ * @param entry output parameter for index entry
+ * @return esp_err_t ESP_OK if found, ESP_ERR_NOT_FOUND otherwise
+ */
+esp_err_t result_log_find_latest(const uint16_t *types, unsigned type_count, result_log_entry_t *entry);
+
+/**
+ * @brief Copies the newest index entries, ordered oldest first.
+ * 
+ * @param entries output array
+ * @param max_entries size of output array
+ * @return unsigned number of copied entries
+ */
+unsigned result_log_get_entries(result_log_entry_t *entries, unsigned max_entries);
+
+/**
+ * @brief Reads part of record payload.
+ * 
+ * @param entry index entry of record
+ * @param offset offset inside payload
+ * @param buffer output buffer
+ * @param size number of bytes to read
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE if reading beyond payload
+ */
+esp_err_t result_log_read(const result_log_entry_t *entry, uint32_t offset, void *buffer, size_t size);
+
+/**
+ * @brief Verifies payload CRC of given record.
+ * 
+ * Payloads are not verified at boot to keep index building fast, so this should be called before record is used.
+ * 
+ * @param entry index entry of record
+ * @return esp_err_t ESP_OK if payload is intact, ESP_ERR_INVALID_CRC otherwise
+ */
+esp_err_t result_log_verify(const result_log_entry_t *entry);
+
+#endif
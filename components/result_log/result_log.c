@@ -0,0 +1,363 @@
+/**
+ * @file result_log.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements append-only result log
+ * 
+ * Layout of the partition is sequence of records:
+ * @code{.unparsed}
+ * | header (24 B) | payload | padding to 4 B | header | payload | ... | erased | older records ... |
+ * @endcode
+ * Writing is sequential. When the record doesn't fit before the end of the partition, writing continues from
+ * the beginning. Sectors are erased right before they are written, which removes the oldest records.
+ */
+#include "result_log.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "sdkconfig.h"
+#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "result_log";
+
+#define RECORD_MAGIC 0x474F4C52
+#define SECTOR_SIZE 4096
+#define ERASED_WORD 0xFFFFFFFF
+/**
+ * @brief Size of stack buffer used for CRC calculation and erase checks
+ */
+#define READ_CHUNK_SIZE 128
+
+/**
+ * @brief Header written in front of every record
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t length;
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t payload_crc;
+    uint32_t header_crc;    ///< CRC of all previous header fields
+} record_header_t;
+
+static const esp_partition_t *partition = NULL;
+static SemaphoreHandle_t log_mutex = NULL;
+/**
+ * @brief Index of records sorted by sequence number, oldest first
+ */
+static result_log_entry_t entries[CONFIG_RESULT_LOG_INDEX_SIZE];
+static unsigned entry_count = 0;
+static uint32_t next_seq = 0;
+/**
+ * @brief Offset where next record will be written
+ */
+static uint32_t head = 0;
+/**
+ * @brief Sector aligned offset. Region between head and erased_until is erased.
+ */
+static uint32_t erased_until = 0;
+
+static uint32_t align_up(uint32_t value, uint32_t alignment){
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+static uint32_t record_total_size(uint32_t length){
+    return align_up(sizeof(record_header_t) + length, 4);
+}
+
+static uint32_t header_crc(const record_header_t *header){
+    return esp_rom_crc32_le(0, (const uint8_t *) header, offsetof(record_header_t, header_crc));
+}
+
+/**
+ * @brief Checks whether header read at offset frames valid record.
+ */
+static bool is_header_valid(const record_header_t *header, uint32_t offset){
+    return (header->magic == RECORD_MAGIC)
+        && (header->header_crc == header_crc(header))
+        && (header->length <= partition->size)
+        && (offset + record_total_size(header->length) <= partition->size);
+}
+
+/**
+ * @brief Adds entry to index sorted by sequence number. If index is full, the oldest entry is dropped.
+ */
+static void index_insert(const result_log_entry_t *entry){
+    if(entry_count == CONFIG_RESULT_LOG_INDEX_SIZE){
+        if(entry->seq < entries[0].seq){
+            return;
+        }
+        memmove(&entries[0], &entries[1], (entry_count - 1) * sizeof(result_log_entry_t));
+        entry_count--;
+    }
+    unsigned position = entry_count;
+    while((position > 0) && (entries[position - 1].seq > entry->seq)){
+        position--;
+    }
+    memmove(&entries[position + 1], &entries[position], (entry_count - position) * sizeof(result_log_entry_t));
+    memcpy(&entries[position], entry, sizeof(result_log_entry_t));
+    entry_count++;
+}
+
+/**
+ * @brief Removes entries of records that overlap given region of the partition.
+ */
+static void index_remove_region(uint32_t start, uint32_t end){
+    unsigned kept = 0;
+    for(unsigned i = 0; i < entry_count; i++){
+        uint32_t record_start = entries[i].offset - sizeof(record_header_t);
+        uint32_t record_end = entries[i].offset + entries[i].length;
+        if((record_start < end) && (record_end > start)){
+            ESP_LOGD(TAG, "Record %u erased", entries[i].seq);
+            continue;
+        }
+        entries[kept++] = entries[i];
+    }
+    entry_count = kept;
+}
+
+static bool is_region_erased(uint32_t start, uint32_t end){
+    uint8_t buffer[READ_CHUNK_SIZE];
+    while(start < end){
+        size_t size = ((end - start) < sizeof(buffer)) ? (end - start) : sizeof(buffer);
+        if(esp_partition_read(partition, start, buffer, size) != ESP_OK){
+            return false;
+        }
+        for(size_t i = 0; i < size; i++){
+            if(buffer[i] != 0xFF){
+                return false;
+            }
+        }
+        start += size;
+    }
+    return true;
+}
+
+/**
+ * @brief Walks record headers over whole partition and builds index.
+ * 
+ * Erased word means rest of the sector is erased, so scanning continues at next sector.
+ * Invalid data (e.g. remainder of partially erased record) are skipped word by word until next valid header.
+ */
+static void build_index(){
+    uint32_t offset = 0;
+    bool found = false;
+    uint32_t newest_seq = 0;
+    uint32_t newest_end = 0;
+    record_header_t header;
+    entry_count = 0;
+    while(offset + sizeof(record_header_t) <= partition->size){
+        if(esp_partition_read(partition, offset, &header, sizeof(record_header_t)) != ESP_OK){
+            break;
+        }
+        if(is_header_valid(&header, offset)){
+            result_log_entry_t entry = {
+                .seq = header.seq,
+                .offset = offset + sizeof(record_header_t),
+                .length = header.length,
+                .type = header.type
+            };
+            index_insert(&entry);
+            if(!found || (header.seq > newest_seq)){
+                newest_seq = header.seq;
+                newest_end = offset + record_total_size(header.length);
+                found = true;
+            }
+            offset += record_total_size(header.length);
+        }
+        else if(header.magic == ERASED_WORD){
+            offset = align_up(offset + 1, SECTOR_SIZE);
+        }
+        else {
+            offset += 4;
+        }
+    }
+
+    head = found ? newest_end : 0;
+    next_seq = found ? newest_seq + 1 : 0;
+    erased_until = align_up(head, SECTOR_SIZE);
+    if(!is_region_erased(head, erased_until)){
+        // interrupted write left data after the newest record
+        ESP_LOGW(TAG, "Unfinished record found, skipping to next sector");
+        head = erased_until;
+    }
+}
+
+esp_err_t result_log_init(){
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t) RESULT_LOG_PARTITION_SUBTYPE, RESULT_LOG_PARTITION_LABEL);
+    if(partition == NULL){
+        ESP_LOGE(TAG, "Result log partition not found. Check partition table.");
+        return ESP_ERR_NOT_FOUND;
+    }
+    log_mutex = xSemaphoreCreateMutex();
+    if(log_mutex == NULL){
+        partition = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    build_index();
+    ESP_LOGI(TAG, "Result log has %u records, next write at 0x%x", entry_count, head);
+    return ESP_OK;
+}
+
+/**
+ * @brief Makes sure region up to given offset is erased. Index entries of erased records are removed.
+ */
+static esp_err_t ensure_erased(uint32_t end){
+    while(erased_until < end){
+        esp_err_t err = esp_partition_erase_range(partition, erased_until, SECTOR_SIZE);
+        if(err != ESP_OK){
+            ESP_LOGE(TAG, "Failed to erase sector at 0x%x: %s", erased_until, esp_err_to_name(err));
+            return err;
+        }
+        index_remove_region(erased_until, erased_until + SECTOR_SIZE);
+        erased_until += SECTOR_SIZE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t result_log_append(uint16_t type, const result_log_part_t *parts, unsigned part_count, result_log_entry_t *entry){
+    if(partition == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    record_header_t header = { .magic = RECORD_MAGIC, .type = type, .reserved = 0, .length = 0, .payload_crc = 0 };
+    for(unsigned i = 0; i < part_count; i++){
+        header.length += parts[i].size;
+        header.payload_crc = esp_rom_crc32_le(header.payload_crc, parts[i].data, parts[i].size);
+    }
+    uint32_t total = record_total_size(header.length);
+    if(total > partition->size / 2){
+        ESP_LOGE(TAG, "Record too large (%u bytes)", header.length);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    esp_err_t err;
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    if(head + total > partition->size){
+        ESP_LOGD(TAG, "End of partition reached, wrapping");
+        head = 0;
+        erased_until = 0;
+    }
+    err = ensure_erased(head + total);
+    if(err != ESP_OK){
+        goto exit;
+    }
+    header.seq = next_seq;
+    header.header_crc = header_crc(&header);
+
+    // payload is written first, so interrupted write never leaves valid header in front of incomplete payload
+    uint32_t offset = head + sizeof(record_header_t);
+    for(unsigned i = 0; i < part_count; i++){
+        if(parts[i].size == 0){
+            continue;
+        }
+        err = esp_partition_write(partition, offset, parts[i].data, parts[i].size);
+        if(err != ESP_OK){
+            goto write_failed;
+        }
+        offset += parts[i].size;
+    }
+    err = esp_partition_write(partition, head, &header, sizeof(record_header_t));
+    if(err != ESP_OK){
+        goto write_failed;
+    }
+
+    result_log_entry_t new_entry = { .seq = header.seq, .offset = head + sizeof(record_header_t), .length = header.length, .type = type };
+    index_insert(&new_entry);
+    if(entry != NULL){
+        memcpy(entry, &new_entry, sizeof(result_log_entry_t));
+    }
+    ESP_LOGD(TAG, "Appended record %u (type %u, %u bytes) at 0x%x", header.seq, type, header.length, head);
+    next_seq++;
+    head += total;
+    goto exit;
+
+write_failed:
+    ESP_LOGE(TAG, "Failed to write record: %s", esp_err_to_name(err));
+    // space may be partially written, continue in next sector
+    head = align_up(head + total, SECTOR_SIZE);
+    if(head > partition->size){
+        head = partition->size;
+    }
+    if(erased_until < head){
+        erased_until = head;
+    }
+exit:
+    xSemaphoreGive(log_mutex);
+    return err;
+}
+
+esp_err_t result_log_find_latest(const uint16_t *types, unsigned type_count, result_log_entry_t *entry){
+    if(partition == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    for(int i = entry_count - 1; (i >= 0) && (err != ESP_OK); i--){
+        for(unsigned t = 0; t < type_count; t++){
+            if(entries[i].type == types[t]){
+                memcpy(entry, &entries[i], sizeof(result_log_entry_t));
+                err = ESP_OK;
+                break;
+            }
+        }
+    }
+    xSemaphoreGive(log_mutex);
+    return err;
+}
+
+unsigned result_log_get_entries(result_log_entry_t *out_entries, unsigned max_entries){
+    if(partition == NULL){
+        return 0;
+    }
+    xSemaphoreTake(log_mutex, portMAX_DELAY);
+    unsigned count = (entry_count < max_entries) ? entry_count : max_entries;
+    // newest entries are the most relevant ones
+    memcpy(out_entries, &entries[entry_count - count], count * sizeof(result_log_entry_t));
+    xSemaphoreGive(log_mutex);
+    return count;
+}
+
+esp_err_t result_log_read(const result_log_entry_t *entry, uint32_t offset, void *buffer, size_t size){
+    if(partition == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    if((offset > entry->length) || (size > entry->length - offset)){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return esp_partition_read(partition, entry->offset + offset, buffer, size);
+}
+
+esp_err_t result_log_verify(const result_log_entry_t *entry){
+    uint8_t buffer[READ_CHUNK_SIZE];
+    record_header_t header;
+    esp_err_t err = result_log_read(entry, 0, buffer, 0);
+    if(err == ESP_OK){
+        err = esp_partition_read(partition, entry->offset - sizeof(record_header_t), &header, sizeof(record_header_t));
+    }
+    if(err != ESP_OK){
+        return err;
+    }
+    if(!is_header_valid(&header, entry->offset - sizeof(record_header_t)) || (header.seq != entry->seq)){
+        return ESP_ERR_INVALID_CRC;
+    }
+    uint32_t crc = 0;
+    for(uint32_t offset = 0; offset < entry->length; offset += sizeof(buffer)){
+        size_t size = ((entry->length - offset) < sizeof(buffer)) ? (entry->length - offset) : sizeof(buffer);
+        err = result_log_read(entry, offset, buffer, size);
+        if(err != ESP_OK){
+            return err;
+        }
+        crc = esp_rom_crc32_le(crc, buffer, size);
+    }
+    return (crc == header.payload_crc) ? ESP_OK : ESP_ERR_INVALID_CRC;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file run_arena.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to per-run memory arena
+ * 
+ * Arena is a single block of memory reserved once at boot. Allocations are taken from it sequentially
+ * and are never freed one by one, the whole arena is reset in O(1) when attack run ends. Heap usage is therefore
+ * the same regardless of how many runs preceded.
+ */
+#ifndef RUN_ARENA_H
+#define RUN_ARENA_H
+
+#include <stddef.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Arena usage statistics
+ */
+typedef struct {
+    size_t size;        ///< reserved size
+    size_t used;        ///< currently allocated bytes
+    size_t high_water;  ///< maximal allocated bytes since boot
+    unsigned failures;  ///< number of allocations that didn't fit since boot
+} run_arena_stats_t;
+
+/**
+ * @brief Reserves arena of CONFIG_RUN_ARENA_SIZE bytes. This function should be called only once.
+ * 
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if arena couldn't be reserved
+ */
+esp_err_t run_arena_init();
+
+/**
+ * @brief Allocates block from arena. Returned memory is aligned to 4 bytes.
+ * 
+ * @param size size of block
+ * @return void* allocated block or \c NULL if arena is exhausted
+ */
+void *run_arena_alloc(size_t size);
+
+/**
+ * @brief Resizes the most recently allocated block in place.
+ * 
+ * Used by owners of continuously growing buffers. If the block is not the last allocation, it can't be resized.
+ * 
+ * @param block block returned by run_arena_alloc(), \c NULL allocates new block
+ * @param size new size of block
+ * @return void* resized block (same as block) or \c NULL if it couldn't be resized
+ */
+void *run_arena_extend(void *block, size_t size);
+
+/**
+ * @brief Releases all allocations at once.
+ * 
+ * @attention Caller has to make sure no allocated block is referenced anymore.
+ */
+void run_arena_reset();
+
+/**
+ * @brief Copies arena usage statistics.
+ * 
+ * @param stats output parameter
+ */
+void run_arena_get_stats(run_arena_stats_t *stats);
+
+#endif
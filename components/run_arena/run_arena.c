@@ -0,0 +1,121 @@
+/**
+ * @file run_arena.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements per-run memory arena
+ */
+#include "run_arena.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "run_arena";
+
+static SemaphoreHandle_t arena_mutex = NULL;
+static uint8_t *arena = NULL;
+static size_t used = 0;
+/**
+ * @brief Offset of the most recent allocation, only this one can be extended
+ */
+static size_t last_offset = 0;
+static size_t high_water = 0;
+static unsigned failures = 0;
+
+static size_t align4(size_t size){
+    return (size + 3) & ~(size_t) 3;
+}
+
+esp_err_t run_arena_init(){
+    arena_mutex = xSemaphoreCreateMutex();
+    arena = (uint8_t *) malloc(CONFIG_RUN_ARENA_SIZE);
+    if((arena_mutex == NULL) || (arena == NULL)){
+        ESP_LOGE(TAG, "Failed to reserve %d bytes for run arena", CONFIG_RUN_ARENA_SIZE);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Reserved %d bytes for run arena", CONFIG_RUN_ARENA_SIZE);
+    return ESP_OK;
+}
+
+/**
+ * @brief Sets new end of used space if it fits. Expects arena_mutex to be taken.
+ */
+static bool set_used(size_t new_used){
+    if(new_used > CONFIG_RUN_ARENA_SIZE){
+        failures++;
+        return false;
+    }
+    used = new_used;
+    if(used > high_water){
+        high_water = used;
+    }
+    return true;
+}
+
+void *run_arena_alloc(size_t size){
+    if(arena == NULL){
+        return NULL;
+    }
+    void *block = NULL;
+    xSemaphoreTake(arena_mutex, portMAX_DELAY);
+    size_t offset = used;
+    if(set_used(offset + align4(size))){
+        last_offset = offset;
+        block = &arena[offset];
+    }
+    xSemaphoreGive(arena_mutex);
+    if(block == NULL){
+        ESP_LOGW(TAG, "Run arena exhausted, %u bytes not allocated", size);
+    }
+    return block;
+}
+
+void *run_arena_extend(void *block, size_t size){
+    if(block == NULL){
+        return run_arena_alloc(size);
+    }
+    if(arena == NULL){
+        return NULL;
+    }
+    void *extended = NULL;
+    xSemaphoreTake(arena_mutex, portMAX_DELAY);
+    if((block == &arena[last_offset]) && set_used(last_offset + align4(size))){
+        extended = block;
+    }
+    xSemaphoreGive(arena_mutex);
+    return extended;
+}
+
+void run_arena_reset(){
+    if(arena == NULL){
+        return;
+    }
+    xSemaphoreTake(arena_mutex, portMAX_DELAY);
+    used = 0;
+    last_offset = 0;
+    xSemaphoreGive(arena_mutex);
+}
+
+void run_arena_get_stats(run_arena_stats_t *stats){
+    stats->size = (arena != NULL) ? CONFIG_RUN_ARENA_SIZE : 0;
+    if(arena_mutex == NULL){
+        stats->used = 0;
+        stats->high_water = 0;
+        stats->failures = 0;
+        return;
+    }
+    xSemaphoreTake(arena_mutex, portMAX_DELAY);
+    stats->used = used;
+    stats->high_water = high_water;
+    stats->failures = failures;
+    xSemaphoreGive(arena_mutex);
+}
@@ -0,0 +1,282 @@
+/**
+ * @file event_stream.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements Server-Sent Events stream of attack status
+ *
+ * esp_http_server has no support for long-lived responses, so response headers are written directly to the socket
+ * and the socket stays open after request handler returns. All writes to client sockets happen in httpd task
+ * (request handler or work queued by httpd_queue_work()), so events never interleave with other responses.
+ */
+#include "event_stream.h"
+
+#include <stdio.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+
+#include "attack.h"
+#include "capture_store.h"
+
+static const char *TAG = "event_stream";
+
+/**
+ * @brief Maximum length of single formatted event
+ */
+#define EVENT_MAX_LENGTH 160
+/**
+ * @brief Number of events that can wait for httpd task
+ */
+#define EVENT_QUEUE_LENGTH 8
+/**
+ * @brief Comment line is sent after this many progress ticks without any event, so closed clients are detected
+ */
+#define KEEPALIVE_TICKS 15
+
+typedef struct {
+    char text[EVENT_MAX_LENGTH];
+} event_message_t;
+
+/**
+ * @brief Progress counters of running attack, event is pushed only when they change
+ */
+typedef struct {
+    unsigned frames;
+    uint32_t content_size;
+    uint32_t phase_us[ATTACK_PHASE_COUNT];
+} event_progress_t;
+
+static const char *stream_headers = "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 3000\n\n";
+
+static httpd_handle_t server = NULL;
+static SemaphoreHandle_t clients_mutex = NULL;
+static int clients[CONFIG_WEBSERVER_EVENTS_MAX_CLIENTS];
+static unsigned client_count = 0;
+static QueueHandle_t message_queue = NULL;
+static esp_timer_handle_t progress_timer_handle;
+/**
+ * @brief State of progress events. Owned by httpd task.
+ * @{
+ */
+static event_progress_t last_progress;
+static unsigned idle_ticks = 0;
+//@}
+
+static void format_status(event_message_t *message, const attack_status_t *status){
+    snprintf(message->text, EVENT_MAX_LENGTH, "event: status\ndata: {\"state\":%u,\"type\":%u}\n\n",
+        status->state, status->type);
+}
+
+static void format_result(event_message_t *message, const attack_status_t *status){
+    snprintf(message->text, EVENT_MAX_LENGTH, "event: result\ndata: {\"state\":%u,\"type\":%u,\"size\":%u}\n\n",
+        status->state, status->type, status->content_size);
+}
+
+static void format_progress(event_message_t *message, const event_progress_t *progress){
+    int length = snprintf(message->text, EVENT_MAX_LENGTH, "event: progress\ndata: {\"frames\":%u,\"size\":%u,\"phases\":[",
+        progress->frames, progress->content_size);
+    for(unsigned i = 0; i < ATTACK_PHASE_COUNT; i++){
+        length += snprintf(&message->text[length], EVENT_MAX_LENGTH - length, "%s%u", (i > 0) ? "," : "", progress->phase_us[i]);
+    }
+    snprintf(&message->text[length], EVENT_MAX_LENGTH - length, "]}\n\n");
+}
+
+/**
+ * @brief Whether run in given state finished, so its result can be fetched from \c /status
+ */
+static bool has_result(const attack_status_t *status){
+    return (status->state == FINISHED) || (status->state == TIMEOUT);
+}
+
+/**
+ * @brief Removes client from the list and stops progress timer when the last client is gone.
+ * @return true if client was found
+ */
+static bool remove_client(int sockfd){
+    bool found = false;
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < client_count; i++){
+        if(clients[i] == sockfd){
+            clients[i] = clients[--client_count];
+            found = true;
+            break;
+        }
+    }
+    if(found && (client_count == 0)){
+        esp_timer_stop(progress_timer_handle);
+    }
+    xSemaphoreGive(clients_mutex);
+    return found;
+}
+
+/**
+ * @brief Sends text to all clients. Clients that fail are closed. Runs in httpd task.
+ */
+static void broadcast(const char *text){
+    int sockets[CONFIG_WEBSERVER_EVENTS_MAX_CLIENTS];
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    unsigned count = client_count;
+    memcpy(sockets, clients, count * sizeof(int));
+    xSemaphoreGive(clients_mutex);
+
+    size_t length = strlen(text);
+    for(unsigned i = 0; i < count; i++){
+        if(httpd_socket_send(server, sockets[i], text, length, 0) != (int) length){
+            ESP_LOGD(TAG, "Client %d gone", sockets[i]);
+            remove_client(sockets[i]);
+            httpd_sess_trigger_close(server, sockets[i]);
+        }
+    }
+    idle_ticks = 0;
+}
+
+/**
+ * @brief Sends all queued events. Work function queued by post_message(), runs in httpd task.
+ * @param arg not used
+ */
+static void send_queued_work(void *arg){
+    event_message_t message;
+    while(xQueueReceive(message_queue, &message, 0) == pdTRUE){
+        broadcast(message.text);
+    }
+}
+
+/**
+ * @brief Queues event for httpd task. Can be called from any task.
+ */
+static void post_message(const event_message_t *message){
+    if(xQueueSend(message_queue, message, 0) != pdTRUE){
+        ESP_LOGW(TAG, "Event queue full, event dropped");
+        return;
+    }
+    if(httpd_queue_work(server, send_queued_work, NULL) != ESP_OK){
+        ESP_LOGW(TAG, "Failed to queue event work");
+    }
+}
+
+/**
+ * @brief Pushes progress of running attack if it changed since last push, otherwise keeps connections alive. Runs in httpd task.
+ * @param arg not used
+ */
+static void progress_work(void *arg){
+    attack_status_t status;
+    attack_get_status(&status);
+    event_progress_t progress = { .frames = 0 };
+    if(status.state == RUNNING){
+        progress.frames = capture_store_get_frame_count();
+        progress.content_size = status.content_size;
+        memcpy(progress.phase_us, status.phase_us, sizeof(progress.phase_us));
+    }
+    if(memcmp(&progress, &last_progress, sizeof(event_progress_t)) != 0){
+        memcpy(&last_progress, &progress, sizeof(event_progress_t));
+        if(status.state == RUNNING){
+            event_message_t message;
+            format_progress(&message, &progress);
+            broadcast(message.text);
+            return;
+        }
+    }
+    if(++idle_ticks >= KEEPALIVE_TICKS){
+        broadcast(":\n\n");
+    }
+}
+
+/**
+ * @brief Callback for progress timer. Runs in esp_timer task, so it only queues progress_work().
+ * @param arg not used
+ */
+static void progress_timer_callback(void *arg){
+    httpd_queue_work(server, progress_work, NULL);
+}
+
+/**
+ * @brief Callback for ATTACK_EVENT_STATUS_CHANGED event.
+ *
+ * Pushes new state to all clients. When run finished, result notice is pushed once.
+ * @param args not used
+ * @param event_base expects ATTACK_EVENTS
+ * @param event_id expects ATTACK_EVENT_STATUS_CHANGED
+ * @param event_data expects attack_status_t header
+ */
+static void attack_status_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    attack_status_t status;
+    memcpy(&status, event_data, ATTACK_STATUS_HEADER_SIZE);
+    event_message_t message;
+    format_status(&message, &status);
+    post_message(&message);
+    if(has_result(&status)){
+        format_result(&message, &status);
+        post_message(&message);
+    }
+}
+
+esp_err_t event_stream_init(httpd_handle_t server_handle){
+    server = server_handle;
+    clients_mutex = xSemaphoreCreateMutex();
+    message_queue = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(event_message_t));
+    if((clients_mutex == NULL) || (message_queue == NULL)){
+        ESP_LOGE(TAG, "Failed to create event stream resources");
+        return ESP_ERR_NO_MEM;
+    }
+    const esp_timer_create_args_t progress_timer_args = {
+        .callback = &progress_timer_callback
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&progress_timer_args, &progress_timer_handle));
+    ESP_ERROR_CHECK(esp_event_handler_register(ATTACK_EVENTS, ATTACK_EVENT_STATUS_CHANGED, &attack_status_handler, NULL));
+    return ESP_OK;
+}
+
+esp_err_t event_stream_add_client(httpd_req_t *req){
+    int sockfd = httpd_req_to_sockfd(req);
+    attack_status_t status;
+    attack_get_status(&status);
+
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    bool full = (client_count >= CONFIG_WEBSERVER_EVENTS_MAX_CLIENTS);
+    xSemaphoreGive(clients_mutex);
+    if(full){
+        ESP_LOGW(TAG, "Maximum number of event stream clients reached");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // initial state, the client fetches result content once if run finished
+    event_message_t status_message, result_message;
+    format_status(&status_message, &status);
+    format_result(&result_message, &status);
+    if((httpd_socket_send(req->handle, sockfd, stream_headers, strlen(stream_headers), 0) < 0) ||
+        (httpd_socket_send(req->handle, sockfd, status_message.text, strlen(status_message.text), 0) < 0) ||
+        (has_result(&status) && (httpd_socket_send(req->handle, sockfd, result_message.text, strlen(result_message.text), 0) < 0))){
+        ESP_LOGW(TAG, "Failed to start event stream");
+        return ESP_FAIL;
+    }
+
+    // only httpd task adds clients, so the slot is still free
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    clients[client_count++] = sockfd;
+    if(client_count == 1){
+        esp_timer_start_periodic(progress_timer_handle, CONFIG_WEBSERVER_EVENTS_PROGRESS_INTERVAL_MS * 1000);
+    }
+    xSemaphoreGive(clients_mutex);
+    ESP_LOGD(TAG, "Event stream client %d added", sockfd);
+    return ESP_OK;
+}
+
+void event_stream_remove_client(int sockfd){
+    if((clients_mutex != NULL) && remove_client(sockfd)){
+        ESP_LOGD(TAG, "Event stream client %d removed", sockfd);
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file event_stream.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Server-Sent Events stream of attack status for \c /events endpoint
+ *
+ * Clients keep single long-lived connection open. Attack state transitions are pushed as they happen,
+ * progress counters of running attack are pushed only when they change and result notice is pushed once per finished run.
+ *
+ * Events (data are JSON objects):
+ * - \c status - \c state and \c type, sent on every state transition and when client connects
+ * - \c progress - \c frames, \c size of status content and \c phases timing of running attack in microseconds
+ * - \c result - \c state, \c type and \c size, sent once when run finishes; content is fetched from \c /status
+ */
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/**
+ * @brief Initialises event stream for given server. Registers ATTACK_EVENTS handler.
+ *
+ * @param server running webserver
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM
+ */
+esp_err_t event_stream_init(httpd_handle_t server);
+
+/**
+ * @brief Turns request into event stream client.
+ *
+ * Response headers and current status are sent directly to the socket and the socket is kept open after the handler returns.
+ *
+ * @param req \c /events request
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if maximum number of clients is reached, ESP_FAIL if socket send failed
+ */
+esp_err_t event_stream_add_client(httpd_req_t *req);
+
+/**
+ * @brief Forgets closed socket. Called from session close callback of the server.
+ *
+ * @param sockfd closed socket
+ */
+void event_stream_remove_client(int sockfd);
+
+#endif
@@ -1,11 +1,22 @@
 /**
  * @file file_manager.c
  * @brief File manager implementation for SPIFFS-based result persistence
+ *
+ * Results index keeps entries in save order, newest at the end. Whole index is rewritten to index file
+ * after every change. When the index is full, its oldest entry is appended to spill file, so number of saved
+ * files is limited only by partition space. Spill file keeps entries oldest first, entry of deleted file is
+ * cleared in place and dropped when spill file is compacted at boot or when too many entries are cleared.
+ * Spilled entries are counted per file type in index header and positions of cleared entries are tracked,
+ * so counts and pages of listing don't need the spill file to be read from its start. Index and spill files
+ * are hidden from listings by their leading dot.
  */
 
 #include "file_manager.h"
 
+#include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <sys/stat.h>
 #include <dirent.h>
@@ -13,16 +24,77 @@
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
 #include "esp_spiffs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "gzip_stream.h"
 
 static const char *TAG = "file_manager";
 
 #define RESULTS_BASE_PATH "/results"
 #define SPIFFS_PARTITION_LABEL "results"
+#define INDEX_PATH RESULTS_BASE_PATH "/.index"
+#define INDEX_MAGIC 0x32444952  // "RID2"
+#define SPILL_PATH RESULTS_BASE_PATH "/.spill"
+#define SPILL_TMP_PATH RESULTS_BASE_PATH "/.spill.tmp"
 
 /**
- * @brief Initialize SPIFFS mount point for results storage
+ * @brief Number of spilled entries read from spill file at once
  */
-esp_err_t file_manager_init(void) {
+#define SPILL_BATCH 4
+
+/**
+ * @brief Number of cleared spilled entries tracked before spill file is compacted
+ */
+#define SPILL_MAX_CLEARED 16
+
+/**
+ * @brief Number of file_manager_type_t values
+ */
+#define FILE_TYPE_COUNT (FILE_MANAGER_TYPE_22000 + 1)
+
+/**
+ * @brief Longest extension passed to file_manager_writer_open() without dot (pcapng, hccapx)
+ */
+#define MAX_EXTENSION_LEN 6
+
+// SPIFFS object name is path inside partition, so it includes leading '/' and terminating null byte
+_Static_assert(sizeof("/YYMMDD_HHMMSS_SSSS.") - 1 + MAX_EXTENSION_LEN + sizeof(FILE_MANAGER_GZIP_SUFFIX) <= CONFIG_SPIFFS_OBJ_NAME_LEN,
+    "Generated result file name doesn't fit into CONFIG_SPIFFS_OBJ_NAME_LEN");
+
+/**
+ * @brief Header of index file, followed by count entries
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t entry_size;    ///< sizeof(file_info_t), layout change invalidates the file
+    uint16_t count;
+    uint32_t next_sequence; ///< sequence of next written file
+    uint32_t spill_counts[FILE_TYPE_COUNT]; ///< spilled entries of existing files per file type
+} index_header_t;
+
+static file_info_t index_entries[CONFIG_RESULTS_INDEX_SIZE];
+static unsigned index_count = 0;
+static uint32_t next_sequence = 1;
+static unsigned spill_count = 0;   ///< entries in spill file, including cleared ones
+static uint32_t spill_type_counts[FILE_TYPE_COUNT];    ///< spilled entries of existing files per file type
+/**
+ * @brief Positions of spilled entries cleared since last compaction, ascending
+ * @{
+ */
+static uint32_t spill_cleared[SPILL_MAX_CLEARED];
+static unsigned spill_cleared_count = 0;
+static bool spill_cleared_untracked = false;    ///< spill file may hold cleared entries missing in spill_cleared
+//@}
+static unsigned spill_generation = 0;   ///< changed whenever spill file is replaced, so open listings stop
+/**
+ * @brief Guards results index, it is changed by attack task saving results and read by webserver. NULL until index is loaded.
+ */
+static SemaphoreHandle_t index_mutex = NULL;
+
+/**
+ * @brief Mount SPIFFS partition for results storage
+ */
+static esp_err_t mount_results_partition(void) {
     ESP_LOGI(TAG, "Initializing SPIFFS for results storage");
 
     // Check if SPIFFS already mounted
@@ -61,146 +133,1013 @@ esp_err_t file_manager_init(void) {
 }
 
 /**
- * @brief Generate timestamped filename
+ * @brief Map extension without dot to result file type
+ * @param ext_len length of extension, ext doesn't have to be terminated
  */
-static void generate_filename(const char *extension, char *filename, size_t max_len) {
-    time_t now = time(NULL);
-    struct tm *timeinfo = localtime(&now);
-    snprintf(filename, max_len, "%s/capture_%04d%02d%02d_%02d%02d%02d.%s",
-             RESULTS_BASE_PATH,
-             timeinfo->tm_year + 1900,
-             timeinfo->tm_mon + 1,
-             timeinfo->tm_mday,
-             timeinfo->tm_hour,
-             timeinfo->tm_min,
-             timeinfo->tm_sec,
-             extension);
+static uint8_t type_from_extension(const char *ext, size_t ext_len) {
+    static const struct {
+        const char *extension;
+        file_manager_type_t type;
+    } types[] = {
+        { "pcap", FILE_MANAGER_TYPE_PCAP },
+        { "pcapng", FILE_MANAGER_TYPE_PCAPNG },
+        { "hccapx", FILE_MANAGER_TYPE_HCCAPX },
+        { "22000", FILE_MANAGER_TYPE_22000 }
+    };
+    for (unsigned i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        if ((strlen(types[i].extension) == ext_len) && (strncmp(ext, types[i].extension, ext_len) == 0)) {
+            return types[i].type;
+        }
+    }
+    return FILE_MANAGER_TYPE_OTHER;
 }
 
 /**
- * @brief Save PCAP data to SPIFFS with timestamp
+ * @brief Derive result file type from extension of its name
  */
-esp_err_t file_manager_save_pcap(const uint8_t *buffer, uint32_t size) {
-    if (buffer == NULL || size == 0) {
-        ESP_LOGE(TAG, "Invalid buffer or size for PCAP save");
-        return ESP_ERR_INVALID_ARG;
+static uint8_t file_type_from_name(const char *filename) {
+    const char *dot = strchr(filename, '.');
+    if (dot == NULL) {
+        return FILE_MANAGER_TYPE_OTHER;
     }
+    return type_from_extension(dot + 1, strcspn(dot + 1, "."));
+}
 
-    char filename[128];
-    generate_filename("pcap", filename, sizeof(filename));
+/**
+ * @brief Check whether index entry matches filter
+ */
+static bool filter_match(const file_manager_filter_t *filter, const file_info_t *info) {
+    if (info->filename[0] == '\0') {
+        return false; // cleared spill entry of deleted file
+    }
+    if (filter == NULL) {
+        return true;
+    }
+    if (info->timestamp < filter->since) {
+        return false;
+    }
+    if (filter->ext[0] != '\0') {
+        const char *dot = strchr(info->filename, '.');
+        size_t ext_len = strlen(filter->ext);
+        if ((dot == NULL) || (strncmp(dot + 1, filter->ext, ext_len) != 0) || ((dot[1 + ext_len] != '\0') && (dot[1 + ext_len] != '.'))) {
+            return false;
+        }
+    }
+    if ((filter->ssid_len != 0) && ((filter->ssid_len != info->ssid_len) || (memcmp(filter->ssid, info->ssid, info->ssid_len) != 0))) {
+        return false;
+    }
+    if (filter->match_bssid && (memcmp(filter->bssid, info->bssid, sizeof(info->bssid)) != 0)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check whether filter matches all files
+ */
+static bool filter_is_empty(const file_manager_filter_t *filter) {
+    return (filter == NULL) ||
+        ((filter->ext[0] == '\0') && (filter->since == 0) && (filter->ssid_len == 0) && !filter->match_bssid);
+}
+
+/**
+ * @brief Find index position of file. Expects index_mutex to be taken.
+ * @return position in index_entries, -1 if file isn't indexed
+ */
+static int index_find(const char *filename) {
+    for (unsigned i = 0; i < index_count; i++) {
+        if (strcmp(index_entries[i].filename, filename) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
 
-    FILE *file = fopen(filename, "wb");
+/**
+ * @brief Remove entry at given position keeping order of others. Expects index_mutex to be taken.
+ */
+static void index_remove_at(unsigned position) {
+    memmove(&index_entries[position], &index_entries[position + 1], (index_count - position - 1) * sizeof(file_info_t));
+    index_count--;
+}
+
+/**
+ * @brief Rewrite index file with current index. Expects index_mutex to be taken.
+ *
+ * Index file that fails to write is detected by its size at next boot and rebuilt from directory.
+ */
+static void index_save(void) {
+    FILE *file = fopen(INDEX_PATH, "wb");
     if (file == NULL) {
-        ESP_LOGE(TAG, "Failed to open file for writing: %s", filename);
-        return ESP_FAIL;
+        ESP_LOGE(TAG, "Failed to open results index for writing");
+        return;
     }
+    index_header_t header = { .magic = INDEX_MAGIC, .entry_size = sizeof(file_info_t), .count = index_count, .next_sequence = next_sequence };
+    memcpy(header.spill_counts, spill_type_counts, sizeof(header.spill_counts));
+    if ((fwrite(&header, sizeof(header), 1, file) != 1) ||
+        (fwrite(index_entries, sizeof(file_info_t), index_count, file) != index_count)) {
+        ESP_LOGE(TAG, "Failed to write results index");
+    }
+    fclose(file);
+}
 
-    size_t written = fwrite(buffer, 1, size, file);
+/**
+ * @brief Read count spilled entries starting at position from opened spill file
+ * @return number of entries read
+ */
+static unsigned spill_read(FILE *file, unsigned position, file_info_t *entries, unsigned count) {
+    if (fseek(file, position * sizeof(file_info_t), SEEK_SET) != 0) {
+        return 0;
+    }
+    return fread(entries, sizeof(file_info_t), count, file);
+}
+
+/**
+ * @brief Per-type counter of spilled entry
+ */
+static uint32_t *spill_type_counter(const file_info_t *info) {
+    return &spill_type_counts[(info->type < FILE_TYPE_COUNT) ? info->type : FILE_MANAGER_TYPE_OTHER];
+}
+
+/**
+ * @brief Append entry to spill file. Expects index_mutex to be taken.
+ * @return true if entry was written
+ */
+static bool spill_append(const file_info_t *info) {
+    FILE *file = fopen(SPILL_PATH, "ab");
+    if (file == NULL) {
+        return false;
+    }
+    bool written = (fwrite(info, sizeof(file_info_t), 1, file) == 1);
+    if (fclose(file) != 0) {
+        written = false;
+    }
+    if (written) {
+        spill_count++;
+        (*spill_type_counter(info))++;
+    }
+    return written;
+}
+
+/**
+ * @brief Find spilled entry of file. Expects index_mutex to be taken.
+ * @param info copy of found entry, may be NULL
+ * @return position in spill file, -1 if file isn't spilled
+ */
+static int spill_find(const char *filename, file_info_t *info) {
+    if (spill_count == 0) {
+        return -1;
+    }
+    FILE *file = fopen(SPILL_PATH, "rb");
+    if (file == NULL) {
+        ESP_LOGE(TAG, "Failed to open spill file");
+        return -1;
+    }
+    file_info_t entries[SPILL_BATCH];
+    int found = -1;
+    for (unsigned position = 0; (found < 0) && (position < spill_count); position += SPILL_BATCH) {
+        unsigned count = spill_read(file, position, entries, (spill_count - position < SPILL_BATCH) ? spill_count - position : SPILL_BATCH);
+        if (count == 0) {
+            break;
+        }
+        for (unsigned i = 0; i < count; i++) {
+            if (strcmp(entries[i].filename, filename) == 0) {
+                found = position + i;
+                if (info != NULL) {
+                    memcpy(info, &entries[i], sizeof(file_info_t));
+                }
+                break;
+            }
+        }
+    }
     fclose(file);
+    return found;
+}
 
-    if (written != size) {
-        ESP_LOGE(TAG, "Failed to write complete PCAP file. Written: %zu, Expected: %u", written, size);
-        remove(filename);
-        return ESP_FAIL;
+static bool spill_compact(const uint32_t *keep);
+
+/**
+ * @brief Clear spilled entry of deleted file in place and remember its position. Expects index_mutex to be taken.
+ *
+ * Spill file is compacted when SPILL_MAX_CLEARED positions are remembered.
+ * @param info spilled entry
+ */
+static void spill_clear(unsigned position, const file_info_t *info) {
+    FILE *file = fopen(SPILL_PATH, "r+b");
+    bool cleared = (file != NULL) &&
+        (fseek(file, position * sizeof(file_info_t) + offsetof(file_info_t, filename), SEEK_SET) == 0) &&
+        (fputc('\0', file) != EOF);
+    if ((file != NULL) && (fclose(file) != 0)) {
+        cleared = false;
+    }
+    if (!cleared) {
+        ESP_LOGE(TAG, "Failed to clear spilled entry %u", position);
+        return;
+    }
+    (*spill_type_counter(info))--;
+    if (spill_cleared_count < SPILL_MAX_CLEARED) {
+        unsigned i = spill_cleared_count++;
+        for (; (i > 0) && (spill_cleared[i - 1] > position); i--) {
+            spill_cleared[i] = spill_cleared[i - 1];
+        }
+        spill_cleared[i] = position;
+    } else {
+        spill_compact(NULL);
     }
+}
 
-    ESP_LOGI(TAG, "Successfully saved PCAP file: %s (%u bytes)", filename, size);
-    return ESP_OK;
+/**
+ * @brief Remove spill file
+ */
+static void spill_reset(void) {
+    remove(SPILL_PATH);
+    spill_count = 0;
+    memset(spill_type_counts, 0, sizeof(spill_type_counts));
+    spill_cleared_count = 0;
+    spill_cleared_untracked = false;
+    spill_generation++;
 }
 
 /**
- * @brief Save HCCAPX data to SPIFFS with timestamp
+ * @brief Rewrite spill file without cleared entries. Expects index_mutex to be taken.
+ *
+ * Entries are copied to temporary file that replaces spill file, interrupted compaction is finished by spill_load().
+ * Per-type counts are recounted from kept entries.
+ * @param keep bitmap of entries to keep, NULL to keep all entries that aren't cleared
+ * @return true if spill file was replaced
  */
-esp_err_t file_manager_save_hccapx(const uint8_t *buffer, uint32_t size, const uint8_t *ssid, uint32_t ssid_len) {
-    if (buffer == NULL || size == 0) {
-        ESP_LOGE(TAG, "Invalid buffer or size for HCCAPX save");
-        return ESP_ERR_INVALID_ARG;
+static bool spill_compact(const uint32_t *keep) {
+    FILE *src = fopen(SPILL_PATH, "rb");
+    FILE *dst = fopen(SPILL_TMP_PATH, "wb");
+    bool ok = (src != NULL) && (dst != NULL);
+    unsigned kept = 0;
+    uint32_t counts[FILE_TYPE_COUNT] = { 0 };
+    file_info_t entries[SPILL_BATCH];
+    for (unsigned position = 0; ok && (position < spill_count); position += SPILL_BATCH) {
+        unsigned count = (spill_count - position < SPILL_BATCH) ? spill_count - position : SPILL_BATCH;
+        ok = (spill_read(src, position, entries, count) == count);
+        for (unsigned i = 0; ok && (i < count); i++) {
+            unsigned entry = position + i;
+            if ((entries[i].filename[0] != '\0') && ((keep == NULL) || (keep[entry / 32] & (1u << (entry % 32))))) {
+                ok = (fwrite(&entries[i], sizeof(file_info_t), 1, dst) == 1);
+                counts[(entries[i].type < FILE_TYPE_COUNT) ? entries[i].type : FILE_MANAGER_TYPE_OTHER]++;
+                kept++;
+            }
+        }
     }
+    if (src != NULL) {
+        fclose(src);
+    }
+    if ((dst != NULL) && (fclose(dst) != 0)) {
+        ok = false;
+    }
+    if (!ok) {
+        ESP_LOGE(TAG, "Failed to compact spill file");
+        remove(SPILL_TMP_PATH);
+        // cleared entries stay in spill file without being tracked
+        spill_cleared_untracked = true;
+        return false;
+    }
+    // SPIFFS doesn't rename over existing file
+    remove(SPILL_PATH);
+    spill_generation++;
+    if (kept == 0) {
+        remove(SPILL_TMP_PATH);
+    } else if (rename(SPILL_TMP_PATH, SPILL_PATH) != 0) {
+        ESP_LOGE(TAG, "Failed to replace spill file, spilled files are indexed again at next boot");
+        kept = 0;
+        memset(counts, 0, sizeof(counts));
+    }
+    ESP_LOGI(TAG, "Spill file compacted, %u of %u entries kept", kept, spill_count);
+    spill_count = kept;
+    memcpy(spill_type_counts, counts, sizeof(spill_type_counts));
+    spill_cleared_count = 0;
+    spill_cleared_untracked = false;
+    return true;
+}
 
-    char filename[128];
-    generate_filename("hccapx", filename, sizeof(filename));
+/**
+ * @brief Get number of spilled entries from spill file size, finishing interrupted compaction
+ */
+static void spill_load(void) {
+    struct stat st;
+    if ((stat(SPILL_PATH, &st) != 0) && (rename(SPILL_TMP_PATH, SPILL_PATH) == 0)) {
+        ESP_LOGW(TAG, "Finished interrupted spill file compaction");
+    }
+    remove(SPILL_TMP_PATH);
+    spill_count = 0;
+    if (stat(SPILL_PATH, &st) != 0) {
+        return;
+    }
+    if (st.st_size % sizeof(file_info_t) != 0) {
+        ESP_LOGW(TAG, "Spill file damaged, spilled files are indexed again");
+        remove(SPILL_PATH);
+        return;
+    }
+    spill_count = st.st_size / sizeof(file_info_t);
+}
 
-    FILE *file = fopen(filename, "wb");
-    if (file == NULL) {
-        ESP_LOGE(TAG, "Failed to open file for writing: %s", filename);
-        return ESP_FAIL;
+/**
+ * @brief Append entry as newest, oldest entry is moved to spill file if index is full. Expects index_mutex to be taken.
+ */
+static void index_append(const file_info_t *info) {
+    if (index_count >= CONFIG_RESULTS_INDEX_SIZE) {
+        if (!spill_append(&index_entries[0])) {
+            ESP_LOGE(TAG, "Failed to spill %s, it is indexed again at next boot", index_entries[0].filename);
+        }
+        index_remove_at(0);
     }
+    memcpy(&index_entries[index_count++], info, sizeof(file_info_t));
+}
 
-    size_t written = fwrite(buffer, 1, size, file);
-    fclose(file);
+/**
+ * @brief Position of listing going from newest entry of index to oldest entry of spill file
+ */
+typedef struct {
+    unsigned index_position;    ///< next index entry, counted from newest
+    bool in_spill;              ///< all index entries were passed
+    int spill_position;         ///< next spilled entry, counted from oldest, -1 when all were passed
+    FILE *spill;                ///< spill file, opened once per listing
+    unsigned spill_generation;  ///< spill_generation when spill file was opened
+} index_cursor_t;
 
-    if (written != size) {
-        ESP_LOGE(TAG, "Failed to write complete HCCAPX file. Written: %zu, Expected: %u", written, size);
-        remove(filename);
-        return ESP_FAIL;
+/**
+ * @brief Move cursor to offset-th newest existing file. Expects index_mutex to be taken.
+ *
+ * Spilled entries cleared before target position are skipped by their remembered positions, nothing is read.
+ * @return false if positions of cleared entries aren't known, so offset can't be found without reading entries
+ */
+static bool index_cursor_skip(index_cursor_t *cursor, unsigned offset) {
+    if (offset < index_count) {
+        cursor->index_position = offset;
+        return true;
+    }
+    if (spill_cleared_untracked) {
+        return false;
+    }
+    cursor->index_position = index_count;
+    cursor->in_spill = true;
+    unsigned spilled = offset - index_count;
+    if (spilled >= spill_count - spill_cleared_count) {
+        cursor->spill_position = -1;
+        return true;
+    }
+    // every cleared entry at or above position moves wanted entry one position down
+    int position = spill_count - 1 - spilled;
+    for (unsigned i = spill_cleared_count; (i > 0) && ((int) spill_cleared[i - 1] >= position); i--) {
+        position--;
     }
+    cursor->spill_position = position;
+    return true;
+}
 
-    ESP_LOGI(TAG, "Successfully saved HCCAPX file: %s (%u bytes) - SSID: %.*s", 
-             filename, size, ssid_len, (char *)ssid);
-    return ESP_OK;
+/**
+ * @brief Copy up to max entries from cursor position towards older entries. Expects index_mutex to be taken.
+ *
+ * Entries of index and spill file aren't mixed in one call. Cleared spilled entries are copied too, they match no filter.
+ * @return number of copied entries, 0 when all entries were passed
+ */
+static unsigned index_cursor_read(index_cursor_t *cursor, file_info_t *entries, unsigned max) {
+    unsigned count = 0;
+    if (!cursor->in_spill) {
+        for (; (count < max) && (cursor->index_position < index_count); count++, cursor->index_position++) {
+            memcpy(&entries[count], &index_entries[index_count - 1 - cursor->index_position], sizeof(file_info_t));
+        }
+        if (count > 0) {
+            return count;
+        }
+        cursor->in_spill = true;
+        cursor->spill_position = (int) spill_count - 1;
+    }
+    if (cursor->spill_position < 0) {
+        return 0;
+    }
+    if (cursor->spill == NULL) {
+        cursor->spill = fopen(SPILL_PATH, "rb");
+        cursor->spill_generation = spill_generation;
+        if (cursor->spill == NULL) {
+            ESP_LOGE(TAG, "Failed to open spill file");
+            cursor->spill_position = -1;
+            return 0;
+        }
+    } else if (cursor->spill_generation != spill_generation) {
+        ESP_LOGW(TAG, "Spill file replaced during listing");
+        cursor->spill_position = -1;
+        return 0;
+    }
+    count = ((unsigned) cursor->spill_position + 1 < max) ? (unsigned) cursor->spill_position + 1 : max;
+    // spill file is oldest first, so block ending at cursor is read and reversed
+    if (spill_read(cursor->spill, cursor->spill_position + 1 - count, entries, count) != count) {
+        ESP_LOGE(TAG, "Failed to read spill file");
+        cursor->spill_position = -1;
+        return 0;
+    }
+    cursor->spill_position -= count;
+    for (unsigned i = 0; i < count / 2; i++) {
+        file_info_t swap;
+        memcpy(&swap, &entries[i], sizeof(file_info_t));
+        memcpy(&entries[i], &entries[count - 1 - i], sizeof(file_info_t));
+        memcpy(&entries[count - 1 - i], &swap, sizeof(file_info_t));
+    }
+    return count;
 }
 
 /**
- * @brief Get list of saved result files
+ * @brief Release spill file of finished listing
  */
-int file_manager_list_files(file_info_t *files, int max_files) {
-    if (files == NULL || max_files <= 0) {
-        ESP_LOGE(TAG, "Invalid files array or max_files");
-        return -1;
+static void index_cursor_close(index_cursor_t *cursor) {
+    if (cursor->spill != NULL) {
+        fclose(cursor->spill);
+        cursor->spill = NULL;
     }
+}
 
+/**
+ * @brief Count spilled files matching filter by per-type counts. Expects index_mutex to be taken.
+ * @return false if filter needs spilled entries to be read (time, SSID, BSSID or extension without own type)
+ */
+static bool spill_count_by_type(const file_manager_filter_t *filter, unsigned *count) {
+    if ((filter != NULL) && ((filter->since != 0) || (filter->ssid_len != 0) || filter->match_bssid)) {
+        return false;
+    }
+    *count = 0;
+    if ((filter == NULL) || (filter->ext[0] == '\0')) {
+        for (unsigned i = 0; i < FILE_TYPE_COUNT; i++) {
+            *count += spill_type_counts[i];
+        }
+        return true;
+    }
+    // other extensions share one counter
+    uint8_t type = type_from_extension(filter->ext, strlen(filter->ext));
+    if (type == FILE_MANAGER_TYPE_OTHER) {
+        return false;
+    }
+    *count = spill_type_counts[type];
+    return true;
+}
+
+/**
+ * @brief FNV-1a hash of file name, spilled entries are matched by it during reconciliation
+ */
+static uint64_t name_hash(const char *name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (; *name != '\0'; name++) {
+        hash = (hash ^ (uint8_t)*name) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Find hash in array
+ * @return position of hash, -1 if not found
+ */
+static int hash_find(const uint64_t *hashes, unsigned count, uint64_t hash) {
+    for (unsigned i = 0; i < count; i++) {
+        if (hashes[i] == hash) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Load name hashes of all spilled entries and recount them per type
+ * @return true if whole spill file was read
+ */
+static bool spill_load_hashes(uint64_t *hashes) {
+    FILE *file = fopen(SPILL_PATH, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    file_info_t entries[SPILL_BATCH];
+    unsigned position = 0;
+    memset(spill_type_counts, 0, sizeof(spill_type_counts));
+    while (position < spill_count) {
+        unsigned count = (spill_count - position < SPILL_BATCH) ? spill_count - position : SPILL_BATCH;
+        if (spill_read(file, position, entries, count) != count) {
+            break;
+        }
+        for (unsigned i = 0; i < count; i++, position++) {
+            // cleared entry never matches, so it is dropped by compaction
+            hashes[position] = (entries[i].filename[0] == '\0') ? 0 : name_hash(entries[i].filename);
+            if (entries[i].filename[0] != '\0') {
+                (*spill_type_counter(&entries[i]))++;
+            }
+        }
+    }
+    fclose(file);
+    return position == spill_count;
+}
+
+/**
+ * @brief Load index from index file. Expects index_mutex to be taken.
+ * @return true if index file was valid
+ */
+static bool index_load(void) {
+    index_count = 0;
+    FILE *file = fopen(INDEX_PATH, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    index_header_t header;
+    bool valid = (fread(&header, sizeof(header), 1, file) == 1) &&
+        (header.magic == INDEX_MAGIC) &&
+        (header.entry_size == sizeof(file_info_t)) &&
+        (header.count <= CONFIG_RESULTS_INDEX_SIZE) &&
+        (fread(index_entries, sizeof(file_info_t), header.count, file) == header.count) &&
+        (fgetc(file) == EOF);
+    fclose(file);
+    if (valid) {
+        index_count = header.count;
+        next_sequence = header.next_sequence;
+        memcpy(spill_type_counts, header.spill_counts, sizeof(spill_type_counts));
+    }
+    // sequence must stay unique even if header was damaged
+    for (unsigned i = 0; i < index_count; i++) {
+        if (index_entries[i].sequence >= next_sequence) {
+            next_sequence = index_entries[i].sequence + 1;
+        }
+    }
+    return valid;
+}
+
+/**
+ * @brief Bring index and spill file in line with results directory. Called only from file_manager_init(), before index is published.
+ *
+ * First pass over directory marks indexed and spilled files, entries of missing files are removed and spill file is compacted.
+ * Spilled entries are matched by 64-bit name hash, so spill file is read once. Files that are neither indexed nor spilled
+ * (saved before index existed or after last index write) are stat()'ed and appended in second pass.
+ * @return true if index changed
+ */
+static bool index_reconcile(void) {
     DIR *dir = opendir(RESULTS_BASE_PATH);
     if (dir == NULL) {
         ESP_LOGE(TAG, "Failed to open results directory: %s", RESULTS_BASE_PATH);
-        return -1;
+        return false;
     }
 
-    int file_count = 0;
+    uint32_t seen[(CONFIG_RESULTS_INDEX_SIZE + 31) / 32] = { 0 };
+    uint64_t *spill_hashes = NULL;
+    uint32_t *spill_seen = NULL;
+    // persisted per-type counts are verified while spill file is read anyway
+    uint32_t persisted_counts[FILE_TYPE_COUNT];
+    memcpy(persisted_counts, spill_type_counts, sizeof(persisted_counts));
+    memset(spill_type_counts, 0, sizeof(spill_type_counts));
+    if (spill_count > 0) {
+        spill_hashes = (uint64_t *)malloc(spill_count * sizeof(uint64_t));
+        spill_seen = (uint32_t *)calloc((spill_count + 31) / 32, sizeof(uint32_t));
+        if ((spill_hashes == NULL) || (spill_seen == NULL) || !spill_load_hashes(spill_hashes)) {
+            ESP_LOGE(TAG, "Failed to load spill file, spilled files are indexed again");
+            spill_reset();
+        }
+    }
+    uint64_t *unknown = NULL;
+    unsigned unknown_count = 0;
+    unsigned unknown_capacity = 0;
+    bool changed = false;
     struct dirent *entry;
-    struct stat st;
-    char full_path[512];
 
-    while ((entry = readdir(dir)) != NULL && file_count < max_files) {
+    while ((entry = readdir(dir)) != NULL) {
         if (entry->d_name[0] == '.') {
-            continue; // Skip . and ..
+            continue; // Skip . and .. and index files
+        }
+        int position = index_find(entry->d_name);
+        if (position >= 0) {
+            seen[position / 32] |= 1u << (position % 32);
+            continue;
+        }
+        uint64_t hash = name_hash(entry->d_name);
+        position = hash_find(spill_hashes, spill_count, hash);
+        if (position >= 0) {
+            spill_seen[position / 32] |= 1u << (position % 32);
+            continue;
+        }
+        if (strlen(entry->d_name) >= FILE_MANAGER_NAME_LEN) {
+            ESP_LOGW(TAG, "Name too long for results index, ignoring %s", entry->d_name);
+            continue;
+        }
+        if (unknown_count == unknown_capacity) {
+            unsigned capacity = (unknown_capacity == 0) ? 16 : unknown_capacity * 2;
+            uint64_t *grown = (uint64_t *)realloc(unknown, capacity * sizeof(uint64_t));
+            if (grown == NULL) {
+                ESP_LOGE(TAG, "Not enough memory to index %s", entry->d_name);
+                continue;
+            }
+            unknown = grown;
+            unknown_capacity = capacity;
         }
+        unknown[unknown_count++] = hash;
+    }
 
-        snprintf(full_path, sizeof(full_path), "%s/%s", RESULTS_BASE_PATH, entry->d_name);
+    unsigned kept = 0;
+    for (unsigned i = 0; i < index_count; i++) {
+        if (seen[i / 32] & (1u << (i % 32))) {
+            if (kept != i) {
+                memcpy(&index_entries[kept], &index_entries[i], sizeof(file_info_t));
+            }
+            kept++;
+        }
+    }
+    if (kept != index_count) {
+        ESP_LOGW(TAG, "Removed %u missing files from results index", index_count - kept);
+        index_count = kept;
+        changed = true;
+    }
 
-        if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode)) {
-            strncpy(files[file_count].filename, entry->d_name, sizeof(files[file_count].filename) - 1);
-            files[file_count].filename[sizeof(files[file_count].filename) - 1] = '\0';
-            files[file_count].size = st.st_size;
-            files[file_count].timestamp = st.st_mtime;
-            file_count++;
+    kept = 0;
+    for (unsigned i = 0; i < spill_count; i++) {
+        if (spill_seen[i / 32] & (1u << (i % 32))) {
+            kept++;
         }
     }
+    if (kept != spill_count) {
+        spill_compact(spill_seen);
+    }
+    free(spill_hashes);
+    free(spill_seen);
+    if (memcmp(persisted_counts, spill_type_counts, sizeof(persisted_counts)) != 0) {
+        ESP_LOGW(TAG, "Spilled file counts updated");
+        changed = true;
+    }
 
+    if (unknown_count > 0) {
+        struct stat st;
+        // caller's stack is small (attack controller task) and reconcile runs only once, so path buffer is static
+        static char full_path[sizeof(RESULTS_BASE_PATH) + sizeof(entry->d_name)];
+        rewinddir(dir);
+        while ((unknown_count > 0) && ((entry = readdir(dir)) != NULL)) {
+            int position = (entry->d_name[0] == '.') ? -1 : hash_find(unknown, unknown_count, name_hash(entry->d_name));
+            if (position < 0) {
+                continue;
+            }
+            // each file is appended once even if directory changes while it is read
+            unknown[position] = unknown[--unknown_count];
+            snprintf(full_path, sizeof(full_path), "%s/%s", RESULTS_BASE_PATH, entry->d_name);
+            if (stat(full_path, &st) != 0 || !S_ISREG(st.st_mode)) {
+                continue;
+            }
+            file_info_t info = {
+                .size = st.st_size,
+                .timestamp = st.st_mtime,
+                .sequence = next_sequence++,
+                .type = file_type_from_name(entry->d_name)
+            };
+            strcpy(info.filename, entry->d_name);
+            index_append(&info);
+            changed = true;
+        }
+    }
     closedir(dir);
-    ESP_LOGD(TAG, "Found %d result files", file_count);
-    return file_count;
+    free(unknown);
+    return changed;
 }
 
 /**
- * @brief Delete a result file by name
+ * @brief Add entry to index and persist it, entry of file with the same name is replaced
  */
-esp_err_t file_manager_delete_file(const char *filename) {
+static esp_err_t index_add(const file_info_t *info) {
+    if (index_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(index_mutex, portMAX_DELAY);
+    int position = index_find(info->filename);
+    if (position >= 0) {
+        index_remove_at(position);
+    }
+    index_append(info);
+    index_save();
+    xSemaphoreGive(index_mutex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Initialize SPIFFS mount point for results storage and load results index
+ */
+esp_err_t file_manager_init(void) {
+    esp_err_t ret = mount_results_partition();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (index_mutex != NULL) {
+        return ESP_OK;
+    }
+
+    SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+    if (mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create results index mutex");
+        return ESP_ERR_NO_MEM;
+    }
+    // index isn't visible to other tasks until mutex is published
+    bool loaded = index_load();
+    if (loaded) {
+        spill_load();
+    } else {
+        ESP_LOGW(TAG, "Results index missing or invalid, rebuilding from directory");
+        spill_reset();
+    }
+    if (index_reconcile() || !loaded) {
+        index_save();
+    }
+    index_mutex = mutex;
+    ESP_LOGI(TAG, "Results index loaded, %u files, %u spilled", index_count, spill_count);
+    return ESP_OK;
+}
+
+/**
+ * @brief Generate filename from timestamp and write sequence
+ */
+static void generate_filename(const char *extension, uint32_t sequence, char *filename, size_t max_len) {
+    time_t now = time(NULL);
+    struct tm *timeinfo = localtime(&now);
+    snprintf(filename, max_len, "%s/%02d%02d%02d_%02d%02d%02d_%04x.%s",
+             RESULTS_BASE_PATH,
+             timeinfo->tm_year % 100,
+             timeinfo->tm_mon + 1,
+             timeinfo->tm_mday,
+             timeinfo->tm_hour,
+             timeinfo->tm_min,
+             timeinfo->tm_sec,
+             sequence & 0xffff,
+             extension);
+}
+
+/**
+ * @brief Take next write sequence and generate filename that isn't used by any stored file
+ * @return ESP_ERR_INVALID_STATE if index isn't loaded
+ */
+static esp_err_t reserve_filename(const char *extension, uint32_t *sequence, char *filename, size_t max_len) {
+    if (index_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    struct stat st;
+    xSemaphoreTake(index_mutex, portMAX_DELAY);
+    // time restarts after reboot, so name is checked against files on partition
+    do {
+        *sequence = next_sequence++;
+        generate_filename(extension, *sequence, filename, max_len);
+    } while (stat(filename, &st) == 0);
+    xSemaphoreGive(index_mutex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Result file being written
+ */
+struct file_manager_writer {
+    FILE *file;
+    gzip_stream_t *stream;  ///< NULL if file is not compressed
+    bool stream_owned;      ///< whether stream was allocated by writer
+    uint32_t size;          ///< size of uncompressed data written so far
+    uint32_t sequence;
+    char filename[128];
+    uint8_t ssid[32];
+    uint8_t ssid_len;
+    uint8_t bssid[6];
+};
+
+/**
+ * @brief Write callback for gzip_stream that appends compressed data to file
+ */
+static esp_err_t gzip_file_write(const uint8_t *data, size_t size, void *arg) {
+    return (fwrite(data, 1, size, (FILE *)arg) == size) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Create new uniquely named result file
+ */
+file_manager_writer_t *file_manager_writer_open(const char *extension, bool compress, void *stream_buffer) {
+    if (strlen(extension) > MAX_EXTENSION_LEN) {
+        ESP_LOGE(TAG, "Extension too long: %s", extension);
+        return NULL;
+    }
+
+    file_manager_writer_t *writer = (file_manager_writer_t *)calloc(1, sizeof(file_manager_writer_t));
+    if (writer == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate file writer");
+        return NULL;
+    }
+
+    char compressed_extension[16];
+    if (compress) {
+        snprintf(compressed_extension, sizeof(compressed_extension), "%s%s", extension, FILE_MANAGER_GZIP_SUFFIX);
+        extension = compressed_extension;
+    }
+    if (reserve_filename(extension, &writer->sequence, writer->filename, sizeof(writer->filename)) != ESP_OK) {
+        ESP_LOGE(TAG, "Results index isn't loaded");
+        free(writer);
+        return NULL;
+    }
+
+    writer->file = fopen(writer->filename, "wb");
+    if (writer->file == NULL) {
+        ESP_LOGE(TAG, "Failed to open file for writing: %s", writer->filename);
+        free(writer);
+        return NULL;
+    }
+
+    if (compress && stream_buffer != NULL) {
+        writer->stream = gzip_stream_init(stream_buffer, gzip_file_write, writer->file);
+    } else if (compress) {
+        writer->stream = gzip_stream_create(gzip_file_write, writer->file);
+        writer->stream_owned = true;
+        if (writer->stream == NULL) {
+            fclose(writer->file);
+            remove(writer->filename);
+            free(writer);
+            return NULL;
+        }
+    }
+    return writer;
+}
+
+/**
+ * @brief Set target AP of result file
+ */
+void file_manager_writer_set_target(file_manager_writer_t *writer, const uint8_t *ssid, unsigned ssid_len, const uint8_t *bssid) {
+    writer->ssid_len = (ssid_len < sizeof(writer->ssid)) ? ssid_len : sizeof(writer->ssid);
+    memcpy(writer->ssid, ssid, writer->ssid_len);
+    memcpy(writer->bssid, bssid, sizeof(writer->bssid));
+}
+
+/**
+ * @brief Append data to result file
+ */
+esp_err_t file_manager_writer_write(const uint8_t *data, size_t size, void *arg) {
+    file_manager_writer_t *writer = (file_manager_writer_t *)arg;
+    writer->size += size;
+    if (writer->stream != NULL) {
+        return gzip_stream_write(writer->stream, data, size);
+    }
+    return (fwrite(data, 1, size, writer->file) == size) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Finish result file
+ */
+esp_err_t file_manager_writer_close(file_manager_writer_t *writer, bool commit) {
+    if (writer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = commit ? ESP_OK : ESP_FAIL;
+    if (writer->stream != NULL) {
+        if (ret == ESP_OK) {
+            ret = gzip_stream_finish(writer->stream);
+        }
+        if (writer->stream_owned) {
+            gzip_stream_destroy(writer->stream);
+        }
+    }
+    long file_size = ftell(writer->file);
+    if (fclose(writer->file) != 0 && ret == ESP_OK) {
+        ret = ESP_FAIL;
+    }
+
+    if (ret != ESP_OK) {
+        if (commit) {
+            ESP_LOGE(TAG, "Failed to write complete file: %s", writer->filename);
+        }
+        remove(writer->filename);
+    } else {
+        ESP_LOGI(TAG, "Successfully saved file: %s (%u bytes, %ld on flash)", writer->filename, writer->size, file_size);
+        file_info_t info = {
+            .size = file_size,
+            .timestamp = time(NULL),
+            .sequence = writer->sequence,
+            .ssid_len = writer->ssid_len
+        };
+        const char *name = writer->filename + strlen(RESULTS_BASE_PATH) + 1;
+        strncpy(info.filename, name, sizeof(info.filename) - 1);
+        info.type = file_type_from_name(name);
+        memcpy(info.bssid, writer->bssid, sizeof(info.bssid));
+        memcpy(info.ssid, writer->ssid, writer->ssid_len);
+        if (index_add(&info) != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to add %s to results index", name);
+        }
+    }
+    free(writer);
+    return ret;
+}
+
+/**
+ * @brief Enumerate saved result files matching filter from results index, newest first
+ */
+esp_err_t file_manager_for_each_file(const file_manager_filter_t *filter, unsigned offset, unsigned limit, file_manager_list_cb_t list_cb, void *arg) {
+    if (index_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    unsigned matched = 0;
+    unsigned passed = 0;
+    bool done = false;
+    file_info_t entries[SPILL_BATCH];
+    index_cursor_t cursor = { 0 };
+    xSemaphoreTake(index_mutex, portMAX_DELAY);
+    // unfiltered page starts at its position, so skipped files aren't read
+    if (filter_is_empty(filter) && index_cursor_skip(&cursor, offset)) {
+        matched = offset;
+    }
+    xSemaphoreGive(index_mutex);
+    while (!done) {
+        // entries are copied, so list_cb runs without lock
+        xSemaphoreTake(index_mutex, portMAX_DELAY);
+        unsigned count = index_cursor_read(&cursor, entries, SPILL_BATCH);
+        xSemaphoreGive(index_mutex);
+        if (count == 0) {
+            break;
+        }
+        for (unsigned i = 0; (i < count) && !done; i++) {
+            if (!filter_match(filter, &entries[i]) || (matched++ < offset)) {
+                continue;
+            }
+            ret = list_cb(&entries[i], arg);
+            done = (ret != ESP_OK) || ((limit != 0) && (++passed >= limit));
+        }
+    }
+    index_cursor_close(&cursor);
+    return ret;
+}
+
+/**
+ * @brief Count saved result files matching filter
+ */
+unsigned file_manager_count_files(const file_manager_filter_t *filter) {
+    if (index_mutex == NULL) {
+        return 0;
+    }
+    unsigned count = 0;
+    xSemaphoreTake(index_mutex, portMAX_DELAY);
+    for (unsigned i = 0; i < index_count; i++) {
+        if (filter_match(filter, &index_entries[i])) {
+            count++;
+        }
+    }
+    unsigned spilled;
+    if (spill_count_by_type(filter, &spilled)) {
+        count += spilled;
+    } else {
+        // spill file is read once, in batches
+        index_cursor_t cursor = { .index_position = index_count };
+        file_info_t entries[SPILL_BATCH];
+        unsigned read;
+        while ((read = index_cursor_read(&cursor, entries, SPILL_BATCH)) > 0) {
+            for (unsigned i = 0; i < read; i++) {
+                if (filter_match(filter, &entries[i])) {
+                    count++;
+                }
+            }
+        }
+        index_cursor_close(&cursor);
+    }
+    xSemaphoreGive(index_mutex);
+    return count;
+}
+
+/**
+ * @brief Build full path of result file
+ * @return false if filename is invalid
+ */
+static bool build_path(const char *filename, char *full_path, size_t max_len) {
     if (filename == NULL) {
         ESP_LOGE(TAG, "Invalid filename");
-        return ESP_ERR_INVALID_ARG;
+        return false;
     }
 
     // Prevent directory traversal attacks
     if (strchr(filename, '/') != NULL) {
         ESP_LOGE(TAG, "Invalid filename contains path separator");
-        return ESP_ERR_INVALID_ARG;
+        return false;
     }
 
+    snprintf(full_path, max_len, "%s/%s", RESULTS_BASE_PATH, filename);
+    return true;
+}
+
+/**
+ * @brief Delete a result file by name
+ */
+esp_err_t file_manager_delete_file(const char *filename) {
     char full_path[256];
-    snprintf(full_path, sizeof(full_path), "%s/%s", RESULTS_BASE_PATH, filename);
+    if (!build_path(filename, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
     if (remove(full_path) == 0) {
         ESP_LOGI(TAG, "Successfully deleted file: %s", filename);
+        if (index_mutex != NULL) {
+            xSemaphoreTake(index_mutex, portMAX_DELAY);
+            file_info_t info;
+            int position = index_find(filename);
+            if (position >= 0) {
+                index_remove_at(position);
+                index_save();
+            } else if ((position = spill_find(filename, &info)) >= 0) {
+                spill_clear(position, &info);
+                index_save();
+            }
+            xSemaphoreGive(index_mutex);
+        }
         return ESP_OK;
     } else {
         ESP_LOGE(TAG, "Failed to delete file: %s", filename);
@@ -209,54 +1148,71 @@ esp_err_t file_manager_delete_file(const char *filename) {
 }
 
 /**
- * @brief Get file by name and return buffer
+ * @brief Get results index entry of stored file
  */
-uint8_t *file_manager_get_file(const char *filename, uint32_t *size) {
-    if (filename == NULL || size == NULL) {
-        ESP_LOGE(TAG, "Invalid filename or size pointer");
-        return NULL;
+esp_err_t file_manager_get_file_info(const char *filename, file_info_t *info) {
+    char full_path[256];
+    if (!build_path(filename, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (index_mutex == NULL) {
+        return ESP_ERR_NOT_FOUND;
     }
 
-    // Prevent directory traversal attacks
-    if (strchr(filename, '/') != NULL) {
-        ESP_LOGE(TAG, "Invalid filename contains path separator");
-        return NULL;
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(index_mutex, portMAX_DELAY);
+    int position = index_find(filename);
+    if (position >= 0) {
+        memcpy(info, &index_entries[position], sizeof(file_info_t));
+        ret = ESP_OK;
+    } else if (spill_find(filename, info) >= 0) {
+        ret = ESP_OK;
     }
+    xSemaphoreGive(index_mutex);
+    return ret;
+}
 
+/**
+ * @brief Stream part of file through caller's buffer
+ */
+esp_err_t file_manager_read_file(const char *filename, uint32_t offset, uint32_t length, uint8_t *buffer, size_t buffer_size, file_manager_read_cb_t read_cb, void *arg) {
     char full_path[256];
-    snprintf(full_path, sizeof(full_path), "%s/%s", RESULTS_BASE_PATH, filename);
+    if (!build_path(filename, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
     FILE *file = fopen(full_path, "rb");
     if (file == NULL) {
         ESP_LOGE(TAG, "Failed to open file: %s", filename);
-        return NULL;
+        return ESP_ERR_NOT_FOUND;
     }
 
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    *size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Allocate buffer
-    uint8_t *buffer = (uint8_t *)malloc(*size);
-    if (buffer == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate memory for file: %s (%u bytes)", filename, *size);
+    if (fseek(file, offset, SEEK_SET) != 0) {
+        ESP_LOGE(TAG, "Failed to seek to %u in file: %s", offset, filename);
         fclose(file);
-        return NULL;
+        return ESP_FAIL;
     }
 
-    // Read file
-    size_t read = fread(buffer, 1, *size, file);
+    esp_err_t ret = ESP_OK;
+    uint32_t total = 0;
+    size_t read;
+    while ((total < length) && (read = fread(buffer, 1, (length - total < buffer_size) ? length - total : buffer_size, file)) > 0) {
+        total += read;
+        ret = read_cb(buffer, read, arg);
+        if (ret != ESP_OK) {
+            break;
+        }
+    }
+    if (ret == ESP_OK && ferror(file)) {
+        ESP_LOGE(TAG, "Failed to read file: %s", filename);
+        ret = ESP_FAIL;
+    }
     fclose(file);
 
-    if (read != *size) {
-        ESP_LOGE(TAG, "Failed to read complete file. Read: %zu, Expected: %u", read, *size);
-        free(buffer);
-        return NULL;
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Successfully read file: %s (%u bytes at %u)", filename, total, offset);
     }
-
-    ESP_LOGI(TAG, "Successfully loaded file: %s (%u bytes)", filename, *size);
-    return buffer;
+    return ret;
 }
 
 /**
@@ -276,3 +1232,12 @@ uint32_t file_manager_get_total_space(void) {
     esp_spiffs_info(SPIFFS_PARTITION_LABEL, &total, &used);
     return (uint32_t)total;
 }
+
+/**
+ * @brief Check whether stored file is GZIP compressed
+ */
+bool file_manager_is_compressed(const char *filename) {
+    size_t len = strlen(filename);
+    size_t suffix_len = strlen(FILE_MANAGER_GZIP_SUFFIX);
+    return (len > suffix_len) && (strcmp(filename + len - suffix_len, FILE_MANAGER_GZIP_SUFFIX) == 0);
+}
@@ -1,68 +1,204 @@
 /**
  * @file file_manager.h
  * @brief File manager for SPIFFS-based result persistence
+ *
+ * Saved files are tracked by results index held in RAM and persisted in hidden index file on the same partition.
+ * Listing, filtering and file info of newest CONFIG_RESULTS_INDEX_SIZE files are answered from RAM, older files are
+ * spilled to hidden spill file and read from it in small batches. Spilled files are counted per type, so unfiltered
+ * and extension counts and unfiltered pages don't depend on number of spilled files.
  */
 
 #ifndef FILE_MANAGER_H
 #define FILE_MANAGER_H
 
 #include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
 #include "esp_err.h"
 
 /**
- * @brief File metadata structure for result listings
+ * @brief Suffix appended to names of files that are stored GZIP compressed
+ */
+#define FILE_MANAGER_GZIP_SUFFIX ".gz"
+
+/**
+ * @brief Whether PCAP results should be stored compressed (CONFIG_RESULTS_COMPRESS_PCAP)
+ */
+#ifdef CONFIG_RESULTS_COMPRESS_PCAP
+#define FILE_MANAGER_COMPRESS_PCAP true
+#else
+#define FILE_MANAGER_COMPRESS_PCAP false
+#endif
+
+/**
+ * @brief Maximal length of result file name including terminating null byte
+ */
+#define FILE_MANAGER_NAME_LEN 44
+
+/**
+ * @brief Type of result file derived from its extension
+ */
+typedef enum {
+    FILE_MANAGER_TYPE_OTHER = 0,
+    FILE_MANAGER_TYPE_PCAP,
+    FILE_MANAGER_TYPE_PCAPNG,
+    FILE_MANAGER_TYPE_HCCAPX,
+    FILE_MANAGER_TYPE_22000
+} file_manager_type_t;
+
+/**
+ * @brief Results index entry. Layout (96 bytes, little endian) is also entry of \c /results response.
  */
 typedef struct {
-    char filename[128];
-    uint32_t size;
-    uint32_t timestamp;
+    char filename[FILE_MANAGER_NAME_LEN];
+    uint32_t size;          ///< size on flash
+    uint32_t timestamp;     ///< unix time of save, restarts at 0 on every boot unless clock is set
+    uint32_t sequence;      ///< unique write number, never reused even if the file name is
+    uint8_t bssid[6];       ///< target AP, zeros if unknown
+    uint8_t type;           ///< see file_manager_type_t
+    uint8_t ssid_len;       ///< 0 if unknown
+    uint8_t ssid[32];       ///< target SSID, not null terminated
 } file_info_t;
 
 /**
- * @brief Initialize SPIFFS mount point for results storage
+ * @brief Filter of saved result files. Zeroed filter matches all files.
+ */
+typedef struct {
+    char ext[16];           ///< extension without dot, compressed variant matches too. Empty for any.
+    uint32_t since;         ///< only files saved at or after this unix time
+    uint8_t ssid_len;       ///< 0 for any SSID
+    uint8_t ssid[32];
+    bool match_bssid;
+    uint8_t bssid[6];
+} file_manager_filter_t;
+
+/**
+ * @brief Initialize SPIFFS mount point for results storage and load results index
+ *
+ * Index is loaded from index file and reconciled with results directory and spill file. Only files missing in both are stat()'ed.
  * @return ESP_OK on success
  */
 esp_err_t file_manager_init(void);
 
 /**
- * @brief Save PCAP data to SPIFFS with timestamp
- * @param buffer pointer to PCAP data
- * @param size size of PCAP data
- * @return ESP_OK on success
+ * @brief Result file being written, see file_manager_writer_open()
  */
-esp_err_t file_manager_save_pcap(const uint8_t *buffer, uint32_t size);
+typedef struct file_manager_writer file_manager_writer_t;
 
 /**
- * @brief Save HCCAPX data to SPIFFS with timestamp
- * @param buffer pointer to HCCAPX data (hccapx_t struct)
- * @param ssid pointer to SSID string
- * @param ssid_len length of SSID
+ * @brief Create new result file on SPIFFS named by current timestamp and write sequence
+ *
+ * Clock isn't set after boot, so low 16 bits of write sequence keep names unique. Name of stored file is never reused.
+ * If compress is true, data are compressed while being written and file name gets FILE_MANAGER_GZIP_SUFFIX.
+ * @param extension file extension without dot (e.g. "pcap"), at most 6 characters so the name fits into SPIFFS object name
+ * @param compress whether to store file GZIP compressed
+ * @param stream_buffer memory of gzip_stream_get_size() bytes for compressor state owned by caller until the writer is closed,
+ * NULL allocates compressor on heap. Ignored if compress is false.
+ * @return writer handle, NULL on error
+ */
+file_manager_writer_t *file_manager_writer_open(const char *extension, bool compress, void *stream_buffer);
+
+/**
+ * @brief Set target AP of result file, stored in results index when the file is committed
+ * @param writer writer handle
+ * @param ssid SSID of target AP
+ * @param ssid_len length of SSID, up to 32 bytes
+ * @param bssid BSSID of target AP
+ */
+void file_manager_writer_set_target(file_manager_writer_t *writer, const uint8_t *ssid, unsigned ssid_len, const uint8_t *bssid);
+
+/**
+ * @brief Append data to result file
+ *
+ * Signature matches write callbacks of serializers, so the writer can be passed directly as output.
+ * @param data data to be written
+ * @param size size of data
+ * @param writer file_manager_writer_t handle
  * @return ESP_OK on success
  */
-esp_err_t file_manager_save_hccapx(const uint8_t *buffer, uint32_t size, const uint8_t *ssid, uint32_t ssid_len);
+esp_err_t file_manager_writer_write(const uint8_t *data, size_t size, void *writer);
+
+/**
+ * @brief Finish result file and free writer. Committed file is added to results index.
+ * @param writer writer handle
+ * @param commit true to keep the file, false to discard it (e.g. after failed write)
+ * @return ESP_OK if the file was stored completely
+ */
+esp_err_t file_manager_writer_close(file_manager_writer_t *writer, bool commit);
+
+/**
+ * @brief Callback receiving saved result files enumerated by file_manager_for_each_file()
+ * @param info info of single file
+ * @param arg argument passed to file_manager_for_each_file()
+ * @return ESP_OK to continue, anything else stops enumeration and is returned
+ */
+typedef esp_err_t (*file_manager_list_cb_t)(const file_info_t *info, void *arg);
+
+/**
+ * @brief Enumerate saved result files matching filter from results index, newest first
+ *
+ * Callback is called without index lock, so it may send data to network. Files saved or deleted meanwhile
+ * may be skipped or passed twice. Spill file is opened once per call. Without filter, offset is found by position,
+ * skipped files aren't read.
+ * @param filter filter of files, NULL for all files
+ * @param offset number of matching files to skip
+ * @param limit maximal number of files passed to list_cb, 0 for no limit
+ * @param list_cb callback called for every file
+ * @param arg argument passed to list_cb
+ * @return ESP_OK when all files were enumerated, ESP_ERR_INVALID_STATE if index isn't loaded, otherwise error returned by list_cb
+ */
+esp_err_t file_manager_for_each_file(const file_manager_filter_t *filter, unsigned offset, unsigned limit, file_manager_list_cb_t list_cb, void *arg);
 
 /**
- * @brief Get list of saved result files
- * @param files array to store file info (allocated by caller)
- * @param max_files maximum number of files to return
- * @return number of files found, -1 on error
+ * @brief Count saved result files matching filter
+ *
+ * Spilled files are counted by per-type counts unless filter has time, SSID, BSSID or extension of unknown type.
+ * @param filter filter of files, NULL for all files
+ * @return number of matching files, 0 if index isn't loaded
  */
-int file_manager_list_files(file_info_t *files, int max_files);
+unsigned file_manager_count_files(const file_manager_filter_t *filter);
 
 /**
- * @brief Delete a result file by name
+ * @brief Delete a result file by name and remove it from results index
  * @param filename name of file to delete
  * @return ESP_OK on success
  */
 esp_err_t file_manager_delete_file(const char *filename);
 
 /**
- * @brief Get file by name and return buffer
- * @param filename name of file to retrieve
- * @param size output parameter for file size
- * @return pointer to file buffer (allocated by function, must be freed by caller), NULL on error
+ * @brief Callback receiving parts of file read by file_manager_read_file()
+ * @param data part of file content
+ * @param size size of data
+ * @param arg argument passed to file_manager_read_file()
+ * @return ESP_OK to continue reading, anything else stops reading and is returned
+ */
+typedef esp_err_t (*file_manager_read_cb_t)(const uint8_t *data, size_t size, void *arg);
+
+/**
+ * @brief Get results index entry of stored file
+ * @param filename name of file
+ * @param info output parameter for file info
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for invalid name, ESP_ERR_NOT_FOUND if file isn't indexed
+ */
+esp_err_t file_manager_get_file_info(const char *filename, file_info_t *info);
+
+/**
+ * @brief Stream part of file through caller's buffer
+ *
+ * File is read in pieces of buffer_size bytes and every piece is passed to read_cb, so memory usage doesn't depend on file size.
+ * Reading starts at given offset, so interrupted transfer can continue where it stopped.
+ * @param filename name of file to read
+ * @param offset offset of the first byte to read
+ * @param length number of bytes to read, reading stops earlier at end of file
+ * @param buffer caller's buffer
+ * @param buffer_size size of buffer
+ * @param read_cb callback receiving read data
+ * @param arg argument passed to read_cb
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for invalid name, ESP_ERR_NOT_FOUND if file can't be opened,
+ *         ESP_FAIL on read error or error returned by read_cb
  */
-uint8_t *file_manager_get_file(const char *filename, uint32_t *size);
+esp_err_t file_manager_read_file(const char *filename, uint32_t offset, uint32_t length, uint8_t *buffer, size_t buffer_size, file_manager_read_cb_t read_cb, void *arg);
 
 /**
  * @brief Get free space on SPIFFS
@@ -76,4 +212,11 @@ uint32_t file_manager_get_free_space(void);
  */
 uint32_t file_manager_get_total_space(void);
 
+/**
+ * @brief Check whether stored file is GZIP compressed
+ * @param filename name of file
+ * @return true if file content is GZIP stream
+ */
+bool file_manager_is_compressed(const char *filename);
+
 #endif /* FILE_MANAGER_H */
@@ -14,7 +14,9 @@
 ESP_EVENT_DECLARE_BASE(WEBSERVER_EVENTS);
 enum {
     WEBSERVER_EVENT_ATTACK_REQUEST,
-    WEBSERVER_EVENT_ATTACK_RESET
+    WEBSERVER_EVENT_ATTACK_RESET,
+    WEBSERVER_EVENT_JOB_ADD,        ///< append attack_request_t to job queue
+    WEBSERVER_EVENT_JOBS_CLEAR      ///< stop running job and clear job queue
 };
 
 /**
@@ -26,6 +28,7 @@ typedef struct {
     uint8_t type;           //< Chosen type of attack
     uint8_t method;         //< Chosen method of attack
     uint8_t timeout;        //< Attack timeout in seconds
+    uint8_t bssid[6];       //< BSSID of chosen AP. Slot may be reused by other AP, so request is rejected if it doesn't match.
 } attack_request_t;
 
 /**
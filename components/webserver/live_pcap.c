@@ -0,0 +1,272 @@
+/**
+ * @file live_pcap.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements live PCAP stream of captured frames
+ *
+ * Frames are serialised into ring buffer of every client by Capture Store listener in task that captured them.
+ * Buffers are drained by work queued to httpd task, which is the only task writing to client sockets.
+ * Chunked transfer encoding is written directly to the socket, because the response never ends.
+ */
+#include "live_pcap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+
+#include "capture_store.h"
+#include "pcap_serializer.h"
+
+static const char *TAG = "live_pcap";
+
+/**
+ * @brief Live PCAP client with its ring buffer of serialised records
+ */
+typedef struct {
+    int sockfd;         ///< -1 if slot is free
+    uint8_t *buffer;    ///< CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE bytes
+    size_t head;        ///< next write position
+    size_t tail;        ///< next read position
+    size_t used;
+    uint32_t frames;
+    uint32_t dropped;
+} live_client_t;
+
+static const char *stream_headers = "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/vnd.tcpdump.pcap\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n";
+
+static httpd_handle_t server = NULL;
+static SemaphoreHandle_t clients_mutex = NULL;
+static live_client_t clients[CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS];
+static live_pcap_stats_t stats;
+/**
+ * @brief Set while drain work waits in httpd queue, so every frame doesn't queue its own work
+ */
+static volatile bool work_pending = false;
+
+/**
+ * @brief Sends whole buffer to client socket. Runs in httpd task.
+ */
+static esp_err_t socket_send_all(int sockfd, const char *data, size_t size){
+    while(size > 0){
+        int sent = httpd_socket_send(server, sockfd, data, size, 0);
+        if(sent <= 0){
+            return ESP_FAIL;
+        }
+        data += sent;
+        size -= sent;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Sends data as single chunk of chunked transfer encoding. Runs in httpd task.
+ */
+static esp_err_t send_chunk(int sockfd, const uint8_t *data, size_t size){
+    char chunk_header[12];
+    int length = snprintf(chunk_header, sizeof(chunk_header), "%x\r\n", size);
+    if((socket_send_all(sockfd, chunk_header, length) != ESP_OK) ||
+        (socket_send_all(sockfd, (const char *) data, size) != ESP_OK) ||
+        (socket_send_all(sockfd, "\r\n", 2) != ESP_OK)){
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Write callback for pcap_serializer that sends PCAP global header as chunk
+ * @param arg expects client socket
+ */
+static esp_err_t header_send(const uint8_t *data, size_t size, void *arg){
+    return send_chunk((int) (intptr_t) arg, data, size);
+}
+
+/**
+ * @brief Write callback for pcap_serializer that appends serialised record to client ring buffer.
+ *
+ * Caller checked free space and holds clients_mutex.
+ * @param arg expects live_client_t
+ */
+static esp_err_t ring_write(const uint8_t *data, size_t size, void *arg){
+    live_client_t *client = (live_client_t *) arg;
+    size_t first = CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE - client->head;
+    if(first > size){
+        first = size;
+    }
+    memcpy(&client->buffer[client->head], data, first);
+    memcpy(client->buffer, &data[first], size - first);
+    client->head = (client->head + size) % CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE;
+    client->used += size;
+    return ESP_OK;
+}
+
+/**
+ * @brief Frees client slot. Expects clients_mutex to be taken.
+ */
+static void release_client(live_client_t *client){
+    ESP_LOGI(TAG, "Live PCAP client %d removed, %u frames queued, %u dropped", client->sockfd, client->frames, client->dropped);
+    free(client->buffer);
+    client->buffer = NULL;
+    client->sockfd = -1;
+    stats.clients--;
+}
+
+/**
+ * @brief Sends everything buffered for all clients. Clients that fail are closed. Work function queued by frame_listener(), runs in httpd task.
+ * @param arg not used
+ */
+static void drain_work(void *arg){
+    work_pending = false;
+    for(unsigned i = 0; i < CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS; i++){
+        live_client_t *client = &clients[i];
+        while(true){
+            // only httpd task frees buffers and moves tail, listener only appends behind head
+            xSemaphoreTake(clients_mutex, portMAX_DELAY);
+            int sockfd = client->sockfd;
+            size_t span = CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE - client->tail;
+            if(span > client->used){
+                span = client->used;
+            }
+            const uint8_t *data = &client->buffer[client->tail];
+            xSemaphoreGive(clients_mutex);
+            if((sockfd < 0) || (span == 0)){
+                break;
+            }
+            if(send_chunk(sockfd, data, span) != ESP_OK){
+                ESP_LOGD(TAG, "Client %d gone", sockfd);
+                xSemaphoreTake(clients_mutex, portMAX_DELAY);
+                release_client(client);
+                xSemaphoreGive(clients_mutex);
+                httpd_sess_trigger_close(server, sockfd);
+                break;
+            }
+            xSemaphoreTake(clients_mutex, portMAX_DELAY);
+            client->tail = (client->tail + span) % CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE;
+            client->used -= span;
+            xSemaphoreGive(clients_mutex);
+        }
+    }
+}
+
+/**
+ * @brief Capture Store frame listener. Serialises frame into buffer of every client and queues drain work.
+ *
+ * Runs in task that appended the frame, so it never waits for socket.
+ */
+static void frame_listener(const uint8_t *frame, unsigned size, uint32_t ts_usec, void *arg){
+    bool queued = false;
+    size_t record_size = sizeof(pcap_record_header_t) + size;
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS; i++){
+        live_client_t *client = &clients[i];
+        if(client->sockfd < 0){
+            continue;
+        }
+        if(record_size > CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE - client->used){
+            client->dropped++;
+            stats.dropped++;
+            continue;
+        }
+        pcap_serializer_write_frame(ring_write, client, frame, size, ts_usec);
+        client->frames++;
+        stats.frames++;
+        queued = true;
+    }
+    xSemaphoreGive(clients_mutex);
+
+    if(queued && !work_pending){
+        work_pending = true;
+        if(httpd_queue_work(server, drain_work, NULL) != ESP_OK){
+            work_pending = false;
+        }
+    }
+}
+
+esp_err_t live_pcap_init(httpd_handle_t server_handle){
+    server = server_handle;
+    clients_mutex = xSemaphoreCreateMutex();
+    if(clients_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create live PCAP resources");
+        return ESP_ERR_NO_MEM;
+    }
+    for(unsigned i = 0; i < CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS; i++){
+        clients[i].sockfd = -1;
+    }
+    capture_store_set_frame_listener(frame_listener, NULL);
+    return ESP_OK;
+}
+
+esp_err_t live_pcap_add_client(httpd_req_t *req){
+    int sockfd = httpd_req_to_sockfd(req);
+
+    // only httpd task adds clients, so the slot stays free
+    live_client_t *client = NULL;
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS; i++){
+        if(clients[i].sockfd < 0){
+            client = &clients[i];
+            break;
+        }
+    }
+    xSemaphoreGive(clients_mutex);
+    if(client == NULL){
+        ESP_LOGW(TAG, "Maximum number of live PCAP clients reached");
+        return ESP_ERR_NO_MEM;
+    }
+    uint8_t *buffer = malloc(CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE);
+    if(buffer == NULL){
+        ESP_LOGE(TAG, "Failed to allocate live PCAP buffer");
+        return ESP_ERR_NO_MEM;
+    }
+
+    if((socket_send_all(sockfd, stream_headers, strlen(stream_headers)) != ESP_OK) ||
+        (pcap_serializer_write_header(header_send, (void *) (intptr_t) sockfd) != ESP_OK)){
+        ESP_LOGW(TAG, "Failed to start live PCAP stream");
+        free(buffer);
+        return ESP_FAIL;
+    }
+
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    memset(client, 0, sizeof(live_client_t));
+    client->buffer = buffer;
+    client->sockfd = sockfd;
+    stats.clients++;
+    xSemaphoreGive(clients_mutex);
+    ESP_LOGI(TAG, "Live PCAP client %d added", sockfd);
+    return ESP_OK;
+}
+
+void live_pcap_remove_client(int sockfd){
+    if(clients_mutex == NULL){
+        return;
+    }
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < CONFIG_WEBSERVER_LIVE_PCAP_MAX_CLIENTS; i++){
+        if(clients[i].sockfd == sockfd){
+            release_client(&clients[i]);
+            break;
+        }
+    }
+    xSemaphoreGive(clients_mutex);
+}
+
+void live_pcap_get_stats(live_pcap_stats_t *stats_out){
+    if(clients_mutex == NULL){
+        memset(stats_out, 0, sizeof(live_pcap_stats_t));
+        return;
+    }
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    memcpy(stats_out, &stats, sizeof(live_pcap_stats_t));
+    xSemaphoreGive(clients_mutex);
+}
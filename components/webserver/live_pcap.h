@@ -0,0 +1,63 @@
+/**
+ * @file live_pcap.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Live PCAP stream of captured frames for \c /capture/live.pcap endpoint
+ *
+ * Client receives PCAP global header followed by record of every frame appended to Capture Store, as it's captured,
+ * in chunked response that never ends. Every client has its own bounded buffer of CONFIG_WEBSERVER_LIVE_PCAP_BUFFER_SIZE bytes.
+ * Frames that don't fit into the buffer of slow client are dropped whole and counted, so PCAP stream stays valid.
+ */
+#ifndef LIVE_PCAP_H
+#define LIVE_PCAP_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/**
+ * @brief Statistics of live PCAP stream since boot
+ */
+typedef struct {
+    uint32_t clients;   ///< currently connected clients
+    uint32_t frames;    ///< frames queued for clients
+    uint32_t dropped;   ///< frames dropped because client buffer was full
+} live_pcap_stats_t;
+
+/**
+ * @brief Initialises live PCAP stream for given server. Sets Capture Store frame listener.
+ *
+ * @param server running webserver
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM
+ */
+esp_err_t live_pcap_init(httpd_handle_t server);
+
+/**
+ * @brief Turns request into live PCAP client.
+ *
+ * Response headers and PCAP global header are sent directly to the socket and the socket is kept open after the handler returns.
+ *
+ * @param req \c /capture/live.pcap request
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if maximum number of clients is reached or buffer can't be allocated,
+ * ESP_FAIL if socket send failed
+ */
+esp_err_t live_pcap_add_client(httpd_req_t *req);
+
+/**
+ * @brief Forgets closed socket. Called from session close callback of the server.
+ *
+ * @param sockfd closed socket
+ */
+void live_pcap_remove_client(int sockfd);
+
+/**
+ * @brief Copies statistics of live PCAP stream.
+ *
+ * @param stats output parameter
+ */
+void live_pcap_get_stats(live_pcap_stats_t *stats);
+
+#endif
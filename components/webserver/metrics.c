@@ -0,0 +1,342 @@
+/**
+ * @file metrics.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements Prometheus metrics of device health and capture pipeline
+ *
+ * Request latencies are recorded by wrapper registered instead of every URI handler. Wrapper, latency histograms
+ * and metrics rendering run only in httpd task, so they need no locking. Other values are read from their owners on every scrape.
+ */
+#include "metrics.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "wifi_controller.h"
+#include "frame_analyzer.h"
+#include "capture_store.h"
+#include "run_arena.h"
+#include "attack_timing.h"
+#include "file_manager.h"
+#include "live_pcap.h"
+
+static const char *TAG = "metrics";
+
+/**
+ * @brief Maximum number of timed URI handlers
+ */
+#define METRICS_MAX_URIS 24
+/**
+ * @brief Size of buffer collecting metric lines before they are sent as single chunk
+ */
+#define METRICS_BUFFER_SIZE 1024
+/**
+ * @brief Maximum length of single metric line
+ */
+#define METRICS_LINE_MAX_LENGTH 160
+/**
+ * @brief Metric name prefix
+ */
+#define METRICS_PREFIX "wifi_pentest_"
+
+/**
+ * @brief Upper bounds of request latency histogram buckets in microseconds, the last bucket is +Inf
+ * @{
+ */
+static const uint32_t latency_bounds_us[] = { 1000, 5000, 25000, 100000, 500000, 2500000 };
+#define LATENCY_BUCKET_COUNT (sizeof(latency_bounds_us) / sizeof(latency_bounds_us[0]) + 1)
+static const char *latency_bounds_label[] = { "0.001", "0.005", "0.025", "0.1", "0.5", "2.5", "+Inf" };
+//@}
+
+/**
+ * @brief Tasks whose stack high-water marks are exposed
+ */
+static const char *stack_tasks[] = { "httpd", "attack_ctrl", "ap_scanner", "sys_evt", "esp_timer", "wifi", "tiT", "ipc0", "ipc1" };
+
+/**
+ * @brief Heap capabilities whose state is exposed
+ */
+static const struct {
+    const char *name;
+    uint32_t caps;
+} heap_caps[] = {
+    { "default", MALLOC_CAP_DEFAULT },
+    { "internal", MALLOC_CAP_INTERNAL },
+    { "dma", MALLOC_CAP_DMA }
+};
+
+/**
+ * @brief Timed URI handler. Owned by httpd task.
+ */
+typedef struct {
+    const httpd_uri_t *uri;
+    uint32_t buckets[LATENCY_BUCKET_COUNT]; ///< non-cumulative counts, made cumulative when rendered
+    uint32_t failures;                      ///< requests whose handler didn't return ESP_OK
+    uint64_t sum_us;
+} uri_metrics_t;
+
+static uri_metrics_t uri_metrics[METRICS_MAX_URIS];
+static httpd_uri_t timed_uris[METRICS_MAX_URIS];
+static unsigned uri_count = 0;
+
+/**
+ * @brief Lines of metrics response waiting to be sent as single chunk
+ */
+typedef struct {
+    httpd_req_t *req;
+    esp_err_t err;      ///< first error of httpd_resp_send_chunk(), nothing is sent after it
+    size_t len;
+    char data[METRICS_BUFFER_SIZE];
+} metrics_writer_t;
+
+static metrics_writer_t writer;
+
+static void writer_flush(){
+    if((writer.err == ESP_OK) && (writer.len > 0)){
+        writer.err = httpd_resp_send_chunk(writer.req, writer.data, writer.len);
+    }
+    writer.len = 0;
+}
+
+/**
+ * @brief Appends formatted line to response
+ */
+static void writer_printf(const char *format, ...){
+    if(METRICS_BUFFER_SIZE - writer.len < METRICS_LINE_MAX_LENGTH){
+        writer_flush();
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(&writer.data[writer.len], METRICS_LINE_MAX_LENGTH, format, args);
+    va_end(args);
+    if(length > 0){
+        writer.len += (length < METRICS_LINE_MAX_LENGTH) ? length : METRICS_LINE_MAX_LENGTH - 1;
+    }
+}
+
+/**
+ * @brief Appends HELP and TYPE lines of metric
+ */
+static void write_meta(const char *name, const char *type, const char *help){
+    writer_printf("# HELP " METRICS_PREFIX "%s %s\n", name, help);
+    writer_printf("# TYPE " METRICS_PREFIX "%s %s\n", name, type);
+}
+
+static const char *method_name(httpd_method_t method){
+    switch(method){
+        case HTTP_GET:
+            return "GET";
+        case HTTP_POST:
+            return "POST";
+        case HTTP_DELETE:
+            return "DELETE";
+        case HTTP_HEAD:
+            return "HEAD";
+        default:
+            return "OTHER";
+    }
+}
+
+/**
+ * @brief Wrapper registered instead of every timed URI handler.
+ * @param req request whose user_ctx points to uri_metrics_t
+ */
+static esp_err_t timed_handler(httpd_req_t *req){
+    uri_metrics_t *metrics = (uri_metrics_t *) req->user_ctx;
+    req->user_ctx = metrics->uri->user_ctx;
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = metrics->uri->handler(req);
+    uint32_t duration_us = esp_timer_get_time() - start;
+
+    unsigned bucket = 0;
+    while((bucket < LATENCY_BUCKET_COUNT - 1) && (duration_us > latency_bounds_us[bucket])){
+        bucket++;
+    }
+    metrics->buckets[bucket]++;
+    metrics->sum_us += duration_us;
+    if(ret != ESP_OK){
+        metrics->failures++;
+    }
+    return ret;
+}
+
+esp_err_t metrics_register_uri_handler(httpd_handle_t server, const httpd_uri_t *uri){
+    // frames of WebSocket session are dispatched to the handler directly, so wrapper couldn't find its metrics
+    if(uri->is_websocket){
+        return httpd_register_uri_handler(server, uri);
+    }
+    if(uri_count >= METRICS_MAX_URIS){
+        ESP_LOGE(TAG, "Too many URI handlers, %s is not registered", uri->uri);
+        return ESP_ERR_NO_MEM;
+    }
+    uri_metrics_t *metrics = &uri_metrics[uri_count];
+    httpd_uri_t *timed_uri = &timed_uris[uri_count];
+    metrics->uri = uri;
+    memcpy(timed_uri, uri, sizeof(httpd_uri_t));
+    timed_uri->handler = timed_handler;
+    timed_uri->user_ctx = metrics;
+    esp_err_t err = httpd_register_uri_handler(server, timed_uri);
+    if(err == ESP_OK){
+        uri_count++;
+    }
+    return err;
+}
+
+static void write_heap(){
+    write_meta("heap_free_bytes", "gauge", "Free heap per capability");
+    for(unsigned i = 0; i < sizeof(heap_caps) / sizeof(heap_caps[0]); i++){
+        writer_printf(METRICS_PREFIX "heap_free_bytes{caps=\"%s\"} %u\n", heap_caps[i].name, heap_caps_get_free_size(heap_caps[i].caps));
+    }
+    write_meta("heap_min_free_bytes", "gauge", "Minimal free heap since boot per capability");
+    for(unsigned i = 0; i < sizeof(heap_caps) / sizeof(heap_caps[0]); i++){
+        writer_printf(METRICS_PREFIX "heap_min_free_bytes{caps=\"%s\"} %u\n", heap_caps[i].name, heap_caps_get_minimum_free_size(heap_caps[i].caps));
+    }
+    write_meta("heap_largest_free_block_bytes", "gauge", "Largest free heap block per capability");
+    for(unsigned i = 0; i < sizeof(heap_caps) / sizeof(heap_caps[0]); i++){
+        writer_printf(METRICS_PREFIX "heap_largest_free_block_bytes{caps=\"%s\"} %u\n", heap_caps[i].name, heap_caps_get_largest_free_block(heap_caps[i].caps));
+    }
+}
+
+static void write_stacks(){
+    write_meta("task_stack_high_water_bytes", "gauge", "Minimal free stack since task start");
+    for(unsigned i = 0; i < sizeof(stack_tasks) / sizeof(stack_tasks[0]); i++){
+        TaskHandle_t task = xTaskGetHandle(stack_tasks[i]);
+        if(task != NULL){
+            writer_printf(METRICS_PREFIX "task_stack_high_water_bytes{task=\"%s\"} %u\n", stack_tasks[i], uxTaskGetStackHighWaterMark(task));
+        }
+    }
+}
+
+static void write_pipeline(){
+    wifictl_sniffer_counters_t sniffer;
+    wifictl_sniffer_get_counters(&sniffer);
+    write_meta("sniffer_frames_total", "counter", "Frames captured by sniffer per type");
+    writer_printf(METRICS_PREFIX "sniffer_frames_total{type=\"data\"} %u\n", sniffer.data);
+    writer_printf(METRICS_PREFIX "sniffer_frames_total{type=\"mgmt\"} %u\n", sniffer.mgmt);
+    writer_printf(METRICS_PREFIX "sniffer_frames_total{type=\"ctrl\"} %u\n", sniffer.ctrl);
+
+    frame_analyzer_counters_t analyzer;
+    frame_analyzer_get_counters(&analyzer);
+    write_meta("analyzer_frames_total", "counter", "Data frames passing frame analyzer stages");
+    writer_printf(METRICS_PREFIX "analyzer_frames_total{stage=\"received\"} %u\n", analyzer.frames);
+    writer_printf(METRICS_PREFIX "analyzer_frames_total{stage=\"bssid_matched\"} %u\n", analyzer.bssid_matched);
+    writer_printf(METRICS_PREFIX "analyzer_frames_total{stage=\"eapol_key\"} %u\n", analyzer.eapol_key);
+    write_meta("analyzer_pmkids_total", "counter", "PMKIDs parsed by frame analyzer");
+    writer_printf(METRICS_PREFIX "analyzer_pmkids_total %u\n", analyzer.pmkids);
+    write_meta("analyzer_post_failures_total", "counter", "Frame analyzer results dropped by event loop");
+    writer_printf(METRICS_PREFIX "analyzer_post_failures_total %u\n", analyzer.post_failures);
+
+    write_meta("capture_frames", "gauge", "Frames stored by current run");
+    writer_printf(METRICS_PREFIX "capture_frames %u\n", capture_store_get_frame_count());
+
+    live_pcap_stats_t live;
+    live_pcap_get_stats(&live);
+    write_meta("live_pcap_clients", "gauge", "Connected live PCAP clients");
+    writer_printf(METRICS_PREFIX "live_pcap_clients %u\n", live.clients);
+    write_meta("live_pcap_frames_total", "counter", "Frames queued for live PCAP clients");
+    writer_printf(METRICS_PREFIX "live_pcap_frames_total %u\n", live.frames);
+    write_meta("live_pcap_dropped_frames_total", "counter", "Frames dropped because live PCAP client buffer was full");
+    writer_printf(METRICS_PREFIX "live_pcap_dropped_frames_total %u\n", live.dropped);
+}
+
+static void write_http(){
+    write_meta("http_request_duration_seconds", "histogram", "Duration of URI handlers");
+    for(unsigned i = 0; i < uri_count; i++){
+        const uri_metrics_t *metrics = &uri_metrics[i];
+        const char *method = method_name(metrics->uri->method);
+        uint32_t cumulative = 0;
+        for(unsigned bucket = 0; bucket < LATENCY_BUCKET_COUNT; bucket++){
+            cumulative += metrics->buckets[bucket];
+            writer_printf(METRICS_PREFIX "http_request_duration_seconds_bucket{uri=\"%s\",method=\"%s\",le=\"%s\"} %u\n",
+                metrics->uri->uri, method, latency_bounds_label[bucket], cumulative);
+        }
+        writer_printf(METRICS_PREFIX "http_request_duration_seconds_sum{uri=\"%s\",method=\"%s\"} %llu.%06llu\n",
+            metrics->uri->uri, method, metrics->sum_us / 1000000, metrics->sum_us % 1000000);
+        writer_printf(METRICS_PREFIX "http_request_duration_seconds_count{uri=\"%s\",method=\"%s\"} %u\n",
+            metrics->uri->uri, method, cumulative);
+    }
+    write_meta("http_request_failures_total", "counter", "Requests whose handler failed");
+    for(unsigned i = 0; i < uri_count; i++){
+        writer_printf(METRICS_PREFIX "http_request_failures_total{uri=\"%s\",method=\"%s\"} %u\n",
+            uri_metrics[i].uri->uri, method_name(uri_metrics[i].uri->method), uri_metrics[i].failures);
+    }
+}
+
+static void write_storage(){
+    // results partition is mounted by session restore, nothing to report before it
+    uint32_t total = file_manager_get_total_space();
+    if(total > 0){
+        write_meta("results_partition_bytes", "gauge", "Size of results partition");
+        writer_printf(METRICS_PREFIX "results_partition_bytes %u\n", total);
+        write_meta("results_partition_free_bytes", "gauge", "Free space on results partition");
+        writer_printf(METRICS_PREFIX "results_partition_free_bytes %u\n", file_manager_get_free_space());
+        write_meta("results_files", "gauge", "Saved result files in results index");
+        writer_printf(METRICS_PREFIX "results_files %u\n", file_manager_count_files(NULL));
+    }
+
+    run_arena_stats_t arena;
+    run_arena_get_stats(&arena);
+    write_meta("run_arena_bytes", "gauge", "Run arena size, usage and high-water mark");
+    writer_printf(METRICS_PREFIX "run_arena_bytes{kind=\"size\"} %u\n", arena.size);
+    writer_printf(METRICS_PREFIX "run_arena_bytes{kind=\"used\"} %u\n", arena.used);
+    writer_printf(METRICS_PREFIX "run_arena_bytes{kind=\"high_water\"} %u\n", arena.high_water);
+    write_meta("run_arena_failures_total", "counter", "Run arena allocations that didn't fit");
+    writer_printf(METRICS_PREFIX "run_arena_failures_total %u\n", arena.failures);
+}
+
+static void write_attack(){
+    wifictl_sta_reconnect_stats_t reconnect;
+    wifictl_sta_reconnect_get_stats(&reconnect);
+    write_meta("sta_reconnect_attempts", "gauge", "STA association attempts of current run per outcome");
+    writer_printf(METRICS_PREFIX "sta_reconnect_attempts{outcome=\"started\"} %u\n", reconnect.attempts);
+    writer_printf(METRICS_PREFIX "sta_reconnect_attempts{outcome=\"m1\"} %u\n", reconnect.m1_count);
+    writer_printf(METRICS_PREFIX "sta_reconnect_attempts{outcome=\"timeout\"} %u\n", reconnect.timeouts);
+    writer_printf(METRICS_PREFIX "sta_reconnect_attempts{outcome=\"failure\"} %u\n", reconnect.failures);
+    write_meta("sta_reconnect_m1_latency_seconds", "gauge", "Attempt start to EAPoL M1 latency of current run");
+    writer_printf(METRICS_PREFIX "sta_reconnect_m1_latency_seconds{kind=\"last\"} %u.%06u\n", reconnect.last_latency_us / 1000000, reconnect.last_latency_us % 1000000);
+    writer_printf(METRICS_PREFIX "sta_reconnect_m1_latency_seconds{kind=\"min\"} %u.%06u\n", reconnect.min_latency_us / 1000000, reconnect.min_latency_us % 1000000);
+    writer_printf(METRICS_PREFIX "sta_reconnect_m1_latency_seconds{kind=\"max\"} %u.%06u\n", reconnect.max_latency_us / 1000000, reconnect.max_latency_us % 1000000);
+
+    static const char *phase_names[ATTACK_PHASE_COUNT] = { "radio_setup", "first_eapol", "complete_pair", "pmkid", "flash_save" };
+    static attack_timing_histogram_t histograms[ATTACK_PHASE_COUNT];
+    attack_timing_get_histograms(histograms);
+    write_meta("attack_phase_samples", "gauge", "Runs that reached attack phase within timing window");
+    for(unsigned i = 0; i < ATTACK_PHASE_COUNT; i++){
+        writer_printf(METRICS_PREFIX "attack_phase_samples{phase=\"%s\"} %u\n", phase_names[i], histograms[i].samples);
+    }
+    write_meta("attack_phase_seconds", "gauge", "Minimal and maximal duration of attack phase within timing window");
+    for(unsigned i = 0; i < ATTACK_PHASE_COUNT; i++){
+        if(histograms[i].samples == 0){
+            continue;
+        }
+        writer_printf(METRICS_PREFIX "attack_phase_seconds{phase=\"%s\",kind=\"min\"} %u.%06u\n", phase_names[i], histograms[i].min_us / 1000000, histograms[i].min_us % 1000000);
+        writer_printf(METRICS_PREFIX "attack_phase_seconds{phase=\"%s\",kind=\"max\"} %u.%06u\n", phase_names[i], histograms[i].max_us / 1000000, histograms[i].max_us % 1000000);
+    }
+}
+
+esp_err_t metrics_send(httpd_req_t *req){
+    writer.req = req;
+    writer.err = ESP_OK;
+    writer.len = 0;
+
+    write_meta("uptime_seconds", "counter", "Time since boot");
+    writer_printf(METRICS_PREFIX "uptime_seconds %lld\n", esp_timer_get_time() / 1000000);
+    write_heap();
+    write_stacks();
+    write_pipeline();
+    write_http();
+    write_storage();
+    write_attack();
+    writer_flush();
+    return writer.err;
+}
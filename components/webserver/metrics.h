@@ -0,0 +1,42 @@
+/**
+ * @file metrics.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Device health and pipeline counters in Prometheus text exposition format for \c /metrics endpoint
+ *
+ * Exposed metrics:
+ * - heap free, minimal free and largest free block per capability (default, internal, DMA)
+ * - stack high-water marks of known tasks
+ * - sniffer frames per type, frame analyzer stages, captured frames, live PCAP clients and dropped frames
+ * - request latency histogram and failures per URI handler (except WebSocket)
+ * - results partition usage, run arena usage, STA reconnect statistics and attack phase timing window
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/**
+ * @brief Registers URI handler whose requests are timed.
+ *
+ * Handler is called through wrapper that measures its duration, \c req->user_ctx still points to \c uri->user_ctx.
+ * WebSocket handlers are registered without timing.
+ *
+ * @param server running webserver
+ * @param uri URI handler, it must stay valid while the server runs
+ * @return esp_err_t result of httpd_register_uri_handler(), ESP_ERR_NO_MEM if there are more handlers than METRICS_MAX_URIS
+ */
+esp_err_t metrics_register_uri_handler(httpd_handle_t server, const httpd_uri_t *uri);
+
+/**
+ * @brief Sends all metrics as chunked text response.
+ *
+ * @param req \c /metrics request
+ * @return esp_err_t ESP_OK on success, otherwise error of httpd_resp_send_chunk()
+ */
+esp_err_t metrics_send(httpd_req_t *req);
+
+#endif
@@ -2,588 +2,794 @@
 #define PAGE_INDEX_H
 
 // This file was generated from index.html
-// Original size: 35523 bytes
-// Compressed size: 6923 bytes
+// Original size: 46715 bytes
+// Compressed size: 9395 bytes
 
 static const unsigned char page_index[] = {
-  0x1f, 0x8b, 0x08, 0x00, 0xd5, 0x50, 0x31, 0x69, 0x02, 0xff, 0xdd, 0x3d,
-  0x6b, 0x73, 0xdb, 0x38, 0x92, 0xdf, 0xaf, 0xea, 0xfe, 0x03, 0x86, 0xa9,
-  0xac, 0xa9, 0x89, 0xde, 0xb2, 0x1c, 0x3f, 0x55, 0xe7, 0xd8, 0xce, 0xc6,
-  0x35, 0x89, 0xe3, 0x8a, 0x9d, 0xd9, 0x9d, 0xca, 0xa6, 0x52, 0x90, 0x08,
-  0x49, 0x9c, 0x50, 0xa4, 0x96, 0xa4, 0xfc, 0xb8, 0x6c, 0xfe, 0xfb, 0x75,
-  0x03, 0x20, 0x05, 0x92, 0x00, 0x49, 0xd9, 0x4e, 0xa6, 0xea, 0x92, 0x2a,
-  0x5b, 0x22, 0x81, 0x46, 0xa3, 0xdf, 0xdd, 0x68, 0xd2, 0x87, 0xbf, 0x9c,
-  0xbe, 0x3f, 0xb9, 0xfe, 0xe3, 0xf2, 0x8c, 0xcc, 0xe3, 0x85, 0x37, 0xfa,
-  0xef, 0xff, 0x3a, 0xc4, 0xdf, 0xc4, 0xa3, 0xfe, 0xec, 0xc8, 0x62, 0xbe,
-  0xc5, 0xaf, 0x30, 0xea, 0xc0, 0x6f, 0x02, 0xff, 0x0e, 0x17, 0x2c, 0xa6,
-  0x64, 0x32, 0xa7, 0x61, 0xc4, 0xe2, 0x23, 0xeb, 0xe3, 0xf5, 0xeb, 0xd6,
-  0xae, 0x95, 0xb9, 0xe7, 0xd3, 0x05, 0x3b, 0xb2, 0x6e, 0x5c, 0x76, 0xbb,
-  0x0c, 0xc2, 0xd8, 0x22, 0x93, 0xc0, 0x8f, 0x99, 0x0f, 0x63, 0x6f, 0x5d,
-  0x27, 0x9e, 0x1f, 0x39, 0xec, 0xc6, 0x9d, 0xb0, 0x16, 0xff, 0xd2, 0x74,
-  0x7d, 0x37, 0x76, 0xa9, 0xd7, 0x8a, 0x26, 0xd4, 0x63, 0x47, 0xbd, 0x14,
-  0x50, 0xec, 0xc6, 0x1e, 0x1b, 0x9d, 0x5d, 0x5d, 0x0e, 0xfa, 0xe4, 0x1f,
-  0x6e, 0xeb, 0xb5, 0x4b, 0x2e, 0x99, 0xcf, 0xe2, 0x90, 0xc6, 0x6e, 0xe0,
-  0x93, 0xeb, 0x20, 0xf0, 0x0e, 0x3b, 0x62, 0x8c, 0x9c, 0x10, 0xc5, 0xf7,
-  0xe9, 0x17, 0xfc, 0xf7, 0x2b, 0xf9, 0xb6, 0xfe, 0x82, 0xff, 0x16, 0x34,
-  0x9c, 0xb9, 0xfe, 0x3e, 0xe9, 0x1e, 0x64, 0xaf, 0x2f, 0xa9, 0xe3, 0xb8,
-  0xfe, 0xac, 0x78, 0x63, 0x1c, 0xdc, 0xb5, 0x22, 0xf7, 0x7f, 0xf9, 0xbd,
-  0x71, 0x10, 0x3a, 0x2c, 0x6c, 0xc1, 0x25, 0x65, 0xd0, 0xf7, 0xf5, 0xc7,
-  0xf5, 0xa7, 0xfd, 0x30, 0x08, 0xe2, 0xfc, 0xda, 0xad, 0xd6, 0x32, 0x74,
-  0x01, 0x81, 0xfb, 0xd6, 0x24, 0xf0, 0x82, 0x70, 0x9f, 0x3c, 0xeb, 0x4f,
-  0x06, 0x6c, 0x98, 0x5f, 0xb1, 0xd5, 0x8a, 0x18, 0x10, 0xcb, 0x51, 0x07,
-  0x0e, 0xb6, 0xf7, 0x76, 0x9d, 0x71, 0x71, 0xe0, 0x6a, 0x32, 0x61, 0x51,
-  0xb4, 0x86, 0xf7, 0x92, 0xb2, 0x9d, 0x22, 0x3c, 0x07, 0x98, 0x08, 0x78,
-  0x27, 0xa3, 0xd8, 0xcb, 0xed, 0xc9, 0x60, 0x52, 0x18, 0x75, 0x4b, 0x43,
-  0x1f, 0xb6, 0x99, 0x0e, 0x9b, 0x0e, 0xf6, 0x26, 0xbd, 0x7e, 0x61, 0x98,
-  0xe7, 0xce, 0xe6, 0x71, 0x6b, 0x3c, 0x43, 0x40, 0x93, 0x69, 0x77, 0xda,
-  0xd3, 0x2c, 0x17, 0x7e, 0x15, 0x03, 0x06, 0xdb, 0xdb, 0x7b, 0x43, 0x56,
-  0x18, 0x10, 0xb3, 0xbb, 0xb8, 0x8a, 0x06, 0x92, 0xd6, 0x21, 0x75, 0xdc,
-  0x55, 0xb4, 0x4f, 0x76, 0x97, 0x77, 0xc5, 0xdd, 0xcf, 0xa9, 0x13, 0xdc,
-  0x02, 0xcb, 0x48, 0x7f, 0x79, 0x47, 0x7a, 0x5d, 0xf8, 0x11, 0xce, 0xc6,
-  0xd4, 0xee, 0x36, 0xf9, 0xff, 0x76, 0xaf, 0x61, 0x98, 0xd2, 0x9a, 0x07,
-  0x37, 0x2c, 0xc4, 0x89, 0xdb, 0x30, 0xa7, 0x5f, 0x9c, 0x38, 0x6c, 0x54,
-  0x31, 0x78, 0x1c, 0x38, 0xf7, 0x79, 0xfe, 0x4e, 0x41, 0xc2, 0x5b, 0x53,
-  0xba, 0x70, 0xbd, 0xfb, 0x7d, 0xd2, 0xa2, 0xcb, 0xa5, 0xc7, 0x5a, 0xd1,
-  0x7d, 0x14, 0xb3, 0x45, 0x93, 0xbc, 0xf2, 0x5c, 0xff, 0xeb, 0x3b, 0x3a,
-  0xb9, 0xe2, 0xdf, 0x5f, 0xc3, 0xc8, 0x26, 0xd9, 0xba, 0x62, 0xb3, 0x80,
-  0x91, 0x8f, 0xe7, 0x5b, 0x4d, 0xf2, 0x21, 0x18, 0x07, 0x71, 0x00, 0xd7,
-  0xde, 0x30, 0xef, 0x86, 0xc5, 0xee, 0x84, 0x92, 0x0b, 0xb6, 0x62, 0x70,
-  0xe7, 0x38, 0x04, 0xcd, 0x68, 0x92, 0x88, 0xfa, 0x11, 0x08, 0x46, 0xe8,
-  0x4e, 0xf3, 0x02, 0x4a, 0x27, 0x5f, 0x67, 0x61, 0xb0, 0xf2, 0x9d, 0x7d,
-  0x02, 0x8b, 0x30, 0x1a, 0xb6, 0x66, 0x48, 0x35, 0xd0, 0x35, 0xbb, 0x37,
-  0x18, 0x3a, 0x6c, 0xd6, 0x24, 0xcf, 0x76, 0x76, 0x5e, 0x32, 0x46, 0x49,
-  0xf7, 0x39, 0x7c, 0x7e, 0xb9, 0xb3, 0x3d, 0xa6, 0x7d, 0xa0, 0x57, 0xf7,
-  0x79, 0x9e, 0x40, 0x0b, 0xd7, 0x6f, 0xcd, 0x19, 0x32, 0x78, 0x1f, 0xef,
-  0xdf, 0xcc, 0x4d, 0x5a, 0x82, 0x34, 0xcb, 0xdd, 0x93, 0xfc, 0xbc, 0xa1,
-  0xa1, 0xad, 0x72, 0xb8, 0x92, 0x92, 0x6d, 0x34, 0x0c, 0x14, 0x10, 0x0f,
-  0x8b, 0xba, 0x7a, 0x27, 0xec, 0x03, 0x20, 0xd3, 0xef, 0x16, 0x57, 0x4c,
-  0x75, 0x99, 0xd0, 0x55, 0x1c, 0x94, 0x90, 0xe5, 0x76, 0xee, 0xc6, 0xac,
-  0xa0, 0xd7, 0x19, 0xf9, 0x12, 0x68, 0x67, 0x2e, 0x36, 0x74, 0x96, 0x40,
-  0x8a, 0x9c, 0x18, 0x2e, 0xbe, 0xe5, 0xc7, 0xa1, 0x6c, 0x4d, 0x3d, 0x1c,
-  0x35, 0x77, 0x1d, 0x87, 0xf9, 0x55, 0x04, 0x40, 0xab, 0x5a, 0xdc, 0xbc,
-  0x8a, 0xbf, 0x58, 0x2d, 0x63, 0x3c, 0x1a, 0x7a, 0xea, 0xeb, 0x76, 0x9a,
-  0x32, 0x6d, 0x50, 0x24, 0x21, 0xe7, 0x13, 0x05, 0x95, 0x06, 0x32, 0x4e,
-  0x40, 0x62, 0x58, 0x58, 0x13, 0xdb, 0x79, 0x4f, 0x2b, 0xfd, 0x60, 0x29,
-  0x19, 0x48, 0x07, 0x5b, 0x68, 0x59, 0x05, 0xf4, 0x8d, 0xe3, 0x60, 0xb1,
-  0xcf, 0x75, 0xf5, 0x40, 0x33, 0xfd, 0x56, 0xca, 0xde, 0x4e, 0xb7, 0x5b,
-  0x13, 0x8f, 0x65, 0x1e, 0x8d, 0x60, 0x49, 0x27, 0x6e, 0x0c, 0x0a, 0xd8,
-  0x6d, 0xef, 0x1d, 0x18, 0x31, 0x84, 0x9b, 0xc3, 0x0c, 0x92, 0x66, 0xd1,
-  0x04, 0xaa, 0xe4, 0xd7, 0x30, 0x51, 0x54, 0x0f, 0x04, 0x5c, 0x5a, 0x68,
-  0x06, 0xd1, 0x1b, 0x4a, 0x13, 0xf4, 0x68, 0xf9, 0xcc, 0xd1, 0x58, 0x03,
-  0xd3, 0x71, 0xa3, 0xa5, 0x47, 0x81, 0x36, 0x7e, 0xe0, 0xe7, 0xa5, 0x84,
-  0xfa, 0x20, 0x5d, 0xe8, 0x56, 0xf7, 0x49, 0xe4, 0xb9, 0x0e, 0x3b, 0x0d,
-  0x6e, 0x7d, 0x20, 0xd3, 0x20, 0x22, 0x8c, 0x46, 0xac, 0x15, 0xac, 0xe2,
-  0xaa, 0x8d, 0xfe, 0xcf, 0x57, 0x76, 0x3f, 0x0d, 0xc1, 0xeb, 0x47, 0x0a,
-  0x84, 0xbc, 0x90, 0x84, 0xc1, 0x82, 0x7c, 0x53, 0x98, 0x74, 0x40, 0xc0,
-  0x9b, 0xfb, 0xd1, 0x34, 0x08, 0x01, 0x65, 0xfe, 0xd1, 0xa3, 0x31, 0xfb,
-  0xc3, 0x6e, 0xa1, 0x88, 0x34, 0x0e, 0xd4, 0x95, 0xb8, 0xbc, 0x06, 0xea,
-  0xec, 0x9e, 0x69, 0x76, 0x37, 0x3b, 0xb3, 0x84, 0x2f, 0x2d, 0x16, 0x86,
-  0x41, 0xa9, 0xf2, 0x3d, 0x9b, 0x32, 0x83, 0xed, 0xf0, 0xd8, 0x14, 0x64,
-  0x15, 0x5d, 0x48, 0x14, 0xc0, 0x86, 0x25, 0x8f, 0x54, 0x67, 0xdb, 0x28,
-  0xb3, 0x91, 0xa6, 0x81, 0x65, 0xd8, 0xba, 0xfe, 0x34, 0x28, 0x45, 0x96,
-  0x0d, 0xa6, 0xfd, 0xa9, 0xb3, 0x09, 0xbe, 0xb9, 0x60, 0xc3, 0x80, 0xf2,
-  0xb3, 0xde, 0x70, 0x67, 0x38, 0xe9, 0xd6, 0x44, 0x53, 0xc6, 0x25, 0xe5,
-  0x98, 0xee, 0x4e, 0x87, 0x6c, 0x6f, 0x23, 0x4c, 0xd5, 0x68, 0xc7, 0x84,
-  0x67, 0x9f, 0xbd, 0x74, 0x06, 0xfd, 0x2a, 0x3c, 0xa7, 0x2e, 0xf3, 0x1c,
-  0x88, 0x5c, 0x0b, 0x18, 0xf2, 0xf5, 0xf7, 0x79, 0x40, 0xa1, 0x2e, 0x9d,
-  0x04, 0x3d, 0x8d, 0x47, 0x6b, 0xe9, 0xda, 0x85, 0x0e, 0x0d, 0x0e, 0x6d,
-  0xad, 0xc1, 0xc5, 0x11, 0x59, 0xc1, 0xa4, 0xf8, 0xbf, 0x6a, 0xab, 0x1e,
-  0x9b, 0x31, 0xdf, 0xd1, 0x5a, 0x6b, 0xbd, 0xb9, 0x2d, 0x08, 0x6a, 0xa9,
-  0xe3, 0x59, 0x07, 0xce, 0x46, 0xab, 0x2e, 0x4c, 0x6e, 0xaf, 0xdd, 0xab,
-  0x61, 0x71, 0x51, 0x95, 0x5b, 0xb8, 0xc3, 0xa5, 0x3e, 0x72, 0x37, 0x99,
-  0x37, 0xfd, 0xd6, 0xe9, 0x98, 0x79, 0x79, 0x38, 0xa9, 0x11, 0x1c, 0x7b,
-  0xc1, 0xe4, 0x6b, 0x39, 0x07, 0x76, 0xcb, 0xdd, 0xd4, 0xf0, 0x81, 0x74,
-  0xd3, 0x22, 0xeb, 0xfa, 0xcb, 0x55, 0xfc, 0x29, 0xbe, 0x5f, 0x42, 0xd6,
-  0xe4, 0xaf, 0x16, 0x63, 0x16, 0x5a, 0x9f, 0x9b, 0xeb, 0xdb, 0x11, 0xf3,
-  0xd8, 0xa4, 0x20, 0xaf, 0x49, 0x78, 0x04, 0xb1, 0x9c, 0x89, 0x2f, 0x3d,
-  0x1e, 0x1c, 0x0f, 0x0d, 0x0e, 0x46, 0x15, 0xf5, 0x67, 0x8e, 0xe3, 0x3c,
-  0x5a, 0xbe, 0x55, 0x8e, 0x17, 0xc2, 0x00, 0x6e, 0xa2, 0x5d, 0xe1, 0x65,
-  0xa8, 0xe7, 0xad, 0xfd, 0xcb, 0x06, 0xc1, 0x5b, 0x6d, 0xe2, 0xed, 0x4f,
-  0x83, 0xc9, 0x2a, 0x2a, 0x90, 0x50, 0x5c, 0x2e, 0x84, 0x0d, 0xab, 0x18,
-  0x83, 0x67, 0xad, 0x6b, 0x94, 0xfb, 0xcd, 0xf0, 0xb6, 0xc2, 0x6a, 0xaa,
-  0xb1, 0x62, 0x97, 0xff, 0x1f, 0x24, 0x49, 0xc6, 0xb0, 0xdf, 0x04, 0x76,
-  0xc0, 0x8f, 0x7e, 0x6f, 0xaf, 0x49, 0x72, 0x59, 0x8a, 0x5e, 0x29, 0xc6,
-  0xb1, 0x6f, 0x8e, 0x1f, 0x90, 0x7f, 0x83, 0xae, 0x91, 0xbd, 0xe6, 0xfd,
-  0x3c, 0x15, 0x53, 0xab, 0x4c, 0xc9, 0x2a, 0x8c, 0x90, 0x6e, 0xcb, 0xc0,
-  0xcd, 0xc5, 0x97, 0x9b, 0x48, 0x44, 0xaa, 0xb5, 0xae, 0x8f, 0x7c, 0x6a,
-  0xe9, 0x94, 0x97, 0x07, 0xb3, 0x0e, 0x30, 0x26, 0x94, 0x81, 0x8c, 0x66,
-  0xef, 0x9b, 0x07, 0xbc, 0x48, 0xfd, 0x44, 0x95, 0xab, 0x83, 0xf4, 0x7a,
-  0xde, 0xb4, 0x96, 0x4c, 0xab, 0x0b, 0xef, 0xf3, 0x8c, 0xb5, 0xd4, 0x9f,
-  0xf6, 0xf7, 0x76, 0xbb, 0xe3, 0x3d, 0x1d, 0x79, 0x8b, 0xc1, 0x55, 0x1f,
-  0x63, 0xab, 0x7a, 0xd9, 0x8d, 0xc8, 0x95, 0x6b, 0xc9, 0x68, 0x1d, 0xb7,
-  0x5f, 0xdf, 0x93, 0xd7, 0xa7, 0x91, 0x84, 0x56, 0x87, 0x46, 0xfd, 0xbd,
-  0xbd, 0xe1, 0x76, 0x2d, 0xa0, 0x22, 0x3a, 0xab, 0xde, 0x4a, 0x8d, 0x70,
-  0xaf, 0xfe, 0x4e, 0x04, 0xb0, 0x1a, 0x1b, 0x99, 0x74, 0x07, 0x7b, 0xfd,
-  0x71, 0x3d, 0xea, 0x24, 0x12, 0x59, 0x0a, 0x70, 0x6f, 0x48, 0x87, 0x74,
-  0xe7, 0xd1, 0x9c, 0x48, 0xd6, 0xaa, 0xb1, 0x85, 0x97, 0xd3, 0xdd, 0xc9,
-  0xae, 0x53, 0x07, 0xec, 0x3e, 0x28, 0x3f, 0x1d, 0x7b, 0xcc, 0x29, 0xc9,
-  0xf5, 0x76, 0x0c, 0x56, 0xc7, 0x0f, 0x50, 0xdd, 0x21, 0x1b, 0x67, 0x8e,
-  0x59, 0x35, 0x72, 0x76, 0xc2, 0xbc, 0x3f, 0x6d, 0x60, 0x92, 0x9a, 0xa6,
-  0xa9, 0xc7, 0xf2, 0x56, 0x78, 0x46, 0x97, 0xfa, 0x6c, 0x17, 0x86, 0xb6,
-  0x6e, 0x43, 0xbc, 0x8b, 0x3f, 0xab, 0x16, 0x8f, 0x71, 0xfb, 0xf5, 0x7d,
-  0xff, 0xda, 0x61, 0x79, 0x74, 0x19, 0x81, 0xd1, 0x4e, 0x3e, 0x19, 0x0a,
-  0x28, 0x3c, 0x07, 0xed, 0xfe, 0xf0, 0x02, 0x4a, 0x49, 0x61, 0xa4, 0xe8,
-  0x33, 0x7b, 0xe8, 0xd6, 0x4a, 0x2b, 0x7a, 0x7a, 0x4a, 0x61, 0x5d, 0xe0,
-  0xc7, 0xd4, 0x52, 0x0c, 0xeb, 0x95, 0x66, 0xf6, 0x25, 0xde, 0x07, 0x73,
-  0x9c, 0xcd, 0x3c, 0x29, 0x9f, 0xad, 0x88, 0xed, 0x6a, 0xb9, 0x64, 0xe1,
-  0xa4, 0xe8, 0x2b, 0x33, 0x75, 0x8e, 0xdd, 0x61, 0xc1, 0x61, 0x7b, 0x2c,
-  0x06, 0xbf, 0xd7, 0x8a, 0x50, 0x7b, 0x78, 0xe4, 0xde, 0x1e, 0x56, 0xc7,
-  0xd2, 0xb1, 0xb3, 0xc9, 0x46, 0xd3, 0x4a, 0xb9, 0xac, 0xf7, 0xac, 0x63,
-  0x4c, 0xc6, 0xaa, 0x69, 0xca, 0x8b, 0xab, 0x71, 0xc1, 0x7c, 0x14, 0x63,
-  0x85, 0xbe, 0x36, 0x56, 0x30, 0x47, 0x1c, 0xa5, 0xcb, 0xd5, 0xb0, 0x59,
-  0xd3, 0xdd, 0xe9, 0x5e, 0x26, 0xe3, 0xca, 0x19, 0x12, 0x7e, 0x7e, 0x61,
-  0xf7, 0xda, 0xdd, 0x1a, 0x82, 0x2a, 0x57, 0x6d, 0x8b, 0xa8, 0x94, 0x39,
-  0x35, 0xd2, 0x7a, 0xf2, 0x8b, 0xbb, 0xc0, 0xc3, 0x14, 0xea, 0xc7, 0x4f,
-  0x94, 0xe1, 0xeb, 0x4d, 0x9d, 0x17, 0x50, 0xe4, 0x6c, 0x81, 0xfe, 0x65,
-  0xb1, 0x53, 0x46, 0x22, 0xb6, 0x8d, 0xe5, 0xe1, 0xba, 0x66, 0x3f, 0x5a,
-  0xba, 0xbe, 0xa6, 0x24, 0x9c, 0x44, 0xb5, 0x83, 0xb5, 0x40, 0x4d, 0x07,
-  0xf8, 0x5f, 0x4f, 0x8f, 0x38, 0x58, 0xaa, 0x63, 0x6b, 0x86, 0xee, 0x19,
-  0xbb, 0x36, 0x2c, 0x58, 0x57, 0x69, 0x77, 0x35, 0x7b, 0x4c, 0x4a, 0xe7,
-  0x9a, 0x5b, 0x6a, 0x79, 0x0d, 0xb6, 0x46, 0x7a, 0x91, 0x2c, 0xd6, 0x43,
-  0x40, 0x3b, 0xc5, 0xe3, 0x2f, 0x93, 0x6d, 0xe6, 0xa7, 0x13, 0xb9, 0xfa,
-  0x76, 0x65, 0xf9, 0x0d, 0x57, 0xc8, 0x51, 0xae, 0xfb, 0x9c, 0x7c, 0x53,
-  0x45, 0x35, 0x0c, 0x62, 0x88, 0x05, 0xed, 0xae, 0xc3, 0x66, 0xc5, 0x32,
-  0x1b, 0xfa, 0x14, 0xed, 0xf0, 0xc1, 0x4e, 0x71, 0x82, 0x9e, 0x81, 0xcb,
-  0x30, 0x98, 0x85, 0x22, 0xc6, 0x33, 0x94, 0xf7, 0x1f, 0x2c, 0x4e, 0x15,
-  0x0b, 0x8e, 0x69, 0x58, 0xdf, 0x55, 0x26, 0x2c, 0xd3, 0x65, 0x50, 0x19,
-  0x05, 0xd4, 0x1d, 0x75, 0xe5, 0x44, 0x45, 0x63, 0x07, 0x2b, 0x5c, 0x5e,
-  0x86, 0xc9, 0x85, 0x23, 0xc9, 0x20, 0x31, 0x76, 0x21, 0x83, 0xb8, 0xdd,
-  0xbd, 0x61, 0xf5, 0x69, 0x30, 0x75, 0xbd, 0x42, 0xe1, 0x43, 0x39, 0xd8,
-  0x79, 0xbe, 0xc1, 0x19, 0xd2, 0x5e, 0x97, 0x1f, 0x21, 0xe9, 0x75, 0xa7,
-  0xa9, 0x0d, 0xe8, 0x1b, 0x25, 0x49, 0x1e, 0x67, 0x45, 0x75, 0x9a, 0xa7,
-  0x89, 0xa5, 0xb8, 0xa8, 0xb4, 0x40, 0x53, 0x16, 0x91, 0x41, 0x60, 0xfe,
-  0x5c, 0x45, 0xb1, 0x3b, 0xbd, 0x6f, 0xc9, 0xb2, 0xbd, 0x61, 0x54, 0xc9,
-  0x51, 0xc9, 0xa6, 0x87, 0x10, 0x6d, 0x20, 0xf6, 0xca, 0x8b, 0x5b, 0x13,
-  0x1a, 0x96, 0xda, 0x6f, 0x73, 0xfc, 0xf4, 0x73, 0x4a, 0x8d, 0xe6, 0xb3,
-  0xb3, 0x42, 0xe8, 0x57, 0xba, 0x4f, 0xfd, 0x51, 0x55, 0x19, 0xd3, 0x0a,
-  0x2c, 0xc1, 0xa8, 0x03, 0xd2, 0x77, 0x16, 0xdf, 0xb2, 0x82, 0x3a, 0x54,
-  0x73, 0x38, 0x7f, 0x8e, 0x54, 0xd4, 0x38, 0xb9, 0xe9, 0xb2, 0x21, 0xb9,
-  0xe0, 0xa4, 0x0e, 0x03, 0x0c, 0x29, 0x01, 0x75, 0x66, 0xcc, 0x48, 0x8d,
-  0x92, 0x4a, 0x45, 0xca, 0x19, 0xa4, 0x3e, 0x56, 0x70, 0xca, 0x79, 0xdd,
-  0x2f, 0x2d, 0xac, 0x6a, 0x63, 0xbc, 0x8d, 0x25, 0x99, 0xef, 0xe5, 0x2f,
-  0xc9, 0xe0, 0xf9, 0xc2, 0xb2, 0xf9, 0xa0, 0x7a, 0xe1, 0x4c, 0x97, 0xc2,
-  0x13, 0x2c, 0x5c, 0x75, 0xa2, 0xf2, 0xe4, 0x65, 0x9d, 0x49, 0xe0, 0xb0,
-  0xf2, 0x20, 0x73, 0x1b, 0xff, 0x1b, 0x75, 0x19, 0x24, 0x66, 0xa7, 0x4a,
-  0x60, 0x06, 0x7a, 0x79, 0x49, 0x7a, 0x13, 0xb6, 0x4e, 0x82, 0x55, 0xe8,
-  0x82, 0x22, 0x5f, 0xb0, 0xdb, 0xad, 0x26, 0x59, 0x04, 0x7e, 0xc0, 0xd5,
-  0xb2, 0xf4, 0xbc, 0xb4, 0xba, 0x78, 0xbf, 0x0c, 0xcb, 0x37, 0xa6, 0xed,
-  0xf4, 0x48, 0x9b, 0x52, 0x74, 0x0e, 0xb6, 0x46, 0x8a, 0xf1, 0x80, 0xfc,
-  0xb3, 0x75, 0xb7, 0xaf, 0xeb, 0x18, 0xd8, 0xcc, 0x24, 0xe2, 0x66, 0xab,
-  0x58, 0xa9, 0xa9, 0x3f, 0xca, 0xed, 0xba, 0xfe, 0x9c, 0x85, 0x6e, 0x5c,
-  0xa7, 0x09, 0x49, 0x2f, 0xbc, 0x90, 0x25, 0xfb, 0x18, 0xa6, 0xb7, 0xb0,
-  0xaf, 0x24, 0xda, 0xbc, 0x24, 0x31, 0x34, 0x7a, 0x84, 0x42, 0x2c, 0x52,
-  0x0b, 0x01, 0x5a, 0x38, 0x60, 0x82, 0x95, 0xf1, 0x84, 0x76, 0x03, 0x86,
-  0x3e, 0x89, 0x91, 0xa9, 0x5b, 0x08, 0xde, 0x5c, 0x7c, 0x2a, 0xe3, 0xd5,
-  0xaa, 0xf4, 0xbd, 0x46, 0xa9, 0xbb, 0x1e, 0xad, 0x1f, 0x52, 0xe9, 0xfc,
-  0xb9, 0xd5, 0x60, 0xb4, 0xaa, 0x10, 0x42, 0xba, 0x8e, 0x51, 0x32, 0xf1,
-  0x66, 0x5e, 0x32, 0xe1, 0x52, 0x0b, 0x9c, 0xff, 0x12, 0xf1, 0x42, 0xa6,
-  0xaf, 0x16, 0x7e, 0x84, 0xd1, 0xef, 0x92, 0xd1, 0xd8, 0x46, 0x8d, 0x85,
-  0xb8, 0x36, 0x6e, 0x62, 0x97, 0xd2, 0x82, 0xde, 0xd9, 0xbc, 0x25, 0xa8,
-  0x49, 0x7a, 0xd3, 0x62, 0xc0, 0xf9, 0x44, 0x32, 0xce, 0x77, 0x81, 0xe1,
-  0xc8, 0xe6, 0x45, 0x81, 0xa7, 0xb5, 0x5c, 0x4f, 0x9b, 0xde, 0xaf, 0xb7,
-  0xb5, 0xf9, 0x01, 0x69, 0x55, 0xdc, 0x61, 0x4c, 0xf3, 0x35, 0xd1, 0x5b,
-  0x8d, 0xaa, 0x93, 0x82, 0x6b, 0xfb, 0x86, 0x7a, 0x2b, 0xf6, 0xc3, 0xce,
-  0xb1, 0x6f, 0x81, 0xc4, 0xad, 0x71, 0xc8, 0xe8, 0x57, 0xd8, 0x38, 0xfe,
-  0xc2, 0xb2, 0x71, 0x65, 0xce, 0xbd, 0x60, 0x8e, 0x4b, 0x89, 0xad, 0x74,
-  0xaa, 0xbd, 0xdc, 0xd9, 0x05, 0x75, 0x2a, 0xd6, 0x2d, 0x8a, 0xed, 0x82,
-  0x59, 0x31, 0x29, 0x86, 0x78, 0xb9, 0x9c, 0x3c, 0xfb, 0xcd, 0xd4, 0x9a,
-  0x54, 0x25, 0x7b, 0xa5, 0x40, 0x8d, 0xbd, 0x5d, 0x85, 0xa3, 0xfc, 0x22,
-  0xe3, 0x4b, 0x01, 0x6b, 0xeb, 0xd7, 0x15, 0x21, 0x46, 0x35, 0xd0, 0x79,
-  0x53, 0x53, 0x95, 0x2c, 0x50, 0x55, 0x73, 0x88, 0x5f, 0x4e, 0xd9, 0x72,
-  0xd7, 0x9a, 0x56, 0xef, 0x1d, 0x37, 0x64, 0x13, 0x61, 0xcd, 0x85, 0xa9,
-  0xda, 0x68, 0x11, 0xe3, 0x69, 0xc2, 0xd3, 0xc1, 0xd7, 0x41, 0x36, 0x17,
-  0x42, 0x2a, 0x0b, 0x3a, 0xa2, 0x80, 0x61, 0x34, 0x16, 0xe8, 0x62, 0xf5,
-  0xf5, 0x49, 0x09, 0xee, 0xb0, 0x93, 0x34, 0x67, 0x1f, 0x76, 0x64, 0x23,
-  0xf9, 0x21, 0x57, 0x8b, 0xc0, 0x7f, 0x0b, 0xd4, 0x3e, 0xb2, 0x66, 0x2c,
-  0xbe, 0x8a, 0x69, 0xbc, 0x8a, 0xec, 0x46, 0xda, 0x00, 0xee, 0xb8, 0x37,
-  0x64, 0xe2, 0xd1, 0x28, 0x3a, 0xb2, 0xd2, 0x3a, 0x92, 0xa5, 0xf4, 0x77,
-  0x1f, 0x0a, 0x91, 0x1d, 0x65, 0x91, 0x3a, 0x9c, 0xf7, 0x2a, 0x9a, 0xc6,
-  0x61, 0x40, 0x6e, 0xca, 0x72, 0x74, 0x19, 0x06, 0x53, 0x88, 0x36, 0x60,
-  0x10, 0xf5, 0xe4, 0xc4, 0x2b, 0x36, 0x81, 0x40, 0x39, 0xbe, 0x27, 0xd7,
-  0x0c, 0xd2, 0x58, 0x48, 0x4f, 0x2e, 0xc1, 0x35, 0xa1, 0x03, 0x3d, 0xec,
-  0x2c, 0x55, 0x2c, 0x3a, 0x05, 0x34, 0x94, 0x9b, 0xb9, 0x3d, 0x80, 0xd2,
-  0x5a, 0xf9, 0xc5, 0x71, 0x88, 0x0b, 0x24, 0xe0, 0xcd, 0x68, 0x91, 0x95,
-  0x0c, 0x17, 0x9d, 0x83, 0x4a, 0x9f, 0x9a, 0x35, 0x3a, 0xec, 0xc0, 0xd8,
-  0x51, 0x19, 0xeb, 0x0f, 0x23, 0x21, 0x36, 0x1c, 0xa0, 0xac, 0xe4, 0xa6,
-  0x10, 0x93, 0xef, 0xa3, 0xa2, 0x68, 0xa8, 0x78, 0xca, 0xea, 0xab, 0x7e,
-  0x39, 0x49, 0xae, 0xb7, 0xb2, 0x48, 0x2c, 0x3a, 0x9c, 0x49, 0xc4, 0x59,
-  0xd7, 0x6e, 0xb7, 0x81, 0x46, 0x18, 0xd4, 0x90, 0x5b, 0xea, 0xc6, 0x59,
-  0x32, 0x49, 0x29, 0x10, 0xe8, 0xd5, 0xdf, 0x03, 0x18, 0x63, 0xe7, 0x3e,
-  0xdd, 0x81, 0x10, 0x43, 0xed, 0x06, 0xe6, 0x7d, 0xc2, 0x45, 0xec, 0xc8,
-  0xd2, 0xf5, 0x0a, 0x59, 0xa3, 0xe3, 0x38, 0x06, 0xbf, 0x4d, 0x4e, 0x02,
-  0x7f, 0xea, 0xce, 0x56, 0x42, 0x1e, 0x80, 0x75, 0x7d, 0x1d, 0x2c, 0x64,
-  0x32, 0x48, 0xe6, 0xd5, 0x6a, 0xbc, 0x70, 0x63, 0xc0, 0x61, 0xe5, 0x8b,
-  0xd9, 0x76, 0xe3, 0x00, 0x02, 0x92, 0x78, 0x15, 0xfa, 0x64, 0x4a, 0x3d,
-  0x88, 0xdd, 0x74, 0x98, 0x08, 0x08, 0xb2, 0xc5, 0xcc, 0x70, 0x9f, 0x8f,
-  0x11, 0xbd, 0x59, 0xa3, 0x2b, 0xd1, 0xdb, 0x73, 0x0d, 0x58, 0xb3, 0x18,
-  0x92, 0xb2, 0x18, 0x9c, 0xd1, 0xd7, 0xc3, 0x8e, 0xbc, 0x5b, 0x32, 0x5f,
-  0x61, 0x19, 0x37, 0xb1, 0xfc, 0x48, 0x71, 0x99, 0x55, 0x11, 0xed, 0x44,
-  0x61, 0x90, 0x91, 0xba, 0x74, 0x09, 0x76, 0x2e, 0x8a, 0xab, 0x66, 0x88,
-  0x59, 0xca, 0x03, 0x20, 0xd5, 0x83, 0xc3, 0x9a, 0x23, 0x25, 0xe8, 0xd1,
-  0xd5, 0xd5, 0xf9, 0xe9, 0x61, 0x07, 0x3e, 0x6c, 0x36, 0xed, 0xd5, 0x03,
-  0xe7, 0x5d, 0x41, 0x20, 0x4f, 0xbd, 0x0d, 0x26, 0xc2, 0xd0, 0x3a, 0x5b,
-  0x42, 0x88, 0xf5, 0xc8, 0x74, 0xc8, 0xcf, 0x80, 0x40, 0xc7, 0xc4, 0xef,
-  0x0a, 0x96, 0x75, 0x38, 0xcf, 0xca, 0xa4, 0xc1, 0xa0, 0xab, 0x3a, 0x69,
-  0x49, 0xdd, 0x8f, 0x95, 0x53, 0x19, 0x7e, 0x62, 0xc2, 0xe3, 0x86, 0x4a,
-  0x19, 0x1a, 0xaf, 0x40, 0xbb, 0x7c, 0x22, 0x9a, 0xae, 0xc4, 0x17, 0x4b,
-  0x81, 0x4f, 0x94, 0xf6, 0x15, 0x0b, 0x54, 0xe9, 0xc4, 0x73, 0x27, 0x5f,
-  0x51, 0x9b, 0xa7, 0x21, 0x8b, 0xe6, 0xc7, 0x4b, 0xc5, 0xcc, 0x97, 0xfd,
-  0xfb, 0x20, 0xc6, 0x27, 0x5a, 0x11, 0x55, 0x51, 0x49, 0x20, 0xf2, 0x40,
-  0x32, 0x1d, 0x76, 0x2a, 0xb4, 0xf6, 0xf1, 0xba, 0x2e, 0x8d, 0xd0, 0x25,
-  0xc5, 0xa3, 0x1a, 0xc8, 0x21, 0xa3, 0x0d, 0xf5, 0x7c, 0xdd, 0x20, 0x59,
-  0xc9, 0x20, 0x11, 0xdd, 0xc3, 0x04, 0xd0, 0x72, 0xbe, 0xea, 0x17, 0xe4,
-  0x55, 0x6a, 0x07, 0xaf, 0xe1, 0xcb, 0x3e, 0xac, 0x8e, 0xa3, 0xaa, 0x40,
-  0xc9, 0xee, 0x43, 0x6e, 0x30, 0x14, 0x50, 0xc8, 0xd6, 0x39, 0xf6, 0xac,
-  0x1c, 0x59, 0xab, 0xa5, 0x03, 0x59, 0x5b, 0x6a, 0x5b, 0x41, 0x54, 0x5f,
-  0x73, 0xa2, 0xd8, 0xf1, 0xdc, 0x8d, 0x1a, 0x16, 0x18, 0xcd, 0x7f, 0xaf,
-  0x20, 0xa2, 0xa9, 0xa5, 0x17, 0xc1, 0x92, 0x1b, 0x7f, 0x1e, 0xf0, 0x1f,
-  0x59, 0x5d, 0x8b, 0xf0, 0x67, 0xbc, 0x8e, 0xac, 0x6b, 0x00, 0xc5, 0xe5,
-  0x8d, 0xc0, 0x6f, 0x3f, 0x00, 0x7c, 0x20, 0x57, 0x64, 0x0b, 0xcc, 0xc5,
-  0x1d, 0x72, 0xcf, 0xe2, 0xb6, 0x45, 0x92, 0x56, 0x91, 0xd1, 0x25, 0x50,
-  0xcb, 0xbd, 0x61, 0xe4, 0x5d, 0xe0, 0xbb, 0x71, 0x10, 0x82, 0xa7, 0x3a,
-  0xec, 0x08, 0xb8, 0x9b, 0x63, 0xd0, 0xb3, 0x46, 0x6f, 0xa8, 0xef, 0x40,
-  0x0a, 0xfc, 0x95, 0x91, 0x13, 0xba, 0x04, 0xf3, 0xcf, 0x1e, 0x0e, 0xad,
-  0x6f, 0x91, 0xe4, 0xcc, 0x77, 0x74, 0xf9, 0xee, 0xb7, 0xf3, 0x53, 0x22,
-  0x18, 0xf2, 0x70, 0x88, 0x03, 0x6b, 0x74, 0xca, 0x7c, 0x17, 0xc2, 0x96,
-  0x60, 0x0a, 0x31, 0x4b, 0x88, 0x4f, 0xd6, 0xd5, 0x84, 0x86, 0xfe, 0x18,
-  0x71, 0x79, 0x84, 0x5d, 0xf9, 0x09, 0x72, 0x0b, 0x9a, 0x32, 0x0f, 0x9c,
-  0x54, 0x72, 0xdf, 0xf1, 0xaf, 0x0f, 0x97, 0x5d, 0x09, 0x2e, 0x95, 0xc9,
-  0xb5, 0xd4, 0x6c, 0x4c, 0xfa, 0x35, 0x2f, 0x53, 0x20, 0xf2, 0xa8, 0x6f,
-  0x74, 0xf1, 0xfe, 0x9a, 0x1c, 0xff, 0x7e, 0x7c, 0xfe, 0xf6, 0xf8, 0xd5,
-  0xdb, 0xb3, 0xff, 0x57, 0xec, 0x88, 0xdd, 0x05, 0x0b, 0x56, 0xf1, 0xda,
-  0x92, 0x88, 0xef, 0xc4, 0x16, 0xa5, 0x88, 0xa8, 0x51, 0x97, 0x35, 0xbc,
-  0x6d, 0x97, 0x64, 0xda, 0x76, 0xb1, 0xba, 0x73, 0x64, 0x0d, 0x2d, 0x7c,
-  0xfa, 0x0b, 0x74, 0x65, 0x08, 0x9f, 0x54, 0xab, 0x23, 0x57, 0x4e, 0x25,
-  0xbf, 0xbb, 0xe6, 0x62, 0xa7, 0x52, 0x10, 0x16, 0x58, 0x76, 0x93, 0xfe,
-  0x2e, 0x57, 0xa8, 0x20, 0xaa, 0xff, 0x43, 0xf7, 0x97, 0x2f, 0x83, 0xd4,
-  0xf3, 0x55, 0x93, 0x60, 0x01, 0xe6, 0xc8, 0x61, 0xce, 0x3e, 0x11, 0xaa,
-  0x6d, 0x0f, 0x5b, 0xbd, 0x6e, 0xd4, 0x68, 0x92, 0xb5, 0x01, 0xb1, 0x77,
-  0xba, 0xad, 0x5e, 0x9f, 0x5f, 0x3c, 0x0d, 0xae, 0x88, 0x8d, 0x9f, 0x5f,
-  0x34, 0x2a, 0xe5, 0x02, 0x91, 0xff, 0xe1, 0x62, 0xb1, 0x8e, 0x0b, 0x6a,
-  0x7a, 0xff, 0x9c, 0xbf, 0x17, 0x0d, 0x8c, 0x96, 0x64, 0x69, 0xc4, 0xa3,
-  0xe7, 0x3a, 0x94, 0x7b, 0x4b, 0x57, 0xfe, 0x64, 0x2e, 0x0d, 0xe1, 0x5f,
-  0xe7, 0xe2, 0xe1, 0x26, 0xe8, 0xc5, 0x13, 0xa4, 0x2c, 0x2b, 0xdf, 0x57,
-  0xd3, 0xae, 0x92, 0xa4, 0x45, 0x21, 0x7e, 0xb1, 0x65, 0xc2, 0x98, 0x5c,
-  0xd4, 0x4c, 0x75, 0xce, 0x7d, 0x72, 0x29, 0x81, 0x1a, 0x12, 0x1d, 0x23,
-  0x0e, 0x63, 0x5a, 0x9a, 0x45, 0x68, 0xe7, 0x60, 0xd7, 0x81, 0x50, 0xd7,
-  0xdc, 0x25, 0x89, 0xab, 0xac, 0x3e, 0x74, 0x9f, 0x57, 0x07, 0x97, 0xd1,
-  0x92, 0x66, 0x48, 0xd9, 0x4a, 0x20, 0x5a, 0xa3, 0x6e, 0xa7, 0x0b, 0xbb,
-  0xc1, 0x01, 0x0f, 0x16, 0x81, 0x92, 0x7b, 0xcb, 0x3a, 0x06, 0xa2, 0x32,
-  0x40, 0x56, 0x72, 0x60, 0x4c, 0x89, 0xff, 0x08, 0x56, 0x30, 0xff, 0x9e,
-  0x78, 0x41, 0x84, 0xa7, 0x46, 0x90, 0x5b, 0x0b, 0x59, 0x71, 0x56, 0x18,
-  0x98, 0x60, 0xd3, 0x22, 0x11, 0x06, 0xae, 0x6d, 0xc2, 0x78, 0xa9, 0x95,
-  0xd6, 0xe2, 0x3e, 0x1e, 0x94, 0x5f, 0xe3, 0xd9, 0xfe, 0x86, 0xb2, 0xaa,
-  0x34, 0x3e, 0x58, 0x35, 0xc4, 0x2a, 0xd3, 0x3f, 0x50, 0x2a, 0x57, 0x20,
-  0xd9, 0x6b, 0xa4, 0x5a, 0x3c, 0xf0, 0x4b, 0xc5, 0xf9, 0x03, 0xbf, 0x58,
-  0x26, 0xca, 0x99, 0x6a, 0x8a, 0x84, 0x81, 0x6f, 0x23, 0x30, 0x57, 0x32,
-  0x2a, 0x05, 0x22, 0x07, 0x2d, 0x2d, 0xe1, 0x18, 0x4b, 0x23, 0xa6, 0xeb,
-  0x9b, 0x98, 0xd9, 0x07, 0x27, 0x57, 0x60, 0xd7, 0x92, 0x42, 0x45, 0x19,
-  0x99, 0x2f, 0xd8, 0x6d, 0xa9, 0xb1, 0x2d, 0x31, 0xb2, 0x75, 0xa5, 0x4e,
-  0x1d, 0x97, 0xf9, 0x1c, 0x4d, 0x42, 0x77, 0x99, 0x58, 0xdf, 0x1b, 0x1a,
-  0x4a, 0x44, 0xb0, 0xf6, 0xc7, 0xce, 0x20, 0x0a, 0x20, 0x47, 0xe4, 0x1b,
-  0xf9, 0x70, 0x76, 0x7c, 0xfa, 0x07, 0x98, 0x8a, 0x26, 0xf9, 0xf0, 0xf1,
-  0xe2, 0xe2, 0xfc, 0xe2, 0xef, 0xa0, 0x74, 0x4d, 0xf2, 0xfa, 0xfc, 0xe2,
-  0xfc, 0xea, 0xcd, 0xd9, 0x29, 0xd8, 0xb9, 0x26, 0xb9, 0x3e, 0x7f, 0x77,
-  0xf6, 0xfe, 0xe3, 0xf5, 0x3e, 0x19, 0x7c, 0x3f, 0xc8, 0x03, 0xc3, 0xdc,
-  0x26, 0x85, 0x75, 0x7c, 0x7d, 0x7d, 0x7c, 0xf2, 0xdb, 0x17, 0x7c, 0xb9,
-  0xc5, 0x97, 0xcb, 0xe3, 0xab, 0xab, 0xf3, 0xdf, 0xcf, 0x38, 0x64, 0xf5,
-  0xfa, 0x9b, 0xe3, 0x8b, 0xd3, 0xab, 0x37, 0xc7, 0xbf, 0x9d, 0xf1, 0x75,
-  0x32, 0x33, 0xd0, 0x8f, 0xf3, 0x05, 0xd5, 0xab, 0xa7, 0xef, 0xaf, 0x72,
-  0x0b, 0x27, 0x71, 0xe0, 0xf1, 0xf2, 0x4c, 0xe4, 0x24, 0xb0, 0x76, 0xab,
-  0xa7, 0x0c, 0x58, 0x06, 0xe9, 0x81, 0x42, 0xf2, 0xf5, 0x0b, 0x6f, 0x50,
-  0x85, 0x58, 0x06, 0xc6, 0xf6, 0xba, 0xe9, 0xe9, 0x05, 0xde, 0x96, 0x76,
-  0xef, 0x4b, 0x6e, 0x96, 0x7a, 0xb9, 0x64, 0x76, 0x36, 0x5c, 0x82, 0xfb,
-  0xea, 0x4d, 0xbc, 0xfa, 0x85, 0xf1, 0x86, 0x70, 0x27, 0x77, 0xcb, 0x61,
-  0x53, 0x0a, 0x52, 0x2e, 0x14, 0xed, 0x44, 0x1e, 0x31, 0x1c, 0x11, 0x27,
-  0x98, 0xac, 0x70, 0x4b, 0xed, 0x19, 0x8b, 0xe5, 0xee, 0x5e, 0xdd, 0x9f,
-  0x3b, 0x76, 0x62, 0x3b, 0x1a, 0x6d, 0x5e, 0x2f, 0x7c, 0x73, 0xfd, 0xee,
-  0x6d, 0x11, 0x98, 0xe0, 0x88, 0x88, 0xd9, 0xa3, 0x32, 0x60, 0xd9, 0xe8,
-  0xbc, 0xd1, 0x06, 0xcc, 0x33, 0x30, 0xc5, 0xcf, 0x29, 0x44, 0x0a, 0xdc,
-  0x76, 0x45, 0xf3, 0xe0, 0xf6, 0x0c, 0xab, 0xa2, 0xf6, 0x02, 0xfc, 0x02,
-  0x9d, 0xb1, 0xcc, 0xa9, 0x0b, 0x22, 0xc0, 0x6b, 0xa6, 0x67, 0x5e, 0xd9,
-  0x9a, 0xb2, 0xe2, 0xaa, 0x9e, 0x06, 0xc9, 0x59, 0xeb, 0x2d, 0xc1, 0x7c,
-  0x8b, 0x2f, 0xb4, 0x4f, 0x2c, 0xf2, 0x82, 0xc8, 0xd5, 0x34, 0x33, 0xb8,
-  0xe7, 0x68, 0xcb, 0xc0, 0x11, 0x67, 0xf1, 0xd0, 0xd1, 0xd2, 0x8c, 0xe4,
-  0x9a, 0x7c, 0x41, 0x17, 0x0c, 0x47, 0x15, 0xcb, 0xbc, 0x07, 0xea, 0x43,
-  0x6b, 0xb1, 0x0c, 0xaf, 0x6d, 0xbb, 0x41, 0x8e, 0x46, 0xf9, 0x02, 0xbc,
-  0x71, 0x6d, 0x2c, 0xc8, 0xab, 0x80, 0xbe, 0x37, 0xf1, 0x79, 0xc5, 0x6e,
-  0xb2, 0xd3, 0xef, 0x46, 0x9a, 0x5e, 0x89, 0x53, 0xf7, 0x9f, 0x41, 0x55,
-  0xb9, 0xd4, 0x4f, 0xa0, 0xab, 0x6c, 0x25, 0xf8, 0x51, 0x94, 0x1d, 0x54,
-  0x52, 0x56, 0x39, 0xdd, 0xc8, 0x13, 0x34, 0xf8, 0xc0, 0xfe, 0x0d, 0x70,
-  0x7d, 0xb0, 0xc9, 0xff, 0x7c, 0xf7, 0xf6, 0x4d, 0x1c, 0x2f, 0xe1, 0xc2,
-  0x8a, 0x45, 0xb1, 0xad, 0x12, 0x10, 0x47, 0xb5, 0x03, 0x7e, 0x32, 0x05,
-  0x83, 0x13, 0xb8, 0x76, 0xe1, 0xa8, 0x91, 0xab, 0x7f, 0x18, 0xd2, 0xfb,
-  0x57, 0xab, 0xe9, 0x94, 0x85, 0x30, 0x96, 0xcf, 0x04, 0x4d, 0x5d, 0x06,
-  0x7e, 0xa1, 0xe1, 0xd2, 0x9d, 0xda, 0xca, 0xe0, 0x86, 0xee, 0xcc, 0x48,
-  0xb1, 0x27, 0x58, 0xe4, 0x47, 0xd2, 0x2e, 0xf1, 0xb5, 0x3f, 0xe7, 0x7e,
-  0x6c, 0x23, 0xce, 0x1f, 0xc1, 0x0c, 0xed, 0x1e, 0x23, 0x10, 0x15, 0x54,
-  0x13, 0x2d, 0x6c, 0xaf, 0x70, 0x32, 0x9f, 0x37, 0x50, 0x58, 0xcc, 0xa9,
-  0x09, 0xaf, 0x57, 0x03, 0x9e, 0xf4, 0xce, 0x5f, 0xf0, 0x48, 0x51, 0x07,
-  0xb7, 0xb7, 0xa3, 0x01, 0xdc, 0xaf, 0x0f, 0x58, 0xb2, 0xc9, 0x84, 0xe2,
-  0xb6, 0x0e, 0x0a, 0x4c, 0x8d, 0x02, 0x90, 0x20, 0x2f, 0x98, 0xa5, 0x36,
-  0x8e, 0x13, 0xf2, 0x08, 0xa5, 0x3e, 0x43, 0xd9, 0x17, 0xc4, 0x3a, 0x50,
-  0x49, 0xa3, 0x8e, 0xe0, 0xa4, 0x52, 0x07, 0x4c, 0x82, 0x95, 0xdc, 0xa9,
-  0x3a, 0x4c, 0xa5, 0x80, 0x0e, 0x1b, 0x08, 0xef, 0xd8, 0xb1, 0xe7, 0x5d,
-  0x09, 0x7f, 0x1d, 0xd9, 0xba, 0x31, 0xd1, 0xad, 0x1b, 0x4f, 0xe6, 0xb6,
-  0x8a, 0x9a, 0x56, 0x32, 0xf8, 0xee, 0x30, 0xce, 0xcd, 0x79, 0xf0, 0xb6,
-  0xf0, 0xde, 0xe6, 0xf0, 0x03, 0xcd, 0x8c, 0x98, 0x23, 0x0a, 0x86, 0x5a,
-  0x2c, 0xd2, 0xb3, 0x73, 0x3c, 0x8d, 0x3f, 0xd8, 0x64, 0x75, 0x19, 0x31,
-  0x94, 0xaf, 0xff, 0x41, 0x78, 0xd2, 0xd2, 0xa5, 0x33, 0xac, 0xbb, 0x04,
-  0x97, 0x6b, 0x95, 0x8d, 0x56, 0x0c, 0x4a, 0xaa, 0xed, 0xcd, 0xac, 0x9f,
-  0x7f, 0xd2, 0x7d, 0xa6, 0xd1, 0x50, 0xc5, 0x46, 0xb9, 0x8f, 0xb6, 0xad,
-  0x64, 0xb8, 0xd5, 0x54, 0x45, 0xaa, 0xa9, 0x13, 0x9c, 0xfc, 0xc5, 0x27,
-  0x45, 0x3b, 0x89, 0xdb, 0xea, 0x61, 0x2d, 0x47, 0xff, 0x44, 0xa4, 0x65,
-  0xd8, 0x52, 0x81, 0x9f, 0x88, 0x3c, 0x44, 0x5c, 0x40, 0x92, 0x07, 0x66,
-  0x04, 0x02, 0xf2, 0x2c, 0xf4, 0x17, 0xf2, 0xd1, 0xff, 0xea, 0xe3, 0x4b,
-  0x50, 0xb8, 0x06, 0xb5, 0xb5, 0xb2, 0xf3, 0xbd, 0x78, 0x49, 0x1c, 0x2f,
-  0x96, 0x1c, 0xcf, 0x17, 0x9d, 0x82, 0x78, 0x89, 0x49, 0x99, 0x57, 0xc8,
-  0x48, 0xb2, 0x74, 0x2f, 0xc2, 0xc3, 0x15, 0xd0, 0x52, 0x76, 0x77, 0x42,
-  0x7d, 0x2c, 0xb3, 0x03, 0xb1, 0x26, 0x73, 0xc2, 0x4f, 0xd4, 0xdb, 0xe4,
-  0x64, 0xce, 0x60, 0x8b, 0xf1, 0x9c, 0xc6, 0xe4, 0x1e, 0xd2, 0x5a, 0x1a,
-  0xa6, 0x19, 0x2d, 0x44, 0x93, 0x71, 0x00, 0x79, 0xae, 0x0f, 0x5e, 0x9c,
-  0x07, 0xc0, 0xc7, 0x97, 0x32, 0xf5, 0xc5, 0xf6, 0x1c, 0xf4, 0x80, 0x58,
-  0x54, 0x5b, 0x0f, 0x96, 0xd9, 0xaf, 0xcc, 0x7c, 0x8b, 0x78, 0x68, 0xd5,
-  0x49, 0xf5, 0xb4, 0x06, 0x6a, 0xac, 0xa3, 0xde, 0x0d, 0xe9, 0x91, 0x54,
-  0x17, 0xeb, 0x61, 0xd2, 0xaf, 0xc4, 0x64, 0xc9, 0x7c, 0xdb, 0xfa, 0xfb,
-  0x19, 0x0a, 0xaf, 0x35, 0x07, 0xb7, 0xbe, 0xdf, 0xe9, 0xf4, 0xf6, 0xfa,
-  0xed, 0xde, 0xce, 0x6e, 0x7b, 0xbb, 0xdd, 0xeb, 0x08, 0x31, 0x81, 0x9b,
-  0x71, 0xb8, 0x62, 0x05, 0x57, 0x9f, 0x38, 0xec, 0x6b, 0xe1, 0x22, 0x2d,
-  0xee, 0x68, 0xc6, 0xdc, 0xd1, 0x58, 0xf9, 0xb1, 0x11, 0xf3, 0x1d, 0xbb,
-  0x3c, 0xfe, 0x28, 0xd8, 0x7d, 0x85, 0x20, 0x69, 0x1c, 0x07, 0x64, 0x08,
-  0xef, 0xc5, 0x69, 0x74, 0x10, 0xc2, 0x68, 0x7b, 0x4b, 0xe6, 0x75, 0x5b,
-  0x0d, 0x7c, 0x33, 0xc7, 0x19, 0x88, 0x81, 0x9d, 0x94, 0x0e, 0x8a, 0x01,
-  0x93, 0xbc, 0x23, 0x82, 0xb0, 0xb7, 0x6e, 0x14, 0xb7, 0xa9, 0xe3, 0xd8,
-  0x5b, 0xa2, 0xa0, 0xb0, 0x95, 0x21, 0x55, 0x75, 0x14, 0x9a, 0x9a, 0x67,
-  0x65, 0x91, 0x32, 0xdf, 0x65, 0x4e, 0x51, 0x64, 0x2d, 0xae, 0xa1, 0xe0,
-  0x15, 0xb2, 0x45, 0x70, 0xc3, 0x0a, 0xa8, 0xe9, 0xb1, 0xe1, 0x7e, 0x36,
-  0x29, 0xa3, 0x65, 0xf0, 0x81, 0xe0, 0x29, 0x93, 0x4b, 0x8d, 0x8e, 0x72,
-  0x89, 0x57, 0xe3, 0x9b, 0x51, 0xb5, 0x64, 0x49, 0x23, 0x91, 0x55, 0xae,
-  0x62, 0xcc, 0x49, 0xbb, 0x27, 0x42, 0x26, 0xf5, 0xa4, 0xa8, 0x52, 0x05,
-  0xf1, 0x9c, 0xc0, 0x94, 0xf0, 0x5c, 0x7a, 0x18, 0x5b, 0xcd, 0x10, 0x0d,
-  0xbd, 0x80, 0x3c, 0xfd, 0x64, 0x21, 0x36, 0xb1, 0x02, 0x5c, 0x10, 0xae,
-  0xec, 0x36, 0x3a, 0xf9, 0x5d, 0x90, 0x5f, 0x31, 0xbf, 0xac, 0x43, 0xec,
-  0x6c, 0xdd, 0xaf, 0x21, 0x63, 0x67, 0xf1, 0xcc, 0xcf, 0x91, 0xba, 0x26,
-  0x04, 0x32, 0xcf, 0xad, 0x0d, 0xd8, 0xb7, 0xae, 0xff, 0x35, 0x32, 0x29,
-  0x44, 0x06, 0x71, 0x00, 0xda, 0x51, 0x23, 0x26, 0x49, 0x5b, 0xb8, 0x9c,
-  0x09, 0xfc, 0xd5, 0x39, 0x2f, 0x5e, 0x54, 0x4a, 0x62, 0x36, 0x50, 0x79,
-  0xb4, 0x38, 0xf2, 0x6e, 0x96, 0x1a, 0xc2, 0x28, 0x05, 0x4c, 0xaf, 0x9b,
-  0xf6, 0xd6, 0x33, 0xd9, 0xb8, 0x21, 0x1e, 0x24, 0x05, 0xfd, 0x9c, 0xcc,
-  0x5d, 0xcf, 0x09, 0x99, 0xdf, 0xf6, 0x98, 0x3f, 0x43, 0x72, 0x1f, 0x41,
-  0x6a, 0x5f, 0xb0, 0x7b, 0xea, 0xf1, 0x7b, 0x51, 0x38, 0x4a, 0xd4, 0x51,
-  0xb8, 0xe3, 0x48, 0xda, 0xbe, 0x8d, 0x7d, 0x71, 0x4d, 0xb2, 0x65, 0x45,
-  0x39, 0x2f, 0xc2, 0x1b, 0x94, 0x21, 0x30, 0x3b, 0xd5, 0xd4, 0x32, 0x36,
-  0x02, 0x56, 0x8b, 0x45, 0x59, 0xad, 0x12, 0xf4, 0x79, 0xc5, 0x9f, 0x0b,
-  0x02, 0x9b, 0x6d, 0x65, 0x79, 0x29, 0xee, 0x72, 0xce, 0xac, 0xa3, 0xb1,
-  0x02, 0x8b, 0xb2, 0x30, 0xb6, 0x44, 0x29, 0x3c, 0x29, 0xfd, 0xf1, 0xab,
-  0x99, 0x67, 0x75, 0xac, 0xd1, 0x16, 0x48, 0xb8, 0x04, 0xfd, 0x02, 0xc6,
-  0x8b, 0xd2, 0xf8, 0x96, 0xca, 0x5d, 0xc2, 0x3c, 0xb0, 0x29, 0x39, 0x0c,
-  0x92, 0xc8, 0xea, 0xc1, 0x08, 0xc8, 0x47, 0x71, 0xea, 0x20, 0x60, 0xa2,
-  0x17, 0x0a, 0x50, 0x92, 0xae, 0x7f, 0xbc, 0xf8, 0xed, 0xe2, 0xfd, 0x3f,
-  0x2e, 0x32, 0x29, 0x7a, 0x26, 0x11, 0xc1, 0xc1, 0x45, 0x47, 0xbe, 0x0e,
-  0x31, 0x93, 0xa2, 0x5f, 0x5b, 0x57, 0xf0, 0x2b, 0xc6, 0x59, 0xea, 0xda,
-  0xc5, 0x6e, 0x01, 0x4b, 0x13, 0xac, 0xe9, 0xa2, 0xc6, 0xaa, 0xf5, 0xd7,
-  0x85, 0xc5, 0x72, 0x0c, 0x0a, 0x0d, 0x06, 0x3a, 0x04, 0x84, 0x68, 0xa6,
-  0x43, 0xed, 0xac, 0x92, 0x35, 0xeb, 0xe6, 0x80, 0x0f, 0xd9, 0x87, 0x28,
-  0x83, 0x56, 0x50, 0x51, 0xe9, 0x66, 0x30, 0xa3, 0x7f, 0xb9, 0xf8, 0xea,
-  0x3a, 0x3f, 0x13, 0x75, 0xac, 0xd5, 0x96, 0x23, 0x5e, 0xe8, 0x9e, 0xa8,
-  0xc3, 0x7d, 0xad, 0x50, 0x57, 0x58, 0x15, 0x71, 0x18, 0x91, 0xb5, 0x53,
-  0xaa, 0xba, 0x81, 0xfa, 0x10, 0xa3, 0xbe, 0x61, 0x2f, 0xbc, 0x50, 0xb6,
-  0x14, 0xf7, 0xa2, 0xba, 0xe9, 0x4d, 0xb8, 0x6a, 0xf6, 0xf3, 0xe5, 0x27,
-  0xf1, 0x26, 0x82, 0x23, 0x52, 0xd7, 0xd3, 0x1c, 0xe4, 0x5e, 0x62, 0x90,
-  0xd9, 0xcc, 0x16, 0xf6, 0xfd, 0x1d, 0xc6, 0x0e, 0xf6, 0x2c, 0x23, 0x5e,
-  0xd8, 0x9c, 0x52, 0x68, 0x3e, 0x2d, 0x69, 0x35, 0xbd, 0x9a, 0x50, 0xee,
-  0xef, 0x89, 0x2f, 0xfb, 0xbd, 0xf0, 0xf8, 0x8c, 0xf7, 0xfd, 0xe0, 0xf9,
-  0x59, 0x8c, 0xfa, 0x41, 0xf1, 0x99, 0x1f, 0x8f, 0x1d, 0x76, 0x62, 0x67,
-  0xc4, 0x7b, 0xf2, 0xb6, 0x8c, 0xe6, 0xf8, 0x69, 0x2b, 0x6b, 0xc5, 0xdd,
-  0x5a, 0x79, 0x39, 0xf9, 0x21, 0xc5, 0xb7, 0xf1, 0x7d, 0xcc, 0x78, 0xb1,
-  0xa9, 0xb4, 0xfa, 0x64, 0x2c, 0x60, 0x2d, 0x4f, 0x30, 0x80, 0x55, 0x0a,
-  0xfd, 0xd9, 0x06, 0xfc, 0x90, 0xd8, 0x1e, 0x64, 0x66, 0x2e, 0x1f, 0x00,
-  0xbf, 0x0e, 0xd7, 0xeb, 0xb5, 0xf1, 0xd3, 0x5b, 0x1e, 0x4e, 0x1c, 0xf0,
-  0x01, 0x2e, 0x08, 0xdc, 0x76, 0xd7, 0x58, 0x0b, 0xe2, 0xd2, 0x14, 0xaa,
-  0xa2, 0x34, 0x01, 0x9d, 0x81, 0xb4, 0x5f, 0x28, 0x82, 0xbd, 0x15, 0x87,
-  0x5b, 0xa6, 0xac, 0x9c, 0xbf, 0x09, 0x03, 0xcf, 0x0a, 0x42, 0x77, 0xbc,
-  0x8a, 0x99, 0x6d, 0xb9, 0x0e, 0x64, 0x46, 0x2e, 0x04, 0xa3, 0xdb, 0xdd,
-  0xda, 0x73, 0xe4, 0x41, 0x18, 0xe6, 0x5b, 0xe2, 0x38, 0xe6, 0x78, 0x29,
-  0xfb, 0xcf, 0x4c, 0x20, 0x4a, 0x36, 0xe2, 0x7c, 0x01, 0x9f, 0xe0, 0x94,
-  0xed, 0xc6, 0x31, 0xee, 0x46, 0x02, 0x18, 0x3f, 0x1a, 0x42, 0x08, 0x10,
-  0x1e, 0x06, 0xc0, 0x0c, 0x56, 0x22, 0x85, 0xa2, 0x74, 0xcd, 0xee, 0xe2,
-  0x53, 0x86, 0xcf, 0x31, 0x42, 0x4a, 0xb2, 0x8a, 0xa7, 0xad, 0x5d, 0x30,
-  0x4e, 0x0e, 0xbf, 0x60, 0xaf, 0xc5, 0x20, 0x5a, 0x8d, 0xb9, 0xa0, 0xd9,
-  0xc8, 0xff, 0x6e, 0x93, 0x8b, 0xc1, 0xa0, 0xdf, 0x68, 0x80, 0x5c, 0x2f,
-  0x3d, 0x3a, 0x61, 0x76, 0xe7, 0x5f, 0xdd, 0xce, 0xac, 0x49, 0xb6, 0xcc,
-  0xdc, 0x15, 0xc4, 0xcc, 0xda, 0x3d, 0x44, 0xe3, 0x3f, 0xff, 0x01, 0x93,
-  0xc1, 0xdb, 0xc7, 0x33, 0x87, 0xee, 0x7b, 0x7b, 0x7b, 0x07, 0xd6, 0xc8,
-  0x7e, 0x23, 0x9e, 0x39, 0x90, 0xbd, 0x9f, 0x8d, 0xc3, 0x0e, 0x5b, 0x64,
-  0xb4, 0xbd, 0xde, 0x7e, 0x13, 0x2e, 0x58, 0x96, 0x61, 0x2a, 0x28, 0x01,
-  0xd7, 0x81, 0x3f, 0x85, 0x0e, 0xfc, 0x09, 0x3a, 0xb0, 0x03, 0xbf, 0x5e,
-  0xbc, 0x68, 0x7c, 0x2b, 0x29, 0x21, 0x71, 0xa8, 0x2f, 0x8e, 0xc8, 0x0a,
-  0xd5, 0xf1, 0x3a, 0x78, 0xc3, 0xee, 0xd6, 0x24, 0xfb, 0xc4, 0x49, 0x34,
-  0x80, 0x1f, 0x7f, 0x7e, 0x2e, 0xab, 0x43, 0x81, 0x05, 0xc0, 0xd5, 0x86,
-  0x8d, 0x35, 0x38, 0x6b, 0xdf, 0x84, 0xe6, 0x77, 0x23, 0x6d, 0xc7, 0x05,
-  0xe2, 0x6e, 0x1d, 0x22, 0x0f, 0xb9, 0xb3, 0x90, 0x90, 0xd1, 0x53, 0x88,
-  0x6b, 0x07, 0x15, 0x70, 0x44, 0xd2, 0x86, 0x8f, 0xe6, 0xbc, 0xe6, 0x0f,
-  0x0c, 0x23, 0xb8, 0xf4, 0x19, 0xe1, 0xcd, 0xc9, 0x2f, 0x45, 0x38, 0x47,
-  0x9b, 0xbd, 0xcf, 0xa4, 0x45, 0xfa, 0xc3, 0x61, 0x89, 0xf8, 0x47, 0xbc,
-  0x43, 0xfb, 0x15, 0x0d, 0xa3, 0x32, 0xe6, 0x01, 0x09, 0xf9, 0x0a, 0x23,
-  0xd2, 0x1a, 0x82, 0x69, 0xca, 0x4e, 0xfa, 0xf4, 0x0c, 0xfe, 0x7d, 0x36,
-  0x4d, 0x4d, 0xa2, 0xe2, 0x64, 0xfe, 0x8e, 0x76, 0x7e, 0xed, 0xe9, 0x2f,
-  0x75, 0xd3, 0xcb, 0x67, 0xe7, 0x87, 0x1b, 0x47, 0x4b, 0x53, 0x90, 0x55,
-  0xa0, 0xf5, 0x64, 0x48, 0x71, 0xf9, 0x19, 0x1a, 0x47, 0x05, 0xbf, 0x38,
-  0xaf, 0x16, 0xd6, 0x46, 0x9c, 0x02, 0x5b, 0x8a, 0x8f, 0x0e, 0xf8, 0xce,
-  0x09, 0xe6, 0x91, 0xb6, 0x54, 0xd8, 0x12, 0xcb, 0x9b, 0x1b, 0x3d, 0xde,
-  0x6c, 0x38, 0x22, 0x6a, 0x1c, 0xcd, 0xfd, 0x6c, 0x66, 0x42, 0x68, 0x1a,
-  0x2b, 0xbd, 0x5b, 0x9a, 0xc6, 0x57, 0xe8, 0x8b, 0x7a, 0xbe, 0x69, 0xbd,
-  0xc6, 0x07, 0x38, 0x39, 0xd9, 0x12, 0x1f, 0x89, 0x94, 0x4b, 0x02, 0x8f,
-  0x82, 0xcb, 0x78, 0x6c, 0x09, 0xf6, 0x61, 0xc1, 0x52, 0xce, 0x32, 0xea,
-  0x5e, 0x3a, 0x68, 0x8d, 0x44, 0x15, 0x3a, 0xca, 0xc7, 0x4e, 0xfa, 0x10,
-  0x29, 0x57, 0x88, 0x7a, 0x4d, 0x5d, 0x4f, 0x54, 0x6e, 0x71, 0xfe, 0x3a,
-  0xee, 0x4a, 0x2a, 0x51, 0x71, 0x78, 0x4f, 0xe8, 0x8c, 0xba, 0x7e, 0xb6,
-  0xf0, 0xb4, 0x71, 0xb5, 0x33, 0x79, 0xd0, 0xe4, 0xe7, 0x94, 0x3b, 0x53,
-  0xf7, 0xcf, 0xbc, 0x0c, 0x23, 0x32, 0x75, 0xdf, 0xab, 0xa4, 0x75, 0xf7,
-  0xf8, 0x72, 0x1f, 0xf0, 0x62, 0x5e, 0x3b, 0x2b, 0xc2, 0x98, 0x30, 0x17,
-  0xba, 0x3a, 0x7e, 0xc1, 0xb6, 0x8e, 0x42, 0x61, 0x2f, 0x3f, 0xac, 0x58,
-  0x3c, 0xb0, 0x92, 0x31, 0x96, 0xa1, 0x2a, 0xa7, 0x6b, 0x20, 0x61, 0xea,
-  0x23, 0xa8, 0xcc, 0xcb, 0x95, 0x56, 0xf5, 0x20, 0x33, 0x32, 0x2e, 0x9f,
-  0x29, 0x4a, 0x06, 0x8a, 0x93, 0x76, 0x04, 0x24, 0xab, 0x45, 0x9f, 0xba,
-  0x9f, 0xdb, 0xf8, 0x60, 0xfb, 0x49, 0xf6, 0xcc, 0xc4, 0x90, 0x45, 0xac,
-  0x9f, 0x82, 0x22, 0xdf, 0x2a, 0xc8, 0x74, 0xa4, 0x23, 0x53, 0x86, 0xfa,
-  0x17, 0x01, 0xd0, 0x3d, 0xc5, 0xac, 0x2d, 0x33, 0x38, 0xde, 0xd7, 0x0f,
-  0x29, 0x51, 0x88, 0xd7, 0xca, 0xce, 0x26, 0xa4, 0x78, 0xca, 0xee, 0x6e,
-  0x0a, 0xb9, 0x01, 0xdf, 0xa9, 0x94, 0x5f, 0x32, 0x75, 0x43, 0xa0, 0x52,
-  0x01, 0x40, 0xe1, 0x70, 0xe5, 0xfb, 0xcf, 0x2b, 0x2f, 0x17, 0xf3, 0x93,
-  0x6c, 0xaa, 0x80, 0x01, 0xd9, 0xf1, 0xfa, 0x8a, 0x9d, 0x39, 0x4d, 0xc6,
-  0xe1, 0xab, 0x34, 0xf0, 0xaf, 0x9d, 0x09, 0xac, 0xa7, 0x00, 0xa7, 0xd5,
-  0x13, 0xf1, 0xa2, 0xc4, 0x66, 0x65, 0x5f, 0x99, 0xd8, 0xcb, 0x4c, 0xac,
-  0x6a, 0xdf, 0xe1, 0x0f, 0x86, 0x34, 0xc4, 0xd3, 0xda, 0x06, 0x80, 0xfd,
-  0x8d, 0x00, 0xa6, 0xfd, 0x40, 0x65, 0x20, 0x07, 0x9b, 0xe1, 0x98, 0x1c,
-  0xf4, 0x14, 0x61, 0x3e, 0x3c, 0x81, 0xe4, 0xf6, 0xef, 0xf2, 0xfd, 0x95,
-  0xc9, 0x00, 0x82, 0xa4, 0xb4, 0xc4, 0xfa, 0x26, 0x1b, 0xc8, 0xed, 0x9a,
-  0x81, 0x91, 0xeb, 0x4f, 0x4a, 0x27, 0x89, 0x72, 0xbf, 0xd0, 0xf1, 0xf5,
-  0x14, 0xc4, 0x30, 0x74, 0x8a, 0x71, 0x45, 0x52, 0x8e, 0x19, 0x30, 0x16,
-  0x61, 0x71, 0x5a, 0xb6, 0xcd, 0x1c, 0x98, 0x34, 0xf5, 0x2d, 0x6b, 0x15,
-  0x86, 0x46, 0xed, 0x63, 0xac, 0x59, 0x3a, 0x2e, 0xed, 0x29, 0x78, 0x10,
-  0x2f, 0xdf, 0x9c, 0x1d, 0x9f, 0x9a, 0x78, 0x89, 0x08, 0x96, 0xb2, 0xd1,
-  0x68, 0x91, 0xc5, 0x5f, 0x00, 0x12, 0x5b, 0x6c, 0x93, 0x0f, 0x78, 0x1c,
-  0xc0, 0xb3, 0x70, 0xc4, 0x2b, 0x7f, 0x14, 0x6a, 0xa4, 0xce, 0x46, 0x65,
-  0xb4, 0x5c, 0xbd, 0x67, 0x41, 0x27, 0x5f, 0xe8, 0x32, 0x1f, 0x52, 0x27,
-  0x77, 0xc0, 0xf4, 0xea, 0x6e, 0xe9, 0x52, 0xa8, 0xe4, 0xfa, 0x17, 0x74,
-  0x20, 0xba, 0x9b, 0x4b, 0x44, 0x51, 0x77, 0xc3, 0xf5, 0x1d, 0x76, 0x97,
-  0x13, 0x28, 0xe5, 0x8f, 0x33, 0xc8, 0x74, 0x4c, 0x29, 0x49, 0xec, 0xac,
-  0xeb, 0x0f, 0xbd, 0x46, 0xf1, 0x2f, 0x03, 0xf0, 0x0d, 0x65, 0x53, 0xb1,
-  0x2c, 0x21, 0x3e, 0x89, 0x15, 0x5f, 0x10, 0xf7, 0xb3, 0xc1, 0xfb, 0x26,
-  0x28, 0x25, 0x03, 0x77, 0x9e, 0x0c, 0x35, 0xa4, 0xe8, 0x5f, 0x84, 0x9b,
-  0x6e, 0xa1, 0xcf, 0x65, 0xf8, 0x6a, 0x72, 0x5a, 0x03, 0xb2, 0xbd, 0x02,
-  0xc2, 0xc9, 0x7c, 0x21, 0x0e, 0x00, 0xe4, 0x2a, 0xc6, 0x42, 0x7a, 0x1b,
-  0xff, 0xe6, 0xcb, 0xc9, 0x9c, 0x86, 0x27, 0x58, 0x54, 0xa8, 0x0d, 0xad,
-  0x64, 0xfb, 0xda, 0x5d, 0x21, 0x10, 0xa3, 0x19, 0xe7, 0x82, 0x88, 0x29,
-  0xd6, 0xa7, 0xcf, 0x39, 0x49, 0x9c, 0xac, 0xc2, 0x10, 0x15, 0x45, 0x2b,
-  0xaa, 0x95, 0x14, 0x15, 0x7d, 0x66, 0x2d, 0x81, 0x59, 0x19, 0x5d, 0x21,
-  0x44, 0xb2, 0x5d, 0xf2, 0x9c, 0xf4, 0x76, 0x1a, 0x18, 0x19, 0x75, 0xc9,
-  0xdf, 0xfe, 0x46, 0x30, 0x67, 0xec, 0xea, 0x2a, 0x0c, 0x02, 0xdb, 0xf6,
-  0x72, 0x15, 0xcd, 0xed, 0x0c, 0x7e, 0xda, 0xee, 0xb2, 0xb2, 0x0d, 0x68,
-  0xb2, 0xa0, 0xec, 0xf8, 0x47, 0xca, 0xe5, 0x34, 0x87, 0x5f, 0x3d, 0xd4,
-  0xb3, 0x1c, 0x90, 0x67, 0x1a, 0xf8, 0xc7, 0x06, 0x31, 0x23, 0x52, 0x4a,
-  0xc3, 0xe9, 0x4b, 0x84, 0xac, 0x4c, 0xfe, 0xa2, 0x4c, 0x78, 0xa1, 0x9b,
-  0x81, 0x6f, 0x8b, 0xb1, 0x46, 0xe2, 0xb1, 0xb5, 0xd1, 0xb1, 0x78, 0x9f,
-  0xdd, 0x25, 0xbe, 0x0a, 0x98, 0xbc, 0x3b, 0x3e, 0x49, 0x1e, 0x4c, 0x53,
-  0x67, 0x71, 0xb7, 0x07, 0x33, 0xd2, 0x8a, 0x09, 0x3e, 0x04, 0x44, 0xe3,
-  0x77, 0x74, 0x62, 0x0b, 0xd3, 0xd2, 0x50, 0xaa, 0x27, 0xa2, 0x4c, 0x2d,
-  0x7e, 0x3e, 0x18, 0x2b, 0xf4, 0xdf, 0x68, 0xc9, 0x1f, 0x86, 0x10, 0x18,
-  0x94, 0xa7, 0xc7, 0x88, 0x3f, 0x44, 0x6f, 0x44, 0x05, 0x91, 0xb0, 0xd7,
-  0xca, 0x2d, 0xab, 0x76, 0x23, 0x51, 0x9f, 0x13, 0x65, 0x39, 0x89, 0xd2,
-  0x13, 0xe0, 0xc2, 0x8f, 0x91, 0x22, 0xc2, 0xd3, 0xf3, 0x0a, 0x9c, 0xa4,
-  0xbc, 0xc9, 0x23, 0xef, 0x0d, 0x10, 0x28, 0x0c, 0xc8, 0x48, 0x75, 0x16,
-  0xec, 0x48, 0x7b, 0x8e, 0x9e, 0x85, 0x37, 0x1f, 0xe8, 0x1e, 0xa4, 0xe7,
-  0x7f, 0xc1, 0x47, 0xfb, 0xd2, 0x4a, 0x6b, 0x24, 0x8f, 0xf9, 0x1c, 0xf1,
-  0xa0, 0x20, 0x3e, 0xd4, 0x32, 0x28, 0xa4, 0xe9, 0x12, 0x8f, 0xa4, 0xf5,
-  0x46, 0xe0, 0xd5, 0x24, 0xae, 0x73, 0xa7, 0x6b, 0x58, 0xae, 0x20, 0xb4,
-  0xfa, 0xc8, 0x4e, 0x82, 0xac, 0xee, 0x45, 0x56, 0x96, 0xb6, 0x42, 0x98,
-  0x07, 0x1c, 0xc5, 0x61, 0xe0, 0xcf, 0xe4, 0x03, 0xcc, 0xcf, 0x90, 0x17,
-  0x80, 0x15, 0x72, 0x60, 0x1f, 0x5f, 0xf4, 0xc2, 0xef, 0x1d, 0x8e, 0xc3,
-  0x5a, 0xa0, 0xf8, 0x6b, 0xf4, 0x24, 0x42, 0xb9, 0xa7, 0x2e, 0xb3, 0x4f,
-  0x5d, 0xe1, 0xb3, 0x6d, 0x86, 0x17, 0x35, 0x29, 0xe2, 0x50, 0x51, 0xea,
-  0xac, 0x94, 0x84, 0x4c, 0x83, 0x92, 0xbe, 0x68, 0xf6, 0x78, 0xee, 0xbf,
-  0xa1, 0xd1, 0x7c, 0x42, 0x63, 0x10, 0x72, 0xd4, 0x6c, 0x2d, 0xf3, 0x1f,
-  0xc3, 0x4a, 0xf9, 0xaa, 0xc5, 0xfc, 0xdb, 0x15, 0xad, 0x7a, 0x12, 0x56,
-  0x57, 0xb8, 0xaa, 0x19, 0x27, 0xde, 0x70, 0xda, 0x35, 0x71, 0xad, 0x1a,
-  0xbf, 0xe2, 0xb2, 0x29, 0x8f, 0x7f, 0x45, 0x8e, 0x27, 0xb1, 0x9f, 0xf2,
-  0x95, 0xc7, 0x5b, 0xf2, 0x3b, 0x9a, 0xac, 0x3a, 0x32, 0xa0, 0x95, 0x96,
-  0xef, 0x8d, 0x0a, 0x8e, 0x68, 0x45, 0xa7, 0x36, 0x13, 0xd5, 0xc7, 0x13,
-  0xf8, 0xd1, 0x6e, 0x1d, 0x1d, 0x90, 0xcf, 0x77, 0x56, 0xc9, 0x8a, 0xd4,
-  0xc0, 0x0b, 0x34, 0xd6, 0x57, 0x31, 0x5b, 0x46, 0xe5, 0x5a, 0x99, 0x9b,
-  0xde, 0x6b, 0x93, 0x93, 0x60, 0x79, 0xcf, 0x9f, 0x4b, 0x4c, 0x04, 0x55,
-  0xb8, 0x20, 0x42, 0xc7, 0xc1, 0x0d, 0xab, 0x01, 0xa2, 0xdf, 0x26, 0x57,
-  0xf4, 0x86, 0x61, 0x59, 0x91, 0x92, 0xa9, 0xeb, 0x31, 0x62, 0xb3, 0xf6,
-  0xac, 0xdd, 0x14, 0xec, 0x6b, 0xc7, 0x77, 0x71, 0xa3, 0x06, 0x94, 0x01,
-  0x24, 0x48, 0x2b, 0x10, 0x22, 0xe1, 0x09, 0xe7, 0x12, 0x95, 0xd6, 0x02,
-  0xe2, 0xa8, 0xdd, 0x6e, 0x77, 0x0d, 0x8b, 0x8b, 0x17, 0x56, 0x17, 0xf1,
-  0x8b, 0x81, 0x9b, 0x95, 0xcc, 0x93, 0x5d, 0x32, 0xdf, 0x1e, 0xc4, 0x40,
-  0xd1, 0x4a, 0xfb, 0x74, 0x1c, 0xbc, 0x08, 0xa4, 0x5f, 0x20, 0x13, 0xe9,
-  0x27, 0xda, 0xe4, 0x3a, 0xbc, 0x87, 0x48, 0x13, 0x4f, 0x00, 0x23, 0xfe,
-  0xd4, 0xa8, 0x4c, 0xf5, 0x83, 0x70, 0x5d, 0x04, 0x73, 0x5c, 0xac, 0x1b,
-  0x60, 0xfd, 0x4d, 0x94, 0xc3, 0xda, 0x9b, 0x53, 0xe1, 0x21, 0x5d, 0x0d,
-  0xc9, 0x43, 0x91, 0xd9, 0xc6, 0x86, 0xf5, 0x5a, 0x35, 0xd2, 0xd9, 0xcd,
-  0x9a, 0x5a, 0xbe, 0x95, 0xc6, 0x90, 0x05, 0x73, 0xac, 0x77, 0xbd, 0xe4,
-  0x35, 0xc8, 0x65, 0xd1, 0xf1, 0x96, 0x70, 0x3c, 0xfb, 0x6a, 0xb8, 0xf2,
-  0xb0, 0x94, 0x92, 0x79, 0xc8, 0xa6, 0x47, 0x96, 0xe4, 0x5f, 0x7b, 0x09,
-  0x1f, 0x2c, 0x92, 0x40, 0x18, 0x9d, 0xca, 0x0f, 0xe4, 0xf2, 0xe4, 0xf8,
-  0x12, 0x55, 0x41, 0xbc, 0x9e, 0x60, 0x04, 0x0e, 0x81, 0xfc, 0xc3, 0xc5,
-  0x66, 0x0d, 0x8a, 0xef, 0x80, 0x12, 0x17, 0x0f, 0x3b, 0x74, 0xa3, 0xb5,
-  0xe6, 0x13, 0xf8, 0x74, 0xa7, 0x5b, 0xed, 0xcd, 0x09, 0x2c, 0xf7, 0xcf,
-  0xdc, 0x7a, 0x52, 0xc7, 0xeb, 0xae, 0x56, 0x12, 0x3b, 0xfd, 0x04, 0x73,
-  0xf7, 0x08, 0x53, 0x57, 0x34, 0x73, 0x29, 0x5d, 0xb8, 0xa9, 0xe3, 0xb4,
-  0xe1, 0xd6, 0xaa, 0x62, 0x66, 0xdf, 0x64, 0x97, 0xfa, 0x43, 0x30, 0x4b,
-  0x59, 0x2e, 0xe8, 0x6c, 0x53, 0x05, 0x78, 0x30, 0x7b, 0xef, 0x43, 0x42,
-  0x7d, 0xea, 0xdd, 0x43, 0x7a, 0x89, 0x02, 0x02, 0x7a, 0xbf, 0x96, 0x8a,
-  0x87, 0xc7, 0xb5, 0xba, 0xec, 0xf5, 0x07, 0x47, 0xb7, 0xa7, 0x34, 0xa6,
-  0x9b, 0x86, 0x37, 0x4a, 0x4a, 0x50, 0x35, 0x4b, 0x64, 0x07, 0xb8, 0x08,
-  0xb9, 0x82, 0xdd, 0x24, 0xe9, 0xc2, 0x06, 0x8b, 0x29, 0xd9, 0x84, 0x8e,
-  0x3c, 0xd8, 0x91, 0x85, 0x47, 0xd7, 0x91, 0xde, 0xdb, 0x3f, 0x20, 0x24,
-  0x40, 0x83, 0x35, 0x67, 0x77, 0x1c, 0x67, 0x4d, 0xbe, 0x5e, 0xb3, 0xe8,
-  0xc0, 0x0b, 0x08, 0x87, 0xfc, 0x4f, 0x50, 0x96, 0xd4, 0x1d, 0x78, 0xd1,
-  0x54, 0xae, 0x55, 0x9e, 0xeb, 0x7f, 0x6e, 0x88, 0x43, 0x64, 0x4d, 0xb4,
-  0x04, 0x82, 0x83, 0xb5, 0x8b, 0x41, 0x1f, 0x4b, 0x17, 0x03, 0x58, 0x44,
-  0x81, 0x68, 0xfd, 0xcb, 0xaf, 0x28, 0x38, 0x18, 0xc5, 0x0e, 0x50, 0xcf,
-  0x83, 0xc2, 0x66, 0x2f, 0x3b, 0x0e, 0xc1, 0x33, 0xd0, 0x98, 0x39, 0x0d,
-  0x6b, 0xb3, 0xd0, 0x8a, 0xc5, 0xd4, 0xf5, 0xa2, 0x92, 0x17, 0x9a, 0x55,
-  0x46, 0x4d, 0xab, 0x05, 0xff, 0x2b, 0x7f, 0xc9, 0x91, 0x6b, 0xee, 0xef,
-  0x08, 0x15, 0x5f, 0x36, 0x9b, 0x7b, 0x7f, 0xab, 0xf6, 0xbd, 0xc0, 0x85,
-  0x3f, 0x28, 0xc3, 0x51, 0xf9, 0xdd, 0x65, 0xb7, 0xe4, 0x03, 0xbd, 0x95,
-  0xfa, 0x21, 0x57, 0xae, 0xc4, 0x10, 0xdf, 0x3a, 0xae, 0xdb, 0x9f, 0x30,
-  0x93, 0xeb, 0x82, 0x41, 0x4a, 0x56, 0xa5, 0x4a, 0x00, 0x73, 0x6b, 0x88,
-  0xaf, 0x20, 0xe2, 0x5f, 0x1c, 0x12, 0x28, 0x72, 0xca, 0x3f, 0xaa, 0xfe,
-  0x5e, 0xbe, 0x7d, 0xd1, 0xb6, 0xba, 0x5d, 0x3c, 0xcb, 0xe4, 0xf7, 0xdb,
-  0x71, 0x20, 0x8a, 0x8d, 0x76, 0x6f, 0xa7, 0xd1, 0x68, 0x47, 0x9e, 0x3b,
-  0x61, 0x76, 0xab, 0x5f, 0x5e, 0x46, 0xcf, 0x14, 0x55, 0x60, 0x7a, 0x46,
-  0x79, 0xe4, 0x2a, 0xe2, 0x4e, 0x1b, 0xc6, 0x41, 0x72, 0xd4, 0x69, 0x7f,
-  0xeb, 0x7f, 0xef, 0xcc, 0x1a, 0xed, 0x3f, 0x41, 0x20, 0xec, 0xad, 0xfd,
-  0xad, 0x06, 0xac, 0xfb, 0x11, 0xdf, 0xb7, 0x78, 0x42, 0x23, 0x56, 0x71,
-  0x20, 0x6d, 0x7c, 0x3f, 0x1a, 0xf3, 0xb4, 0x8f, 0xe2, 0xd4, 0x7e, 0x38,
-  0x7e, 0xdd, 0xe9, 0x9e, 0x79, 0xd0, 0xbe, 0xd8, 0x45, 0x9d, 0x1e, 0x08,
-  0x31, 0x4f, 0x9e, 0xf4, 0x34, 0x9e, 0xac, 0x97, 0x3a, 0xfb, 0xa0, 0xa4,
-  0x18, 0x86, 0x17, 0xd7, 0x2f, 0xda, 0xb4, 0x1a, 0x3f, 0xa1, 0xa1, 0x3a,
-  0x83, 0x46, 0x3a, 0xb0, 0x06, 0x22, 0x1b, 0x9e, 0x91, 0x01, 0xcd, 0x77,
-  0x74, 0xdd, 0x94, 0xe9, 0xa9, 0x95, 0x64, 0x82, 0xfd, 0x49, 0xdf, 0xb5,
-  0x62, 0x7d, 0x08, 0x66, 0x00, 0x05, 0xfc, 0xfa, 0x0b, 0x72, 0xca, 0xe8,
-  0x2a, 0x9e, 0x13, 0x5b, 0xb6, 0xa0, 0x37, 0xac, 0xa6, 0x61, 0xce, 0xab,
-  0x10, 0x02, 0x15, 0xa0, 0x4e, 0x9c, 0x4e, 0x39, 0x9e, 0xc4, 0xa5, 0x33,
-  0x92, 0x38, 0xf7, 0xbd, 0xef, 0xdd, 0x2b, 0x0b, 0x14, 0x47, 0x7f, 0xfe,
-  0xd1, 0x5d, 0xe2, 0x59, 0xf9, 0xe0, 0x35, 0xa3, 0x1f, 0xc1, 0x94, 0x5e,
-  0xf7, 0x87, 0xb6, 0x8c, 0x67, 0x76, 0x01, 0x43, 0x7e, 0xcc, 0x1e, 0xfa,
-  0x4f, 0x2b, 0x59, 0xb5, 0xe5, 0xc9, 0x2c, 0x46, 0xc1, 0x62, 0xec, 0xfa,
-  0xd8, 0x26, 0x23, 0x4e, 0xaf, 0x1f, 0x21, 0x3f, 0xe6, 0x67, 0x6b, 0x33,
-  0xb4, 0x4d, 0x1e, 0x9c, 0x95, 0xcf, 0xd3, 0x8a, 0x96, 0x82, 0xfa, 0x2d,
-  0xf9, 0xa6, 0x96, 0xa0, 0x1c, 0x09, 0xa9, 0xfa, 0x8d, 0xb7, 0x11, 0x3c,
-  0xc8, 0x12, 0x8b, 0x6e, 0x0f, 0xa5, 0x0b, 0x39, 0x79, 0x11, 0xa0, 0x55,
-  0x3c, 0x9f, 0x57, 0x17, 0x4b, 0x8b, 0x6e, 0x69, 0xcb, 0x98, 0x00, 0xd9,
-  0x14, 0xc7, 0x49, 0x79, 0xe3, 0x8c, 0x31, 0xa1, 0x7c, 0xf7, 0xa0, 0xb1,
-  0x1f, 0xd8, 0x12, 0x03, 0x0a, 0xb4, 0x12, 0x97, 0x53, 0x11, 0x13, 0xc7,
-  0x55, 0xda, 0x21, 0xf2, 0x28, 0x57, 0x60, 0xa2, 0x1f, 0x92, 0xbe, 0xf0,
-  0xf0, 0x88, 0xd8, 0xf2, 0x68, 0x8e, 0x3f, 0x6a, 0x96, 0x67, 0x75, 0x5d,
-  0xfa, 0xa9, 0x8d, 0x7e, 0x62, 0x89, 0xb2, 0x47, 0x45, 0x21, 0x56, 0x4a,
-  0xde, 0x1f, 0x74, 0xd8, 0x91, 0xef, 0xcd, 0x85, 0xfc, 0x02, 0x22, 0x8a,
-  0xd1, 0xff, 0x01, 0x22, 0xb1, 0x98, 0x1a, 0xc3, 0x8a, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0xe5, 0x66, 0xd5, 0x6a, 0x02, 0xff, 0xdd, 0x7d,
+  0x6b, 0x73, 0xdb, 0x38, 0xb2, 0xe8, 0xf7, 0xf9, 0x15, 0x08, 0xa7, 0x66,
+  0x4c, 0xad, 0xf5, 0x96, 0xed, 0xf1, 0x53, 0x7b, 0x1c, 0xdb, 0xd9, 0xe4,
+  0x6c, 0xe2, 0xf8, 0x46, 0x9e, 0x7d, 0x54, 0x8e, 0x2b, 0x45, 0x89, 0x90,
+  0xc5, 0x84, 0x22, 0xb5, 0x24, 0x15, 0xc7, 0x27, 0x9b, 0xff, 0x7e, 0xbb,
+  0x01, 0x90, 0x04, 0x40, 0xf0, 0x21, 0x3f, 0x76, 0xea, 0xde, 0xa4, 0x2a,
+  0x91, 0x48, 0xa0, 0xd1, 0x68, 0x34, 0xfa, 0x0d, 0xe8, 0xf8, 0xc5, 0xf9,
+  0xfb, 0xb3, 0xeb, 0x7f, 0x5e, 0x5d, 0x90, 0x45, 0xb2, 0xf4, 0xc7, 0x3f,
+  0x1d, 0xe3, 0x7f, 0xc4, 0x77, 0x82, 0xdb, 0x13, 0x8b, 0x06, 0x16, 0x3e,
+  0xa0, 0x8e, 0x3b, 0xfe, 0x89, 0xc0, 0x9f, 0xe3, 0x25, 0x4d, 0x1c, 0x32,
+  0x5b, 0x38, 0x51, 0x4c, 0x93, 0x13, 0xeb, 0xf7, 0xeb, 0x57, 0x9d, 0x7d,
+  0x4b, 0x7e, 0x15, 0x38, 0x4b, 0x7a, 0x62, 0x7d, 0xf5, 0xe8, 0xdd, 0x2a,
+  0x8c, 0x12, 0x8b, 0xcc, 0xc2, 0x20, 0xa1, 0x01, 0x34, 0xbd, 0xf3, 0xdc,
+  0x64, 0x71, 0xe2, 0xd2, 0xaf, 0xde, 0x8c, 0x76, 0xd8, 0x97, 0xb6, 0x17,
+  0x78, 0x89, 0xe7, 0xf8, 0x9d, 0x78, 0xe6, 0xf8, 0xf4, 0x64, 0x90, 0xc2,
+  0x49, 0xbc, 0xc4, 0xa7, 0xe3, 0x8b, 0xc9, 0xd5, 0x68, 0x48, 0xfe, 0xee,
+  0x75, 0x5e, 0x79, 0xe4, 0x8a, 0x06, 0x34, 0x89, 0x9c, 0xc4, 0x0b, 0x03,
+  0x72, 0x1d, 0x86, 0xfe, 0x71, 0x8f, 0xb7, 0xe1, 0xed, 0xe3, 0xe4, 0x3e,
+  0xfd, 0x8c, 0x7f, 0xfe, 0x44, 0xbe, 0x67, 0x9f, 0xf1, 0xcf, 0xd2, 0x89,
+  0x6e, 0xbd, 0xe0, 0x90, 0xf4, 0x8f, 0x94, 0xc7, 0x2b, 0xc7, 0x75, 0xbd,
+  0xe0, 0xb6, 0xf0, 0x7c, 0x1a, 0x7e, 0xeb, 0xc4, 0xde, 0xff, 0xb2, 0x57,
+  0xd3, 0x30, 0x72, 0x69, 0xd4, 0x81, 0x47, 0x79, 0x9b, 0x1f, 0xd9, 0xa7,
+  0xec, 0xc3, 0x61, 0x14, 0x86, 0x89, 0x36, 0x6a, 0xa7, 0xb3, 0x8a, 0x3c,
+  0x18, 0xfa, 0xbe, 0x33, 0x0b, 0xfd, 0x30, 0x3a, 0x24, 0x3f, 0x0f, 0x67,
+  0x23, 0xba, 0xab, 0x0d, 0xd6, 0xe9, 0xc4, 0x14, 0x28, 0xe4, 0xca, 0xed,
+  0x46, 0x3b, 0x07, 0xfb, 0xee, 0xb4, 0xd0, 0x6e, 0x3d, 0x9b, 0xd1, 0x38,
+  0xce, 0xa1, 0xfd, 0xe6, 0xd0, 0xbd, 0x02, 0x34, 0x17, 0x16, 0x0d, 0x10,
+  0x4e, 0x1b, 0xd1, 0xdf, 0x76, 0x66, 0xa3, 0x99, 0xde, 0xe8, 0xce, 0x89,
+  0x02, 0x98, 0x5e, 0xd6, 0x6a, 0x3e, 0x3a, 0x98, 0x0d, 0x86, 0x7a, 0x2b,
+  0xdf, 0xbb, 0x5d, 0x24, 0x9d, 0xe9, 0x2d, 0x82, 0x99, 0xcd, 0xfb, 0xf3,
+  0x41, 0x71, 0xac, 0xe8, 0x0b, 0x7f, 0x3f, 0xda, 0xd9, 0x39, 0xd8, 0xa5,
+  0xfa, 0xfb, 0x84, 0x7e, 0x4b, 0x6a, 0x26, 0x2f, 0xe8, 0x1b, 0x39, 0xae,
+  0xb7, 0x8e, 0x0f, 0xc9, 0xfe, 0xea, 0x5b, 0x61, 0xda, 0x0b, 0xc7, 0x0d,
+  0xef, 0x60, 0x91, 0xc8, 0x70, 0xf5, 0x8d, 0x0c, 0xfa, 0xf0, 0x4f, 0x74,
+  0x3b, 0x75, 0xec, 0x7e, 0x9b, 0xfd, 0xed, 0x0e, 0x5a, 0xe6, 0x1e, 0x9d,
+  0x45, 0xf8, 0x95, 0x46, 0xd8, 0x6f, 0x07, 0xba, 0x0c, 0x8b, 0xfd, 0x76,
+  0x5b, 0x95, 0x4b, 0x3a, 0x0d, 0xdd, 0x7b, 0x6d, 0x45, 0xe7, 0xc0, 0xc9,
+  0x9d, 0xb9, 0xb3, 0xf4, 0xfc, 0xfb, 0x43, 0xd2, 0x71, 0x56, 0x2b, 0x9f,
+  0x76, 0xe2, 0xfb, 0x38, 0xa1, 0xcb, 0x36, 0x79, 0xe9, 0x7b, 0xc1, 0x97,
+  0x77, 0xce, 0x6c, 0xc2, 0xbe, 0xbf, 0x82, 0x96, 0x6d, 0xb2, 0x35, 0xa1,
+  0xb7, 0x21, 0x25, 0xbf, 0xbf, 0xd9, 0x6a, 0x93, 0x0f, 0xe1, 0x34, 0x4c,
+  0x42, 0x78, 0xf6, 0x9a, 0xfa, 0x5f, 0x69, 0xe2, 0xcd, 0x1c, 0x72, 0x49,
+  0xd7, 0x14, 0xde, 0x9c, 0x46, 0xb0, 0x03, 0xda, 0x24, 0x76, 0x82, 0x18,
+  0x78, 0x21, 0xf2, 0xe6, 0x1a, 0x37, 0x3a, 0xb3, 0x2f, 0xb7, 0x51, 0xb8,
+  0x0e, 0xdc, 0x43, 0x02, 0x63, 0x50, 0x27, 0xea, 0xdc, 0x22, 0xb9, 0x60,
+  0x4b, 0xd9, 0x83, 0xd1, 0xae, 0x4b, 0x6f, 0xdb, 0xe4, 0xe7, 0xbd, 0xbd,
+  0xdf, 0x28, 0x75, 0x48, 0xff, 0x17, 0xf8, 0xfc, 0xdb, 0xde, 0xce, 0xd4,
+  0x19, 0x02, 0xa5, 0xfa, 0xbf, 0x68, 0xa4, 0x59, 0x7a, 0x41, 0x67, 0x41,
+  0x71, 0x55, 0x0f, 0xf1, 0xf5, 0xd7, 0x45, 0xc9, 0x7e, 0x40, 0x62, 0xa9,
+  0xaf, 0xc4, 0x22, 0x7e, 0x75, 0x22, 0x5b, 0x5e, 0xd6, 0x6a, 0x0a, 0x76,
+  0x71, 0xe7, 0x3b, 0x80, 0x72, 0x54, 0xd8, 0x8f, 0xdf, 0xf8, 0xfe, 0x07,
+  0x34, 0x86, 0xfd, 0xc2, 0x60, 0xd9, 0x76, 0x25, 0xce, 0x3a, 0x09, 0xcb,
+  0xa9, 0x71, 0xb7, 0xf0, 0x12, 0xaa, 0x6f, 0x5d, 0x85, 0x9d, 0x38, 0xbe,
+  0xca, 0xc3, 0x96, 0x61, 0xaf, 0x0b, 0x0e, 0xe3, 0xad, 0xf9, 0x37, 0xad,
+  0x19, 0xb2, 0xd2, 0xdc, 0xc7, 0x46, 0x0b, 0xcf, 0x75, 0x69, 0x50, 0x39,
+  0x6f, 0x94, 0x95, 0x85, 0x39, 0xcb, 0x88, 0xf3, 0x81, 0x14, 0xe9, 0xd0,
+  0x32, 0xd2, 0xdb, 0x30, 0xc3, 0x6c, 0x91, 0x46, 0x05, 0xba, 0xb1, 0x75,
+  0x71, 0x60, 0xd7, 0x02, 0xed, 0x66, 0xc0, 0x1e, 0x34, 0x6a, 0x82, 0xe6,
+  0x62, 0x60, 0xe2, 0x72, 0x90, 0x7f, 0x14, 0x18, 0x81, 0x2e, 0x4d, 0x4b,
+  0x03, 0x14, 0x4d, 0x92, 0x70, 0x79, 0xc8, 0x76, 0xe3, 0x51, 0xb1, 0xf3,
+  0x9d, 0xe0, 0xb1, 0xbd, 0x7e, 0xbf, 0x09, 0x06, 0x2b, 0x0d, 0x81, 0x70,
+  0xe5, 0xcc, 0xbc, 0x04, 0xb6, 0x58, 0xbf, 0x7b, 0x70, 0x54, 0x86, 0x1a,
+  0xbc, 0xdb, 0x95, 0xb1, 0x2b, 0xe3, 0x3f, 0xa0, 0x83, 0x06, 0xbe, 0x84,
+  0x82, 0x26, 0x00, 0xa0, 0x94, 0xa2, 0xd2, 0xee, 0x83, 0x5d, 0x21, 0x57,
+  0x1e, 0xc9, 0x82, 0x1a, 0x4d, 0x8b, 0x10, 0x5d, 0x2f, 0x5e, 0xf9, 0x0e,
+  0xd0, 0x23, 0x08, 0x03, 0x8d, 0x1b, 0x9c, 0x00, 0x78, 0x08, 0x95, 0xe2,
+  0x21, 0x89, 0x7d, 0xcf, 0xa5, 0xe7, 0xe1, 0x5d, 0x00, 0xa4, 0x19, 0xc5,
+  0x84, 0x3a, 0x31, 0xed, 0x84, 0xeb, 0xa4, 0x72, 0x82, 0xff, 0xf5, 0x85,
+  0xde, 0xcf, 0x23, 0xd0, 0xd7, 0xb1, 0xd4, 0x5d, 0xe3, 0x86, 0x28, 0x5c,
+  0x92, 0xef, 0xd2, 0x9a, 0x1c, 0x11, 0xd0, 0xc3, 0x41, 0x3c, 0x0f, 0x23,
+  0x40, 0x96, 0x7d, 0xf4, 0x9d, 0x84, 0xfe, 0xd3, 0xee, 0x20, 0x33, 0xb4,
+  0x8e, 0xa4, 0x61, 0x18, 0x4f, 0x86, 0x72, 0xe7, 0x41, 0x59, 0xe7, 0xbe,
+  0xd2, 0xb1, 0x74, 0x29, 0x3a, 0x34, 0x8a, 0xc2, 0xaa, 0x9d, 0xf5, 0xf3,
+  0x9c, 0x9a, 0x25, 0x82, 0x4f, 0xe7, 0xc0, 0x90, 0xa8, 0x09, 0xe2, 0x10,
+  0x66, 0x2a, 0x96, 0x45, 0x56, 0x96, 0xad, 0x0a, 0x89, 0x57, 0xd2, 0xae,
+  0x1c, 0x4f, 0x2f, 0x98, 0x87, 0x55, 0x68, 0xd2, 0xd1, 0x7c, 0x38, 0x77,
+  0x37, 0xc0, 0x54, 0x33, 0x12, 0xcc, 0xc8, 0xfe, 0x3c, 0xd8, 0xdd, 0xdb,
+  0x9d, 0xf5, 0x9b, 0x20, 0x28, 0x8c, 0x89, 0x4a, 0x1c, 0xf7, 0xe7, 0xbb,
+  0xf4, 0x60, 0x13, 0x1c, 0x65, 0x03, 0xa5, 0x04, 0xc3, 0x21, 0xfd, 0xcd,
+  0x1d, 0x0d, 0x2b, 0x31, 0x9c, 0x7b, 0xd4, 0x77, 0xc1, 0xb6, 0xd4, 0x71,
+  0x63, 0x43, 0x1f, 0x32, 0x2b, 0x40, 0x1e, 0x35, 0xb5, 0x52, 0x5a, 0x8f,
+  0xdc, 0x86, 0xb9, 0xf6, 0xdb, 0x35, 0x2b, 0xa4, 0x7c, 0x87, 0x16, 0x1a,
+  0xa8, 0x2c, 0xe8, 0xe0, 0xdf, 0xca, 0x29, 0xfa, 0xf4, 0x96, 0x06, 0xae,
+  0x49, 0xee, 0x1a, 0x45, 0x67, 0x81, 0x1f, 0xab, 0x54, 0x47, 0x6e, 0xd5,
+  0x96, 0x89, 0x67, 0x2e, 0x40, 0x07, 0xdd, 0x41, 0x9d, 0xfc, 0xc4, 0x6d,
+  0xda, 0xc1, 0x79, 0xad, 0x8c, 0x06, 0x75, 0x89, 0xc8, 0x32, 0xcd, 0xd7,
+  0x99, 0x52, 0x5f, 0x83, 0x91, 0x49, 0xb5, 0xa9, 0x1f, 0xce, 0xbe, 0x54,
+  0x12, 0x7c, 0xbf, 0x52, 0xcb, 0xec, 0x3e, 0x88, 0x54, 0x06, 0x2c, 0xbd,
+  0x60, 0xb5, 0x4e, 0x3e, 0x26, 0xf7, 0x2b, 0x70, 0x5f, 0x82, 0xf5, 0x72,
+  0x4a, 0x23, 0xeb, 0xa6, 0x9d, 0xbd, 0x8d, 0xa9, 0x4f, 0x67, 0x3a, 0x53,
+  0xa6, 0x56, 0x0c, 0xd8, 0x5a, 0x25, 0xab, 0x30, 0x60, 0x56, 0xeb, 0xae,
+  0x59, 0x4b, 0xc8, 0xdc, 0xfc, 0xb3, 0xeb, 0xba, 0x8f, 0x64, 0x61, 0x79,
+  0x75, 0x75, 0xcd, 0xcd, 0x84, 0xad, 0xc7, 0x55, 0x85, 0xe3, 0xfb, 0xb9,
+  0x92, 0x68, 0x6c, 0x5f, 0x35, 0xa4, 0xd8, 0xe1, 0x3c, 0x9c, 0xad, 0x63,
+  0x9d, 0x6e, 0xfc, 0xa9, 0xae, 0xe8, 0xd7, 0x09, 0x5a, 0xb4, 0x26, 0xc5,
+  0x26, 0xa6, 0xa9, 0x2c, 0x65, 0xb5, 0x0c, 0x94, 0x2d, 0xb9, 0x3e, 0xfb,
+  0x3b, 0x4a, 0x4d, 0xfe, 0xdd, 0x61, 0x1b, 0x96, 0x00, 0xfe, 0x19, 0x0e,
+  0x0e, 0xda, 0x44, 0x75, 0x19, 0x4c, 0x7c, 0x3f, 0x4d, 0x82, 0x52, 0xa5,
+  0x8f, 0x0b, 0x36, 0xea, 0x97, 0x2d, 0x67, 0xe9, 0x44, 0x9e, 0x66, 0x11,
+  0x6b, 0x44, 0xc4, 0x3a, 0x8a, 0x91, 0x5a, 0xab, 0xd0, 0x53, 0x8d, 0xbf,
+  0x0d, 0xd6, 0x3f, 0xdb, 0x95, 0x5e, 0x80, 0x4b, 0xd3, 0x31, 0x6c, 0x4e,
+  0x66, 0x66, 0xba, 0xb0, 0x16, 0x91, 0xb0, 0x3c, 0x8a, 0x93, 0xde, 0xd0,
+  0x12, 0x45, 0x82, 0xa7, 0x1b, 0xb5, 0xd6, 0x6c, 0x6e, 0xa4, 0x09, 0xeb,
+  0x59, 0x57, 0x1e, 0xf3, 0x90, 0xb9, 0x8a, 0x55, 0xba, 0x70, 0x78, 0xb0,
+  0xdf, 0x9f, 0x1e, 0x18, 0x28, 0x5a, 0x34, 0x83, 0x86, 0x68, 0x05, 0x35,
+  0xf2, 0x31, 0xb8, 0x87, 0x5a, 0xcf, 0x8b, 0x0d, 0x94, 0x75, 0x63, 0x05,
+  0xdc, 0x90, 0x30, 0x02, 0x52, 0x03, 0xc2, 0x0c, 0x0f, 0x0e, 0x76, 0x77,
+  0xea, 0x01, 0x72, 0x0b, 0xaa, 0x76, 0x06, 0xf5, 0x06, 0x59, 0xc3, 0x09,
+  0x70, 0x40, 0xf5, 0xf8, 0xcf, 0xfa, 0xa3, 0x83, 0xe1, 0xb4, 0x01, 0x41,
+  0x52, 0xae, 0xab, 0x02, 0x76, 0xb0, 0xeb, 0xec, 0x3a, 0x7b, 0x8f, 0xa2,
+  0x7b, 0x3a, 0x4c, 0x3d, 0xe6, 0xbf, 0xcd, 0xf7, 0x67, 0xfb, 0x6e, 0x2d,
+  0xc8, 0x43, 0xd8, 0xd1, 0xce, 0xd4, 0xa7, 0x6e, 0xb9, 0x93, 0xb5, 0x67,
+  0x16, 0x23, 0x41, 0x88, 0x7b, 0x18, 0x9c, 0x5e, 0xea, 0x96, 0x32, 0xbe,
+  0xba, 0xf5, 0xcb, 0x66, 0x65, 0x32, 0x21, 0x32, 0x41, 0x33, 0xf7, 0xa9,
+  0x26, 0x4c, 0x6f, 0x9d, 0x95, 0xd1, 0xb5, 0x84, 0x86, 0x9d, 0xbb, 0x08,
+  0x5f, 0xe2, 0xbf, 0x95, 0xc3, 0x26, 0x38, 0xe5, 0xa6, 0xba, 0x3a, 0xd7,
+  0x35, 0xbe, 0xb3, 0x8a, 0x41, 0xee, 0xa6, 0x9f, 0xcc, 0x61, 0x09, 0xe6,
+  0xf7, 0xf5, 0x9f, 0x37, 0x2c, 0x51, 0x1e, 0x6f, 0x28, 0xaa, 0xba, 0x01,
+  0x6a, 0xa4, 0xaa, 0xa8, 0x98, 0x89, 0x3e, 0xe8, 0x7a, 0x3f, 0x43, 0x84,
+  0xc2, 0x38, 0x54, 0x95, 0x03, 0x5d, 0xae, 0x37, 0xd0, 0xc7, 0xd8, 0x44,
+  0xfb, 0xb1, 0xbe, 0x12, 0x6b, 0xae, 0x57, 0x2b, 0x1a, 0xcd, 0x0a, 0x0a,
+  0x4e, 0x09, 0x21, 0xec, 0xef, 0xea, 0x1a, 0xd6, 0xa7, 0x09, 0x68, 0xab,
+  0x4e, 0x8c, 0xbb, 0x83, 0x19, 0xd1, 0xdd, 0xdd, 0x1a, 0xdb, 0x36, 0x71,
+  0x9b, 0xcf, 0x2f, 0x8b, 0x26, 0x8b, 0xf0, 0x49, 0x6e, 0xfc, 0x51, 0x5a,
+  0x43, 0x45, 0x16, 0x8e, 0x4c, 0x74, 0x89, 0x50, 0xd4, 0xea, 0x43, 0x93,
+  0x56, 0x2f, 0xb5, 0x0c, 0x2a, 0x46, 0xaa, 0x97, 0x40, 0xf3, 0xfd, 0xf9,
+  0x81, 0xec, 0xe8, 0x68, 0xb2, 0x81, 0xc5, 0xf4, 0xed, 0x41, 0xb7, 0x5f,
+  0xc7, 0x8b, 0x62, 0xc0, 0x2e, 0xb7, 0x14, 0xa9, 0x5b, 0xef, 0x38, 0x93,
+  0x17, 0xde, 0x12, 0x93, 0x0b, 0x4e, 0x90, 0x3c, 0x89, 0x0f, 0x6d, 0x12,
+  0x5c, 0x7e, 0xe8, 0xe0, 0x32, 0xea, 0x04, 0xaf, 0xb0, 0x6c, 0x94, 0xc5,
+  0xdf, 0x29, 0x8b, 0xa1, 0x36, 0x12, 0xdc, 0xf1, 0xca, 0x0b, 0x8a, 0x71,
+  0xd3, 0xd4, 0xca, 0x1c, 0xe5, 0x7c, 0x33, 0x1f, 0xe1, 0x5f, 0x23, 0x11,
+  0x92, 0x70, 0x25, 0x37, 0x6d, 0x66, 0x43, 0x2b, 0x72, 0x6a, 0x57, 0x97,
+  0x94, 0x42, 0x84, 0x16, 0xe7, 0x96, 0x46, 0x95, 0x8b, 0x6f, 0xe4, 0x08,
+  0x15, 0x4c, 0x8a, 0x0c, 0x62, 0x11, 0xc5, 0x06, 0x0b, 0x73, 0x8e, 0xe9,
+  0x9f, 0x12, 0x29, 0xcb, 0x02, 0xf6, 0x6a, 0xfc, 0xb7, 0x26, 0x80, 0x85,
+  0xd0, 0x55, 0x7a, 0xf5, 0x7f, 0x21, 0xdf, 0x65, 0x8e, 0x8c, 0xc2, 0x04,
+  0x6c, 0x34, 0xbb, 0xef, 0xd2, 0xdb, 0x42, 0xa0, 0x0a, 0xd5, 0x82, 0xb1,
+  0xf5, 0x68, 0xaf, 0xd0, 0xde, 0xb4, 0x62, 0xab, 0x28, 0xbc, 0x8d, 0xb8,
+  0xf1, 0x65, 0x0e, 0x7a, 0x3f, 0x90, 0x73, 0x2a, 0xc7, 0x9a, 0x3a, 0x51,
+  0x53, 0x25, 0x97, 0xae, 0x90, 0xc1, 0x77, 0x51, 0xf6, 0x97, 0x21, 0xd1,
+  0xa3, 0x71, 0x45, 0x51, 0xac, 0x55, 0x6b, 0x2b, 0x65, 0x45, 0xf5, 0x14,
+  0x5c, 0x98, 0x4a, 0xaf, 0x88, 0x82, 0xfd, 0xec, 0x7d, 0xa5, 0x0d, 0x67,
+  0x3e, 0xf7, 0x7c, 0x3d, 0xa0, 0x20, 0x65, 0x36, 0x7e, 0x69, 0x9e, 0x42,
+  0x39, 0xe8, 0xb3, 0x0c, 0x8a, 0x79, 0x77, 0xb4, 0x8d, 0x86, 0x75, 0xab,
+  0xdc, 0xb3, 0x62, 0xe4, 0xaf, 0xf5, 0xad, 0x8a, 0x26, 0x0f, 0xe3, 0x8b,
+  0x0e, 0x6c, 0x86, 0x65, 0x6c, 0xe6, 0x8e, 0xcf, 0xeb, 0x38, 0xf1, 0xe6,
+  0xf7, 0x1d, 0x11, 0xd2, 0x36, 0x37, 0x2a, 0xcf, 0x1a, 0x6c, 0x14, 0x96,
+  0xef, 0x02, 0x85, 0xd7, 0x7e, 0xd2, 0x99, 0x39, 0x51, 0x95, 0x2c, 0x2e,
+  0xb5, 0x73, 0xfe, 0x13, 0x31, 0xba, 0xd2, 0xa4, 0x91, 0x6e, 0x9d, 0x55,
+  0xcc, 0xcf, 0x98, 0xa7, 0xa9, 0x58, 0xa4, 0xc2, 0x1a, 0xa0, 0x95, 0x00,
+  0x2e, 0x32, 0x4d, 0xee, 0xa8, 0xce, 0xf4, 0xb5, 0x0b, 0xaa, 0x67, 0x52,
+  0x0a, 0x9b, 0x4a, 0xcc, 0xb5, 0xa2, 0x85, 0x66, 0x4d, 0x34, 0x20, 0xba,
+  0xd1, 0x40, 0x77, 0xdc, 0x5b, 0x5a, 0x46, 0x84, 0xf2, 0x28, 0x40, 0xb6,
+  0x14, 0x48, 0x6f, 0x8c, 0x8a, 0x54, 0x2e, 0xed, 0xb0, 0x2a, 0x12, 0x69,
+  0xb2, 0xc3, 0x36, 0x63, 0x58, 0x36, 0x87, 0xff, 0xb4, 0x9b, 0xcc, 0xc6,
+  0x14, 0x99, 0xf4, 0xda, 0x31, 0x95, 0x8c, 0xfb, 0x23, 0xc7, 0xac, 0x49,
+  0x2e, 0x3c, 0x69, 0x98, 0x64, 0x16, 0xba, 0xb4, 0xd2, 0x06, 0xdc, 0xc1,
+  0xbf, 0x65, 0xbb, 0x14, 0x58, 0x63, 0xaf, 0x86, 0x33, 0x46, 0x46, 0xc6,
+  0x48, 0x93, 0xec, 0x5b, 0x67, 0xe1, 0x3a, 0xf2, 0x60, 0x93, 0x5e, 0xd2,
+  0xbb, 0xad, 0x36, 0x59, 0x86, 0x41, 0xc8, 0x36, 0x5d, 0x55, 0x5a, 0xb0,
+  0x26, 0xaa, 0xbd, 0x8a, 0x2a, 0x27, 0x64, 0x2a, 0x53, 0xc8, 0x8a, 0x29,
+  0x0c, 0xca, 0xb1, 0xde, 0xda, 0xdf, 0xdc, 0xeb, 0xeb, 0x7c, 0x3b, 0x34,
+  0xa4, 0xbe, 0x37, 0x90, 0x70, 0x38, 0xc7, 0x9a, 0x95, 0x2b, 0x06, 0xed,
+  0xc4, 0x2c, 0xbd, 0x60, 0x41, 0x23, 0x2f, 0xa9, 0x2f, 0x95, 0x31, 0x31,
+  0x28, 0xb8, 0xa4, 0x01, 0x1a, 0xce, 0x1d, 0xac, 0x86, 0x88, 0x37, 0x75,
+  0xf9, 0x77, 0xcb, 0x84, 0xba, 0x6e, 0x3a, 0x34, 0x18, 0xda, 0xd1, 0xb3,
+  0x2b, 0x30, 0x26, 0x26, 0x20, 0x1b, 0x2f, 0xde, 0x13, 0x88, 0x8d, 0x86,
+  0xd1, 0xd2, 0x8d, 0xf9, 0xa4, 0xce, 0x94, 0xac, 0x71, 0x94, 0xeb, 0x23,
+  0xc1, 0x4d, 0xe8, 0xbb, 0x79, 0x6c, 0xf0, 0x3f, 0x17, 0x34, 0x45, 0x09,
+  0x09, 0x26, 0x9e, 0xe7, 0x96, 0x71, 0x20, 0xbe, 0xd3, 0x38, 0x10, 0x9e,
+  0x74, 0x40, 0x5d, 0xaf, 0x10, 0x23, 0x5c, 0xe3, 0xf5, 0x32, 0x88, 0xd1,
+  0x2c, 0x5d, 0x51, 0x27, 0xb1, 0x71, 0x37, 0x82, 0xcd, 0x99, 0xb4, 0xb1,
+  0x86, 0x66, 0xe9, 0x7c, 0xb3, 0x59, 0xd9, 0x4a, 0x9b, 0x0c, 0xe6, 0x05,
+  0x73, 0xf0, 0x09, 0x58, 0x99, 0xa1, 0x8f, 0xb6, 0xc3, 0xa6, 0xde, 0xf7,
+  0x53, 0x0a, 0xa3, 0x27, 0x74, 0xa5, 0xf3, 0xf9, 0x6c, 0x9a, 0x08, 0xac,
+  0xb1, 0x12, 0xca, 0x5c, 0x6a, 0x83, 0x81, 0x55, 0x17, 0xc6, 0x91, 0x90,
+  0xec, 0x7e, 0x75, 0xfc, 0x35, 0x7d, 0x9e, 0xec, 0xec, 0x1d, 0x50, 0xb5,
+  0x33, 0x8d, 0xa8, 0xf3, 0x05, 0xe6, 0x8b, 0xff, 0x61, 0x88, 0xb5, 0xda,
+  0xc5, 0x5d, 0x52, 0xd7, 0x73, 0x88, 0x2d, 0x15, 0x4d, 0xfd, 0xb6, 0xb7,
+  0x0f, 0xfb, 0xa5, 0x10, 0x1c, 0x28, 0xd4, 0xab, 0xa9, 0x2c, 0x51, 0x30,
+  0xc1, 0x54, 0x07, 0x58, 0xf9, 0x52, 0x52, 0x3a, 0x53, 0xc3, 0x63, 0x15,
+  0x00, 0xcb, 0x8a, 0x8d, 0x0a, 0x49, 0xe9, 0xc2, 0x1a, 0x57, 0x00, 0x35,
+  0x45, 0x79, 0xab, 0xed, 0x81, 0x3a, 0x80, 0x8b, 0x76, 0x31, 0x9e, 0x57,
+  0xa0, 0x62, 0x31, 0x1f, 0x5d, 0x45, 0xc9, 0x4a, 0x95, 0x98, 0xc5, 0xb5,
+  0x5d, 0x2f, 0xa2, 0x33, 0x2e, 0x93, 0xb9, 0xec, 0x69, 0x3e, 0x40, 0x59,
+  0x84, 0xfd, 0x89, 0x60, 0x1b, 0xa0, 0x96, 0x06, 0x19, 0xaa, 0x43, 0x24,
+  0x3c, 0x38, 0x50, 0xb6, 0xfb, 0x51, 0x2f, 0x1a, 0xe3, 0x7a, 0x1c, 0xd4,
+  0x71, 0x4f, 0x14, 0xf9, 0x1e, 0xf7, 0x78, 0x2d, 0xf2, 0x31, 0x63, 0xf8,
+  0x30, 0x78, 0x0b, 0xb4, 0x3d, 0xb1, 0x30, 0x92, 0x64, 0xb7, 0xd2, 0xfa,
+  0x61, 0xd7, 0xfb, 0x4a, 0x66, 0xbe, 0x13, 0xc7, 0x27, 0x56, 0x16, 0x8e,
+  0xb1, 0xf2, 0xfa, 0xe0, 0x63, 0xce, 0x8d, 0x63, 0x05, 0x91, 0xe3, 0xc5,
+  0xa0, 0xa6, 0xe2, 0x18, 0x1a, 0xa8, 0x3d, 0x56, 0xe3, 0xab, 0x28, 0x9c,
+  0x83, 0x4d, 0x00, 0x6d, 0x1c, 0x5f, 0xf4, 0x9b, 0xd0, 0x19, 0x98, 0xac,
+  0xc9, 0x3d, 0xb9, 0xa6, 0xe0, 0x2e, 0x82, 0x6b, 0x70, 0x05, 0x1a, 0x05,
+  0x35, 0xde, 0x71, 0x6f, 0x25, 0xa1, 0xd0, 0xd3, 0x71, 0xc8, 0x5f, 0x69,
+  0xd8, 0xc3, 0x36, 0xb4, 0xb4, 0x81, 0xb1, 0x85, 0x07, 0xb3, 0x66, 0xe5,
+  0x50, 0xb1, 0x95, 0xb6, 0xe6, 0xe5, 0x6a, 0x52, 0xa5, 0x94, 0x35, 0x3e,
+  0xee, 0x41, 0xdb, 0x71, 0xf9, 0x0a, 0x1f, 0xc7, 0x9c, 0x35, 0x18, 0x38,
+  0x11, 0xf2, 0xcc, 0xe0, 0xa5, 0xdf, 0xc7, 0x05, 0x0e, 0x90, 0x71, 0x14,
+  0xb1, 0x4a, 0xe3, 0x58, 0x82, 0x4c, 0x6f, 0x45, 0x2c, 0x95, 0x17, 0xcb,
+  0x92, 0x38, 0x71, 0x92, 0x75, 0xdc, 0xed, 0x76, 0x81, 0x36, 0x68, 0x78,
+  0x90, 0x3b, 0xc7, 0x4b, 0x14, 0xf2, 0x88, 0x15, 0xe7, 0xb8, 0x35, 0x45,
+  0x1f, 0xc4, 0xa9, 0x7b, 0x9f, 0x21, 0xcf, 0xb9, 0xcd, 0x84, 0xfb, 0x62,
+  0x48, 0x18, 0x2f, 0x9d, 0x58, 0xa6, 0x3a, 0x16, 0x6b, 0x7c, 0x9a, 0x24,
+  0xa0, 0x68, 0xc9, 0x59, 0x18, 0xcc, 0xbd, 0xdb, 0x35, 0x67, 0x01, 0x58,
+  0xaf, 0xa1, 0x01, 0x14, 0xae, 0x2b, 0xf0, 0xe0, 0x64, 0x3d, 0x5d, 0x7a,
+  0x09, 0x60, 0xb0, 0x0e, 0x78, 0x67, 0xbb, 0x75, 0x04, 0xa6, 0x43, 0xb2,
+  0x8e, 0x02, 0x32, 0x77, 0x7c, 0x30, 0xad, 0x0c, 0x78, 0x70, 0x00, 0xa2,
+  0xd8, 0xc9, 0xfc, 0x9a, 0x35, 0xe1, 0xc5, 0x42, 0xe3, 0x09, 0xaf, 0x3f,
+  0xb9, 0x06, 0x94, 0x69, 0x02, 0xfe, 0x50, 0x02, 0xaa, 0xe4, 0xcb, 0x71,
+  0x4f, 0xbc, 0x2d, 0xef, 0x2e, 0xad, 0x14, 0x93, 0x97, 0x2c, 0x85, 0xb6,
+  0x52, 0xf6, 0x83, 0xb1, 0x1f, 0x17, 0xae, 0x48, 0x57, 0x67, 0x05, 0xb2,
+  0x2b, 0x4e, 0x6a, 0x3a, 0xf0, 0x4e, 0xf9, 0x39, 0x81, 0xfa, 0xb6, 0x51,
+  0xb3, 0x86, 0x02, 0xf0, 0x78, 0x32, 0x79, 0x73, 0x7e, 0xdc, 0x83, 0x0f,
+  0x1b, 0xf5, 0x7a, 0xf9, 0xb0, 0x6e, 0x13, 0x30, 0xae, 0x1d, 0xbf, 0x79,
+  0x3f, 0x68, 0xd9, 0x60, 0x3a, 0x08, 0xaf, 0x11, 0x81, 0x8e, 0x59, 0x52,
+  0x04, 0x76, 0x14, 0xff, 0xff, 0xa7, 0x1a, 0xa0, 0xb8, 0x54, 0x15, 0x2c,
+  0x60, 0xde, 0x97, 0x26, 0x0e, 0xc9, 0x74, 0x89, 0xa5, 0x6d, 0x11, 0x96,
+  0x4c, 0x60, 0x1a, 0xbf, 0x8e, 0x6f, 0xa6, 0x6b, 0xd8, 0x4c, 0x01, 0xe1,
+  0x45, 0x41, 0xfc, 0x8b, 0x25, 0x81, 0x27, 0x52, 0xdd, 0x85, 0x05, 0x5b,
+  0xe7, 0xcc, 0xf7, 0x66, 0x5f, 0x70, 0xef, 0xce, 0x23, 0x1a, 0x2f, 0x4e,
+  0x57, 0xb1, 0x9d, 0x44, 0x6b, 0xda, 0x6a, 0xc0, 0x6c, 0x1f, 0x78, 0x97,
+  0x74, 0x2b, 0xc4, 0x35, 0x44, 0xe2, 0xa8, 0x3c, 0x88, 0x4a, 0xc7, 0xbd,
+  0xea, 0x6d, 0xfa, 0xd8, 0xad, 0x2d, 0x04, 0xce, 0x95, 0x83, 0x99, 0x0c,
+  0xf0, 0xe6, 0xe2, 0xcd, 0xb6, 0x75, 0x5e, 0xa6, 0x57, 0xb7, 0x36, 0xdc,
+  0xfc, 0x86, 0xf6, 0xb0, 0xa9, 0xd9, 0x98, 0x9f, 0x70, 0x99, 0x32, 0x89,
+  0x77, 0x0d, 0x5f, 0x0e, 0x61, 0x6c, 0x6c, 0x55, 0x03, 0x49, 0x54, 0xc3,
+  0x31, 0xf1, 0x20, 0x41, 0xc2, 0x05, 0x5d, 0x60, 0xe9, 0xc5, 0x89, 0xb5,
+  0x5e, 0xb9, 0xe0, 0x49, 0x65, 0x42, 0x14, 0x38, 0xf4, 0x15, 0x23, 0x88,
+  0x9d, 0x2c, 0xbc, 0xb8, 0x65, 0x81, 0x78, 0xfc, 0xd7, 0x1a, 0x0c, 0x93,
+  0x26, 0x9b, 0x21, 0x5c, 0x31, 0x19, 0xcf, 0xcc, 0xf2, 0x13, 0xab, 0x6f,
+  0x11, 0x76, 0xf6, 0xe7, 0xc4, 0xba, 0x06, 0x48, 0x8c, 0xd1, 0x08, 0xfc,
+  0x1f, 0x84, 0x80, 0x0e, 0xb8, 0x6f, 0x74, 0x89, 0x1e, 0xb1, 0x4b, 0xee,
+  0x69, 0xd2, 0xb5, 0x48, 0x5a, 0xfd, 0x30, 0xbe, 0x02, 0x52, 0x79, 0x5f,
+  0x29, 0x79, 0x17, 0x82, 0xa5, 0x10, 0x46, 0xa0, 0x8d, 0x8e, 0x7b, 0x1c,
+  0xee, 0xc6, 0x08, 0x0c, 0xac, 0xf1, 0x6b, 0x27, 0x70, 0xc1, 0x1f, 0xfd,
+  0x42, 0xc9, 0x99, 0xb3, 0x02, 0x31, 0x4f, 0x1f, 0x0c, 0x6c, 0x68, 0x91,
+  0x34, 0xef, 0x39, 0xbe, 0x7a, 0xf7, 0xd7, 0x37, 0xe7, 0x84, 0x2f, 0xc6,
+  0x83, 0x01, 0x8e, 0xac, 0xf1, 0x39, 0x0d, 0x3c, 0xb0, 0x47, 0xc2, 0x39,
+  0x18, 0x23, 0x11, 0x9e, 0xb6, 0x6a, 0x06, 0x0c, 0x15, 0x2e, 0x62, 0xf2,
+  0x60, 0x49, 0xf2, 0xec, 0xdc, 0x0a, 0xbb, 0x63, 0x11, 0xba, 0x19, 0xbf,
+  0xbe, 0x63, 0x5f, 0x1f, 0xcc, 0xb1, 0x02, 0x5a, 0xc6, 0x89, 0x39, 0xb3,
+  0x6c, 0x4a, 0xf3, 0x7c, 0x0d, 0x33, 0x18, 0x22, 0x15, 0x36, 0xbe, 0x7c,
+  0x7f, 0x4d, 0x4e, 0xff, 0x76, 0xfa, 0xe6, 0xed, 0xe9, 0xcb, 0xb7, 0x17,
+  0xff, 0xbf, 0xac, 0x43, 0xe2, 0x2d, 0x69, 0xb8, 0x4e, 0x72, 0xc1, 0xc1,
+  0xbf, 0x13, 0x9b, 0xc7, 0x05, 0xe2, 0x56, 0xc3, 0x35, 0x61, 0xf5, 0xa3,
+  0x44, 0xa9, 0x1f, 0xc5, 0x00, 0xcb, 0x89, 0xb5, 0x6b, 0xe1, 0x21, 0x21,
+  0xd8, 0x1d, 0xbb, 0xf0, 0x49, 0x16, 0x32, 0x62, 0xe0, 0x8c, 0xd9, 0xfb,
+  0xf9, 0xf2, 0xf5, 0xea, 0x18, 0x60, 0x89, 0xd1, 0x2e, 0xa1, 0xd6, 0xb4,
+  0xc8, 0x01, 0x91, 0xd5, 0x1c, 0x6a, 0x39, 0x3d, 0x2a, 0xd1, 0x48, 0x1f,
+  0xcd, 0xc2, 0x25, 0x08, 0x1f, 0x97, 0xba, 0x87, 0x84, 0x6f, 0x65, 0x7b,
+  0xb7, 0x33, 0xe8, 0xc7, 0xad, 0x36, 0xc9, 0xe5, 0x85, 0xbd, 0xd7, 0xef,
+  0x0c, 0x86, 0xec, 0xe1, 0x79, 0x38, 0x21, 0x36, 0x7e, 0xde, 0x6e, 0xd5,
+  0xf1, 0x03, 0xa2, 0xfe, 0xbc, 0xec, 0x90, 0x6b, 0xfe, 0x66, 0xfa, 0x5d,
+  0xd3, 0xe8, 0xbc, 0xde, 0xce, 0x12, 0x6b, 0x19, 0x33, 0x7b, 0xb8, 0x01,
+  0xcd, 0xde, 0x3a, 0xeb, 0x60, 0xb6, 0x10, 0x22, 0xef, 0x91, 0x0a, 0xfc,
+  0x11, 0xd6, 0xc7, 0xbf, 0xd6, 0x74, 0x4d, 0xff, 0x3b, 0x9c, 0xda, 0x4d,
+  0xec, 0x8e, 0x53, 0xd7, 0xc5, 0x63, 0x2d, 0xff, 0x07, 0xfb, 0xfc, 0x31,
+  0x36, 0x07, 0xbc, 0x83, 0xcd, 0x6b, 0x72, 0x47, 0x2a, 0x4d, 0x8e, 0xd4,
+  0xdc, 0x80, 0x89, 0x72, 0xec, 0xab, 0xcd, 0x0c, 0xc9, 0x03, 0xf8, 0x1c,
+  0x4e, 0xeb, 0x5c, 0x80, 0x26, 0xa6, 0x7f, 0x23, 0x93, 0x7f, 0x33, 0x53,
+  0x7f, 0x43, 0x13, 0x1f, 0x9b, 0xa3, 0x95, 0xd3, 0xbc, 0xf5, 0x04, 0x8b,
+  0x40, 0xea, 0x9b, 0x57, 0xdb, 0xff, 0xb5, 0x76, 0x7f, 0x13, 0x7b, 0xbf,
+  0xd2, 0xce, 0x7f, 0x3a, 0x23, 0xfe, 0x71, 0x06, 0x3c, 0xf0, 0x56, 0x5c,
+  0xbb, 0x8b, 0x52, 0xcb, 0xbd, 0x7a, 0x0b, 0x35, 0xd8, 0x3e, 0x4d, 0x50,
+  0x4d, 0x25, 0x53, 0x86, 0xe9, 0xcc, 0xa7, 0x4e, 0xd4, 0x08, 0xcf, 0x33,
+  0x6c, 0xf9, 0x28, 0x2c, 0xcb, 0x42, 0x22, 0x25, 0x9b, 0x7b, 0xf3, 0x90,
+  0xc7, 0x3a, 0x08, 0xe4, 0x88, 0x4d, 0x79, 0xd0, 0x43, 0xe2, 0x8f, 0x62,
+  0xa9, 0x52, 0x59, 0x74, 0xa2, 0x61, 0xa4, 0xe4, 0x4d, 0x40, 0xae, 0x04,
+  0x4c, 0x73, 0x9c, 0xa4, 0x14, 0x83, 0xa9, 0x53, 0x15, 0x87, 0x30, 0x76,
+  0xc1, 0xca, 0x1f, 0x6e, 0x13, 0x68, 0x8f, 0x04, 0xa6, 0x22, 0x38, 0xd9,
+  0xff, 0xa5, 0xd6, 0x53, 0x8d, 0x57, 0x8e, 0x42, 0xc5, 0x4e, 0x0a, 0xd0,
+  0x1a, 0xf7, 0x7b, 0x7d, 0x98, 0x0a, 0x36, 0x78, 0xa0, 0xf0, 0x2e, 0x7f,
+  0xb5, 0x52, 0x86, 0xc4, 0x50, 0x58, 0x5c, 0xb5, 0x4f, 0x0b, 0x61, 0xb1,
+  0x42, 0x10, 0x30, 0xa1, 0xe8, 0xf3, 0x24, 0x51, 0x21, 0xf4, 0xf5, 0xa0,
+  0xdd, 0xbf, 0x52, 0x61, 0x76, 0xe2, 0xf5, 0x92, 0xed, 0xf4, 0x72, 0x44,
+  0x9e, 0x28, 0xca, 0x24, 0x0d, 0x99, 0x38, 0xf1, 0x33, 0x04, 0x9b, 0x98,
+  0x34, 0xbf, 0x3e, 0x65, 0xb2, 0x1c, 0x3f, 0x7f, 0x00, 0xb5, 0x91, 0x7d,
+  0x79, 0x37, 0xc8, 0x3f, 0x0e, 0xf3, 0x8f, 0xa3, 0xfc, 0xe3, 0x0e, 0xff,
+  0xf8, 0xff, 0x66, 0x9c, 0xa7, 0x9a, 0x21, 0x1b, 0xd8, 0xc4, 0x75, 0x7c,
+  0x23, 0x05, 0x72, 0x31, 0xae, 0xfb, 0xcf, 0x70, 0x0d, 0xdd, 0xef, 0x89,
+  0x1f, 0xc6, 0x58, 0x89, 0x10, 0x04, 0x42, 0x66, 0xb9, 0x6b, 0xf4, 0xbc,
+  0xb1, 0xfc, 0x9c, 0x70, 0x8b, 0xbe, 0x5b, 0x82, 0xee, 0xca, 0x24, 0x34,
+  0x0b, 0x73, 0x78, 0x40, 0x88, 0x18, 0x2b, 0xbf, 0x36, 0x13, 0x97, 0x52,
+  0x35, 0x9c, 0x55, 0x2f, 0xda, 0x94, 0xda, 0xb2, 0xaa, 0x8d, 0x06, 0xb2,
+  0x35, 0xc7, 0xa8, 0xc3, 0x22, 0x1a, 0x99, 0x40, 0xfd, 0xc0, 0x1e, 0x56,
+  0x08, 0x53, 0x45, 0x00, 0x08, 0x10, 0x78, 0xf9, 0x4a, 0x69, 0x10, 0xbe,
+  0x8e, 0x09, 0x34, 0x58, 0x59, 0xde, 0xa1, 0x54, 0x81, 0x99, 0x1f, 0x6f,
+  0xe0, 0x50, 0x3c, 0xd8, 0xce, 0x00, 0xad, 0x99, 0x06, 0xd9, 0x2b, 0xe8,
+  0x7b, 0x49, 0xef, 0xaa, 0xdc, 0x8a, 0x72, 0xb5, 0xdd, 0x8c, 0xcd, 0xa4,
+  0x56, 0xf2, 0xc7, 0x78, 0x16, 0x79, 0x2b, 0xa1, 0xd4, 0xbf, 0x82, 0xed,
+  0xc0, 0x31, 0x60, 0x36, 0xe4, 0x05, 0x38, 0xb8, 0xe4, 0x84, 0x7c, 0x27,
+  0x1f, 0x2e, 0x4e, 0xcf, 0xff, 0x09, 0x0a, 0xaa, 0x4d, 0x3e, 0xfc, 0x7e,
+  0x79, 0xf9, 0xe6, 0xf2, 0x2f, 0xb0, 0xbb, 0xda, 0xe4, 0xd5, 0x9b, 0xcb,
+  0x37, 0x93, 0xd7, 0x17, 0xe7, 0xa0, 0x5b, 0xdb, 0xe4, 0xfa, 0xcd, 0xbb,
+  0x8b, 0xf7, 0xbf, 0x5f, 0x1f, 0x92, 0xd1, 0x8f, 0x23, 0x0d, 0x16, 0x5a,
+  0xaf, 0x19, 0xa8, 0xd3, 0xeb, 0xeb, 0xd3, 0xb3, 0xbf, 0x7e, 0xc2, 0x9b,
+  0x7b, 0x3e, 0x5d, 0x9d, 0x82, 0x3c, 0xfb, 0xdb, 0x05, 0x03, 0x2c, 0x3f,
+  0x7f, 0x7d, 0x7a, 0x79, 0x3e, 0x79, 0x7d, 0xfa, 0xd7, 0x0b, 0x36, 0x8c,
+  0xd2, 0x03, 0x7d, 0x54, 0x36, 0x9e, 0xfc, 0xf4, 0xfc, 0xfd, 0x44, 0x1d,
+  0x37, 0x0d, 0x6d, 0x9c, 0xae, 0x2e, 0x78, 0x70, 0x0d, 0x86, 0xee, 0x0c,
+  0xf2, 0xf7, 0xab, 0x30, 0xcd, 0x60, 0xa7, 0xdf, 0x3e, 0xb1, 0x53, 0x06,
+  0xe0, 0xa2, 0x43, 0xcb, 0x41, 0x3f, 0xcd, 0x95, 0xe3, 0x5b, 0xa1, 0xf6,
+  0x3e, 0xa9, 0x7d, 0xe4, 0xa7, 0xe5, 0x7d, 0xd5, 0x10, 0x00, 0xbc, 0x96,
+  0xde, 0xe1, 0xc3, 0x4f, 0x94, 0x1d, 0xda, 0x71, 0xd5, 0x37, 0xf4, 0x2b,
+  0x60, 0x1c, 0xc3, 0xb3, 0x60, 0x2d, 0x0f, 0x39, 0x5b, 0x47, 0x11, 0xbc,
+  0xf8, 0x84, 0xfa, 0x97, 0x6a, 0x13, 0xca, 0x34, 0x51, 0xa1, 0x97, 0x4b,
+  0xe7, 0x0e, 0x6c, 0x0f, 0xbe, 0x3d, 0xcf, 0x44, 0x8a, 0xfc, 0x84, 0xb8,
+  0xe1, 0x6c, 0x8d, 0x84, 0xe9, 0xde, 0xd2, 0x44, 0xd0, 0xe8, 0xe5, 0xfd,
+  0x1b, 0xd7, 0x4e, 0xc5, 0x4d, 0xab, 0xcb, 0x32, 0x64, 0xaf, 0xaf, 0xdf,
+  0xbd, 0x2d, 0xc0, 0xe2, 0xab, 0xca, 0x23, 0x59, 0x71, 0x15, 0x2c, 0x35,
+  0x68, 0xd5, 0xea, 0x02, 0x0d, 0x64, 0x90, 0xa5, 0xe1, 0xd6, 0x3a, 0x80,
+  0x2c, 0x6e, 0x9b, 0x16, 0xb1, 0xb0, 0x7f, 0xe6, 0xe0, 0x93, 0x33, 0x89,
+  0x19, 0x2f, 0xc2, 0xbb, 0x0b, 0xcc, 0x23, 0xda, 0x4b, 0xb0, 0x8a, 0x9c,
+  0x5b, 0x2a, 0xd7, 0x1c, 0x30, 0xe2, 0xe2, 0xcb, 0x0b, 0xbf, 0x0a, 0x6d,
+  0x91, 0xa2, 0x94, 0xca, 0x20, 0x44, 0xa7, 0x9c, 0x26, 0xd0, 0xdd, 0x62,
+  0xc3, 0x1c, 0x12, 0x8b, 0x6c, 0x13, 0x31, 0x56, 0xb1, 0x03, 0x53, 0x53,
+  0x5d, 0x11, 0x98, 0xc1, 0x4e, 0x2c, 0x34, 0x63, 0x15, 0x1b, 0x32, 0x21,
+  0x72, 0xe9, 0x2c, 0x71, 0x61, 0x0d, 0x49, 0xd1, 0x23, 0xe9, 0x6c, 0x72,
+  0x22, 0x42, 0x57, 0xb6, 0xdd, 0x22, 0x27, 0x63, 0x2d, 0x37, 0x5d, 0x3a,
+  0x30, 0xe6, 0xaa, 0x25, 0x30, 0x3f, 0xda, 0x78, 0x08, 0xbd, 0x2f, 0xe6,
+  0xf8, 0xa3, 0x84, 0x92, 0x13, 0x5e, 0x3f, 0xf6, 0xfc, 0xb4, 0x14, 0x03,
+  0x3d, 0x3b, 0x35, 0x45, 0x41, 0xdc, 0xb3, 0xd0, 0x73, 0x54, 0x4d, 0x4f,
+  0x9e, 0xee, 0x97, 0xc0, 0x7b, 0x73, 0xfb, 0xce, 0x0b, 0xdc, 0xf0, 0xae,
+  0x7b, 0x81, 0x1b, 0x7e, 0x12, 0xae, 0xa3, 0x19, 0x6d, 0x15, 0xce, 0x3c,
+  0xd2, 0x80, 0xbd, 0x06, 0xd7, 0x4f, 0x1a, 0x8d, 0x50, 0x3f, 0xd6, 0xcb,
+  0x48, 0x80, 0xf4, 0x13, 0x96, 0xa5, 0xb6, 0x0b, 0xb5, 0x4d, 0x26, 0x7c,
+  0x64, 0xc8, 0x12, 0xa4, 0x5c, 0xf8, 0x80, 0x36, 0x92, 0x10, 0xb3, 0xad,
+  0x45, 0x92, 0xac, 0x0e, 0x7b, 0xbd, 0xc1, 0xc1, 0xb0, 0x3b, 0xd8, 0xdb,
+  0xef, 0xee, 0x74, 0x07, 0x3d, 0xde, 0x58, 0x59, 0x5d, 0xf6, 0xa4, 0xeb,
+  0xb8, 0x2e, 0xeb, 0xfb, 0xd6, 0x8b, 0x41, 0xe0, 0xd0, 0xc8, 0xb6, 0x78,
+  0x02, 0xdd, 0x6a, 0x67, 0x08, 0xd8, 0x85, 0xb9, 0x32, 0xc9, 0xcd, 0x9a,
+  0xc1, 0xf0, 0xff, 0x3d, 0x79, 0x7f, 0xd9, 0x5d, 0xe1, 0x8d, 0x6d, 0x36,
+  0xd0, 0xdd, 0x49, 0x1c, 0xad, 0x2a, 0x09, 0xa8, 0x27, 0x72, 0xf2, 0x42,
+  0x1e, 0x9e, 0x9c, 0xa8, 0x12, 0xb2, 0x65, 0xa8, 0x02, 0xe1, 0xf9, 0xed,
+  0xaa, 0x5a, 0x12, 0x5d, 0xc8, 0xca, 0x63, 0xa8, 0xfd, 0xe2, 0x3b, 0x2f,
+  0x99, 0x2d, 0x14, 0x24, 0x4c, 0x43, 0xe2, 0x71, 0x3e, 0x5d, 0xa7, 0x76,
+  0xb9, 0x3e, 0x35, 0x6a, 0x79, 0xdc, 0x76, 0xbc, 0x39, 0x17, 0x8c, 0xb6,
+  0x36, 0xef, 0xac, 0x76, 0x0a, 0x2b, 0xb1, 0x8e, 0x1a, 0x0e, 0x27, 0x94,
+  0xb6, 0x11, 0x50, 0xb9, 0x26, 0x50, 0xfc, 0xbd, 0x96, 0xba, 0x61, 0xad,
+  0xa3, 0x52, 0xec, 0x3f, 0xf0, 0x7e, 0x65, 0x88, 0x23, 0xdf, 0x5d, 0xa7,
+  0xea, 0x6a, 0x83, 0xd9, 0x49, 0x85, 0x3a, 0x4d, 0xf8, 0x2d, 0x73, 0x8c,
+  0xeb, 0x38, 0x2e, 0x6d, 0xd8, 0x80, 0xe7, 0x1e, 0x46, 0x2a, 0x91, 0x6e,
+  0x73, 0x09, 0x3f, 0xf5, 0xc5, 0x65, 0x5c, 0x3a, 0x6a, 0x57, 0x1c, 0x05,
+  0xdb, 0x86, 0xa7, 0xb6, 0xf2, 0x02, 0x8b, 0xc1, 0xd8, 0xe3, 0xe9, 0x7d,
+  0x42, 0xe3, 0x96, 0x2c, 0x6b, 0x9a, 0xcc, 0x5f, 0xe8, 0xf1, 0xaa, 0xd9,
+  0xf7, 0x7a, 0x84, 0xb7, 0x4a, 0xef, 0x3b, 0xc4, 0x9c, 0xe4, 0x9c, 0x02,
+  0x57, 0x03, 0xb2, 0x61, 0x30, 0xa3, 0x04, 0xbc, 0x61, 0x82, 0x27, 0xde,
+  0x62, 0x7c, 0x02, 0x93, 0x6c, 0x20, 0x6f, 0x8a, 0xb8, 0x81, 0xa0, 0x64,
+  0x57, 0x20, 0x9d, 0xe4, 0xa8, 0xe8, 0x98, 0xc0, 0x66, 0x16, 0x8d, 0x59,
+  0x41, 0xcc, 0x24, 0xdb, 0xd1, 0x92, 0x00, 0xea, 0x9e, 0xbd, 0x7d, 0x3f,
+  0xb9, 0x38, 0x37, 0xee, 0xb1, 0x30, 0x88, 0x43, 0x10, 0xcf, 0x7e, 0x78,
+  0x6b, 0x5b, 0xac, 0x0b, 0xec, 0x5b, 0x80, 0xb4, 0x04, 0xdb, 0x1c, 0xbc,
+  0x39, 0xb7, 0xcd, 0x4c, 0x3c, 0x56, 0xcd, 0xc3, 0xa5, 0x90, 0x81, 0xeb,
+  0x0c, 0x46, 0x57, 0xed, 0x64, 0x35, 0xb6, 0x3c, 0xaa, 0x94, 0xb5, 0x12,
+  0xcf, 0xab, 0x4a, 0x20, 0xb7, 0xdd, 0xfe, 0xfd, 0x6f, 0xf2, 0x42, 0xa8,
+  0x84, 0xbf, 0xd3, 0xe9, 0x04, 0x74, 0x1b, 0x4d, 0xf4, 0xf9, 0xea, 0x22,
+  0x2c, 0x1f, 0x5f, 0xb1, 0x01, 0x41, 0x78, 0x67, 0x20, 0x6c, 0xeb, 0x2e,
+  0xd6, 0x04, 0x77, 0x1e, 0x80, 0x91, 0xa6, 0x93, 0x3d, 0xec, 0x4e, 0xbd,
+  0x00, 0x5c, 0x18, 0xb4, 0xdb, 0x99, 0x02, 0x8d, 0x22, 0xe7, 0x7e, 0xba,
+  0x9e, 0xcf, 0xa9, 0x6c, 0x88, 0xe4, 0xad, 0xc3, 0x40, 0x68, 0x6c, 0x79,
+  0x89, 0x0b, 0xdc, 0x86, 0xa2, 0x21, 0xa7, 0x01, 0x22, 0x78, 0x0e, 0x3b,
+  0xec, 0x6f, 0x1e, 0xbd, 0x4b, 0x37, 0x9b, 0xcc, 0x46, 0xe6, 0x71, 0xd8,
+  0x72, 0x56, 0x31, 0x92, 0xd9, 0x0e, 0xae, 0x59, 0x1d, 0x15, 0x33, 0xbc,
+  0x05, 0x54, 0x37, 0x74, 0x52, 0x6d, 0x80, 0xef, 0x70, 0xf3, 0xff, 0x0e,
+  0x16, 0xff, 0xbe, 0x2d, 0x1f, 0x12, 0xc6, 0x56, 0x73, 0xdf, 0xb9, 0x8d,
+  0x0b, 0xad, 0x46, 0x5a, 0x2b, 0x91, 0x6f, 0x84, 0x76, 0xef, 0x9c, 0x64,
+  0xd1, 0xc5, 0xca, 0x6c, 0xb9, 0xc3, 0x60, 0xcf, 0xde, 0x69, 0x13, 0x56,
+  0x50, 0xd2, 0x26, 0x83, 0x16, 0xe9, 0x49, 0x2e, 0x45, 0xe6, 0x7c, 0x00,
+  0x36, 0x08, 0xc0, 0x7a, 0xc5, 0x84, 0x47, 0x0f, 0x64, 0x0a, 0x12, 0x90,
+  0x09, 0x16, 0x06, 0x94, 0x15, 0x5c, 0xeb, 0x60, 0xf7, 0x04, 0x58, 0x00,
+  0x99, 0xe6, 0x3c, 0x15, 0xda, 0x81, 0xac, 0x69, 0x93, 0xe5, 0xed, 0x32,
+  0xa9, 0x81, 0xb3, 0xdf, 0x04, 0xce, 0x2c, 0x89, 0xfc, 0x1a, 0x38, 0x83,
+  0x7e, 0x11, 0x90, 0x3a, 0xcf, 0x45, 0x96, 0x82, 0x3c, 0x21, 0x36, 0xa7,
+  0xee, 0xaf, 0x64, 0xd8, 0x22, 0x7f, 0x26, 0xd6, 0x2c, 0xc4, 0xba, 0x89,
+  0x84, 0x5a, 0xe4, 0x90, 0xd8, 0xd9, 0xbb, 0x01, 0x7f, 0x17, 0x81, 0xf6,
+  0x63, 0x41, 0xba, 0x95, 0xe3, 0x45, 0xd8, 0xc2, 0xf2, 0x82, 0xac, 0x83,
+  0x34, 0x46, 0xa9, 0x3c, 0x2f, 0xc6, 0x12, 0x55, 0x99, 0xce, 0x17, 0x00,
+  0x26, 0x7a, 0x3c, 0x8d, 0xc6, 0xa7, 0x57, 0x04, 0xe3, 0x72, 0x5c, 0xae,
+  0xa7, 0x73, 0x7c, 0xc3, 0x18, 0x04, 0x70, 0x45, 0x09, 0xee, 0xbe, 0x5c,
+  0xb6, 0xc9, 0xbb, 0xc1, 0xf6, 0xbb, 0x21, 0x4c, 0x94, 0x95, 0x5e, 0xa2,
+  0x16, 0xd0, 0x88, 0xa6, 0xf1, 0xd6, 0xa8, 0xc5, 0x09, 0x99, 0xd1, 0x80,
+  0xc3, 0xcf, 0xbe, 0xaa, 0x94, 0xe2, 0x07, 0xd2, 0x25, 0x3b, 0xfc, 0x5f,
+  0x6b, 0x1a, 0xdd, 0xf3, 0xfa, 0x3b, 0xf0, 0x85, 0xb6, 0x7e, 0x56, 0x43,
+  0x95, 0xbc, 0xfd, 0x96, 0xbc, 0xf7, 0xf1, 0x41, 0xa9, 0x8a, 0x17, 0x7b,
+  0xe0, 0x0c, 0x96, 0x31, 0x29, 0x6e, 0x83, 0x1d, 0x09, 0xce, 0x1c, 0x46,
+  0x03, 0x32, 0x13, 0x8f, 0xb9, 0xb4, 0xf0, 0xdf, 0x71, 0xd6, 0x11, 0xbe,
+  0x6d, 0x6f, 0x9b, 0x34, 0x70, 0x38, 0x9f, 0xe3, 0xdd, 0x69, 0xe0, 0x3c,
+  0xef, 0xc1, 0x0c, 0x3d, 0xf2, 0x27, 0xa2, 0x5f, 0xec, 0x8a, 0xad, 0x96,
+  0xce, 0xcc, 0x60, 0x78, 0xa4, 0xe3, 0x7d, 0xe6, 0xe3, 0x7d, 0x86, 0xf1,
+  0xf6, 0xe0, 0xbf, 0xe2, 0x40, 0xf8, 0x07, 0x41, 0x6c, 0x9f, 0x90, 0x35,
+  0xa2, 0x7d, 0x1d, 0xbe, 0xa6, 0xea, 0xce, 0xdb, 0xb7, 0x05, 0x22, 0xdb,
+  0xe4, 0x73, 0xcb, 0xa0, 0x21, 0x40, 0x54, 0x23, 0xf8, 0xdd, 0x56, 0x0a,
+  0xc7, 0x3a, 0xb4, 0xaa, 0x4c, 0x49, 0xb6, 0x2e, 0x91, 0xbc, 0x28, 0x33,
+  0xd0, 0x49, 0x60, 0x92, 0x71, 0x4e, 0xb3, 0xb7, 0x92, 0x68, 0xab, 0x55,
+  0x9c, 0xe7, 0x8c, 0xfa, 0x3e, 0x6e, 0xee, 0x8f, 0x5b, 0xc7, 0x78, 0x1e,
+  0x6a, 0xbc, 0x85, 0x1e, 0x11, 0x0e, 0x48, 0xb6, 0x8e, 0x7b, 0xfc, 0x49,
+  0x5b, 0x65, 0xb3, 0x0c, 0xed, 0xbd, 0x8c, 0xdd, 0xac, 0x9b, 0x5a, 0x32,
+  0xed, 0x94, 0x92, 0x89, 0x61, 0xd0, 0x5d, 0xad, 0xe3, 0x45, 0x19, 0x7d,
+  0xf6, 0x4d, 0x34, 0xd2, 0x6e, 0x51, 0x8c, 0x14, 0x6e, 0xe2, 0x30, 0x97,
+  0xce, 0xca, 0xc6, 0x4f, 0xe8, 0x67, 0x6d, 0x1d, 0x27, 0x2e, 0x9b, 0x1c,
+  0x7b, 0xc0, 0x66, 0x87, 0x0f, 0x5a, 0xdd, 0xcf, 0xa1, 0x17, 0xd8, 0x5b,
+  0x3a, 0x69, 0x38, 0x83, 0x62, 0x80, 0x3e, 0x70, 0xcf, 0x16, 0x9e, 0xef,
+  0xda, 0x89, 0xf9, 0x0c, 0x47, 0xfd, 0xa6, 0x86, 0xcd, 0xcc, 0x1c, 0x44,
+  0x34, 0x96, 0xc0, 0xe0, 0x58, 0x86, 0x5f, 0xa9, 0xbd, 0xc5, 0xe3, 0xaa,
+  0xf2, 0xa8, 0xc2, 0xc3, 0xa0, 0xe4, 0x05, 0x18, 0x22, 0x25, 0x26, 0x75,
+  0xa9, 0xfe, 0xe9, 0x32, 0x55, 0xd5, 0xcc, 0x13, 0x93, 0x6c, 0x0b, 0x4d,
+  0xef, 0x84, 0x1f, 0xe8, 0xbf, 0x84, 0x36, 0xff, 0xc7, 0xbb, 0xb7, 0xaf,
+  0xc1, 0x01, 0x83, 0x07, 0x6b, 0x1a, 0x27, 0x32, 0x60, 0x6c, 0x04, 0xba,
+  0x11, 0x2b, 0x9f, 0xab, 0x54, 0x23, 0x8b, 0x47, 0xa1, 0x26, 0x7f, 0xc9,
+  0x34, 0x39, 0x34, 0x65, 0x1d, 0xc1, 0x02, 0x5c, 0x81, 0x3c, 0xa2, 0x05,
+  0xef, 0x4a, 0x6a, 0x6b, 0x62, 0x12, 0x29, 0xbc, 0x95, 0x6a, 0x47, 0x66,
+  0x39, 0x03, 0x47, 0x32, 0xe5, 0xce, 0x38, 0xe6, 0x14, 0x61, 0xc8, 0x90,
+  0xda, 0x18, 0xea, 0x1b, 0x98, 0x76, 0x97, 0x1c, 0x2e, 0xe3, 0x76, 0x47,
+  0x23, 0x70, 0x83, 0x7a, 0x70, 0xa9, 0x5a, 0x6e, 0x04, 0x6f, 0x58, 0x0f,
+  0x4f, 0x18, 0xcb, 0x9f, 0x98, 0x81, 0x6e, 0x00, 0x3b, 0x1a, 0x1a, 0xe0,
+  0xee, 0x34, 0x86, 0x2b, 0xd6, 0xbb, 0x0c, 0xc1, 0x7d, 0x03, 0x10, 0xc5,
+  0xfe, 0x95, 0x17, 0xe5, 0x04, 0x55, 0x86, 0xb2, 0x4a, 0x20, 0x1f, 0x8e,
+  0x64, 0x3a, 0xcb, 0x2d, 0x18, 0xdd, 0xe5, 0x06, 0x33, 0x14, 0xdb, 0x6c,
+  0x9e, 0x72, 0x33, 0x79, 0xfe, 0x06, 0x64, 0x60, 0x23, 0xd1, 0x53, 0xdf,
+  0x9f, 0xf0, 0xf0, 0x73, 0x6c, 0xf2, 0xf0, 0x84, 0xeb, 0x2c, 0x23, 0x66,
+  0x62, 0xb1, 0x87, 0xb8, 0xcf, 0x9b, 0xb8, 0xd0, 0x15, 0x6e, 0xf4, 0xc3,
+  0x5c, 0xe9, 0x86, 0x1e, 0xb0, 0xd8, 0x60, 0x2f, 0xb8, 0xcb, 0x51, 0x36,
+  0x73, 0xe3, 0xe2, 0x5e, 0x81, 0x1f, 0x63, 0x55, 0x80, 0xd5, 0x22, 0x5a,
+  0x99, 0x64, 0x69, 0xab, 0x41, 0xee, 0x0a, 0x08, 0x3f, 0x9e, 0x8c, 0x54,
+  0x59, 0x7a, 0xa0, 0x9a, 0x56, 0xcc, 0x03, 0xb5, 0xad, 0xb4, 0x35, 0x98,
+  0x3c, 0x12, 0x3b, 0xb6, 0x4d, 0x4c, 0xa7, 0x3f, 0x6c, 0x2b, 0x3b, 0xfd,
+  0x09, 0x17, 0x3b, 0xcd, 0x69, 0x34, 0x9a, 0x80, 0x68, 0xfc, 0x07, 0xe1,
+  0x2f, 0x42, 0xf3, 0xd5, 0xa8, 0xf2, 0xc0, 0x38, 0x0f, 0x5c, 0x93, 0xf4,
+  0xb2, 0x20, 0x3e, 0xb6, 0xf0, 0x8c, 0x5f, 0x90, 0xdf, 0x83, 0x2f, 0x01,
+  0x5e, 0xa9, 0xcc, 0x76, 0x65, 0xd7, 0xc4, 0x6b, 0x3f, 0x36, 0x0c, 0xab,
+  0xfd, 0x28, 0xa8, 0xaa, 0xda, 0x78, 0x80, 0xc2, 0xf3, 0x42, 0xe5, 0xf1,
+  0x50, 0xac, 0x8e, 0x90, 0x34, 0xad, 0x33, 0x27, 0xc0, 0x82, 0x6a, 0xa0,
+  0xd1, 0x6c, 0x41, 0xd8, 0xb1, 0xa8, 0x2e, 0x39, 0x5b, 0x50, 0x98, 0x5b,
+  0xb2, 0x70, 0x12, 0x72, 0x1f, 0xae, 0x41, 0xff, 0x65, 0xa9, 0x5d, 0xca,
+  0x2a, 0xe2, 0x96, 0x4e, 0x00, 0x7e, 0x2b, 0xcb, 0x10, 0x9d, 0x5e, 0x89,
+  0x1c, 0x30, 0x9e, 0x97, 0x44, 0x9d, 0x8c, 0xf5, 0x94, 0x79, 0x63, 0x91,
+  0x06, 0x16, 0x29, 0xe0, 0x02, 0x1a, 0xc6, 0x3d, 0x27, 0x45, 0x84, 0xcd,
+  0x84, 0xc8, 0x13, 0x43, 0x9b, 0x91, 0x22, 0xad, 0x29, 0x6d, 0x84, 0xc5,
+  0xb0, 0x06, 0x0b, 0xb0, 0xa8, 0x6c, 0xeb, 0x2f, 0x17, 0xc8, 0xb9, 0xa6,
+  0x18, 0x6f, 0x16, 0xb8, 0x65, 0xbe, 0x9a, 0xd6, 0x39, 0xb5, 0x1e, 0xaa,
+  0x43, 0x05, 0xac, 0x69, 0x0c, 0x86, 0x9b, 0x5d, 0x11, 0x1f, 0x2f, 0xe8,
+  0x8d, 0xef, 0x45, 0x93, 0x4e, 0xf1, 0x6a, 0xa0, 0xb1, 0xbd, 0x25, 0xb2,
+  0x9c, 0x60, 0x36, 0x82, 0x89, 0x7b, 0xe1, 0x60, 0x40, 0x56, 0xe4, 0xce,
+  0x0b, 0xa1, 0x7c, 0xf1, 0x42, 0xb2, 0xfd, 0x1c, 0xd7, 0x35, 0x19, 0x7e,
+  0x3f, 0x6a, 0xb2, 0x22, 0x99, 0x78, 0xcf, 0xe1, 0x57, 0x28, 0xbd, 0xba,
+  0xa0, 0x61, 0x03, 0x6b, 0xd4, 0x84, 0x08, 0xd3, 0xcd, 0x69, 0x09, 0x93,
+  0x8c, 0x0a, 0x46, 0x94, 0xe4, 0xd4, 0xe2, 0xf8, 0x44, 0x4b, 0x43, 0xb6,
+  0xbe, 0x97, 0xed, 0x20, 0x91, 0xca, 0x4f, 0xb9, 0x92, 0xed, 0x24, 0xea,
+  0x66, 0x47, 0xde, 0x22, 0x2a, 0xb6, 0x43, 0x71, 0xe7, 0xe8, 0x9c, 0xc8,
+  0x0a, 0xd6, 0xde, 0x08, 0x6d, 0x63, 0xcb, 0xc9, 0x52, 0xa3, 0xcd, 0xce,
+  0xe2, 0xb0, 0x34, 0xc2, 0x8b, 0x01, 0x78, 0x18, 0x49, 0x9d, 0x42, 0x4f,
+  0x9f, 0x01, 0xba, 0x88, 0x72, 0x50, 0xa4, 0x94, 0xc6, 0x6a, 0xbd, 0x55,
+  0x4b, 0xa4, 0x71, 0xf8, 0x95, 0x47, 0x27, 0xf2, 0x90, 0x60, 0xf6, 0xfc,
+  0x62, 0x35, 0x5f, 0xb4, 0xbc, 0xee, 0x4a, 0x0d, 0x0c, 0x28, 0x68, 0x03,
+  0xcc, 0x9e, 0x6c, 0x5e, 0x09, 0xb2, 0xc2, 0x63, 0x39, 0x01, 0x25, 0x77,
+  0xd9, 0xde, 0xae, 0xe6, 0x3c, 0xd5, 0xaa, 0x79, 0x24, 0xfb, 0xb1, 0xa3,
+  0x87, 0xcd, 0x5c, 0x21, 0xe9, 0xa8, 0x13, 0x3b, 0x1b, 0x58, 0x7c, 0xc5,
+  0x8b, 0x13, 0x6b, 0xf6, 0x0d, 0xd7, 0x94, 0xb1, 0x90, 0x4b, 0x8f, 0x54,
+  0x93, 0x8d, 0x66, 0xaf, 0xf2, 0xa1, 0xc6, 0x7f, 0x1b, 0xe4, 0xc0, 0xd1,
+  0x8b, 0x37, 0x24, 0xd2, 0x37, 0x81, 0xd5, 0x84, 0xce, 0x3f, 0x15, 0x53,
+  0x61, 0x2f, 0xd9, 0x5d, 0x47, 0x6a, 0xe0, 0x23, 0xcb, 0x7d, 0xb1, 0x18,
+  0x79, 0x6e, 0x3a, 0x15, 0x42, 0xae, 0x0a, 0x84, 0x2d, 0x5e, 0x3d, 0x98,
+  0x96, 0xab, 0xb0, 0xa7, 0xca, 0x2d, 0x44, 0x16, 0x73, 0xc7, 0x05, 0x64,
+  0xe6, 0x90, 0xb3, 0x6a, 0xc2, 0xad, 0x42, 0xde, 0x51, 0x1b, 0x3f, 0xb5,
+  0x7c, 0x1e, 0x3a, 0xbc, 0xb8, 0x68, 0xa8, 0xc1, 0xf0, 0x66, 0x42, 0x21,
+  0x07, 0xa5, 0xc9, 0xde, 0xdf, 0x2f, 0xff, 0x7a, 0xf9, 0xfe, 0xef, 0x97,
+  0x72, 0x82, 0x57, 0x71, 0x36, 0xb0, 0x6d, 0x41, 0xc5, 0xe6, 0xb6, 0x5f,
+  0x5a, 0xaa, 0xd2, 0x35, 0x95, 0xa9, 0x14, 0xec, 0x1e, 0x79, 0xe0, 0xe2,
+  0x61, 0x2d, 0x43, 0x8a, 0xcc, 0x60, 0xc0, 0xd5, 0x0d, 0x9e, 0xd7, 0xc2,
+  0x54, 0x0e, 0x5f, 0x38, 0xdd, 0x65, 0x18, 0x9d, 0xb3, 0x62, 0xd6, 0xd2,
+  0x2e, 0xd9, 0x5e, 0x35, 0xfe, 0xdd, 0x03, 0xe6, 0xc0, 0xab, 0x76, 0xaa,
+  0xc9, 0x27, 0x9d, 0x23, 0x2b, 0x45, 0xfd, 0x6a, 0xf9, 0xc5, 0x73, 0xff,
+  0x73, 0x68, 0x63, 0x59, 0x51, 0x25, 0xd2, 0x85, 0x43, 0x6b, 0xf5, 0x4b,
+  0x5e, 0xc6, 0xc2, 0xa0, 0x57, 0x66, 0x60, 0x70, 0xbb, 0x25, 0xdb, 0x5d,
+  0x09, 0x65, 0xfc, 0x4a, 0xfa, 0xdf, 0xfa, 0x83, 0x42, 0xe8, 0x49, 0x07,
+  0xb1, 0x45, 0x6a, 0x77, 0x5c, 0x7a, 0x2a, 0x51, 0xf0, 0x0c, 0x59, 0x82,
+  0x64, 0x8a, 0xee, 0xc9, 0x9d, 0x13, 0x83, 0xe4, 0xf6, 0xf1, 0x17, 0x9e,
+  0x42, 0x98, 0xa9, 0x48, 0x51, 0xde, 0x51, 0x68, 0x81, 0x16, 0x76, 0x0c,
+  0xfc, 0x4d, 0x5d, 0x6b, 0x7c, 0x0d, 0xce, 0xf0, 0xd9, 0xe9, 0xf5, 0xc5,
+  0x79, 0xd5, 0x4e, 0xad, 0x11, 0x8c, 0xbc, 0x04, 0x50, 0x95, 0xb4, 0xb2,
+  0xdc, 0xd8, 0xae, 0x9a, 0x06, 0xde, 0x7f, 0xc2, 0xa5, 0x46, 0xb6, 0x2a,
+  0x92, 0xdc, 0xc0, 0xc7, 0x0a, 0x4d, 0x0a, 0xda, 0x89, 0x05, 0x5f, 0x56,
+  0x28, 0x93, 0x2f, 0xc0, 0x08, 0x28, 0x94, 0x4e, 0xf1, 0x57, 0xe8, 0x72,
+  0x2b, 0xaf, 0x7a, 0x3d, 0xb0, 0x78, 0xc4, 0x45, 0x1e, 0x4b, 0x0f, 0x2d,
+  0x27, 0x96, 0xdb, 0x0d, 0x97, 0xe8, 0x74, 0x00, 0xc9, 0x7c, 0x20, 0x51,
+  0x67, 0x0c, 0x6d, 0x24, 0x40, 0xd7, 0xac, 0xf5, 0x09, 0xf9, 0xfe, 0x43,
+  0x07, 0xff, 0x37, 0x1a, 0xc5, 0xcc, 0x5c, 0x4d, 0x2b, 0xc0, 0xd2, 0x31,
+  0xf0, 0xb7, 0xba, 0x3c, 0x20, 0x7b, 0x36, 0xd6, 0x8c, 0x9d, 0x52, 0x05,
+  0xc5, 0x19, 0x53, 0x4a, 0x7a, 0xe2, 0x84, 0x3b, 0xf1, 0x02, 0x58, 0x98,
+  0x69, 0x0c, 0xfc, 0x47, 0x23, 0x56, 0xa7, 0xf7, 0xee, 0x02, 0xa3, 0xbd,
+  0xac, 0x5e, 0x15, 0x8f, 0xdc, 0x38, 0x89, 0xaa, 0x88, 0x11, 0xec, 0xfd,
+  0x29, 0x1b, 0xba, 0x90, 0xea, 0x02, 0x46, 0x63, 0x01, 0x5f, 0xcc, 0x38,
+  0xbf, 0xa5, 0xc1, 0x2d, 0x18, 0x49, 0xc7, 0x64, 0xbf, 0x79, 0x06, 0x12,
+  0x67, 0xf5, 0x35, 0x9b, 0x8f, 0x1c, 0x3b, 0x1e, 0x0d, 0xed, 0x7e, 0xc1,
+  0x83, 0x28, 0xcf, 0x99, 0xed, 0x68, 0xad, 0x66, 0xc6, 0xc4, 0xc3, 0xae,
+  0x1a, 0xac, 0xad, 0xda, 0x1c, 0xc5, 0x15, 0x28, 0x62, 0x9e, 0xa5, 0x21,
+  0xf6, 0x8b, 0xe9, 0x0c, 0xbe, 0x3e, 0xf0, 0xdf, 0x31, 0xc7, 0x05, 0x3e,
+  0x9a, 0x73, 0x19, 0x6c, 0xf5, 0x75, 0x44, 0x39, 0x64, 0x43, 0xac, 0xff,
+  0x8b, 0x17, 0xb8, 0x25, 0xad, 0x81, 0x7b, 0x07, 0xc5, 0x92, 0x17, 0xde,
+  0x01, 0x94, 0xee, 0xa0, 0x2c, 0x26, 0x3b, 0x05, 0x35, 0xe4, 0x96, 0x54,
+  0x68, 0x94, 0x27, 0x4b, 0xcc, 0x21, 0x28, 0x0e, 0xab, 0x51, 0xc6, 0x64,
+  0x54, 0x96, 0x35, 0x51, 0x33, 0x27, 0x19, 0xc4, 0x42, 0xee, 0xc4, 0x1c,
+  0x59, 0x60, 0x24, 0x85, 0x2e, 0x9f, 0x7c, 0x1a, 0x94, 0x13, 0xea, 0xa0,
+  0x24, 0xb0, 0x2a, 0x48, 0x81, 0xe1, 0xd4, 0x6b, 0xfa, 0x2d, 0x39, 0xa7,
+  0x98, 0x3e, 0x01, 0x3f, 0x67, 0x9d, 0xcc, 0x3b, 0xfb, 0x20, 0x74, 0x5c,
+  0xf6, 0x40, 0x8f, 0x07, 0xf3, 0x2d, 0x20, 0xc2, 0xad, 0xf9, 0x62, 0x00,
+  0xff, 0xa6, 0x98, 0x98, 0xe6, 0x29, 0x38, 0xec, 0x23, 0x32, 0xc0, 0x0d,
+  0xab, 0x74, 0xc5, 0xd6, 0x87, 0xec, 0xdf, 0x36, 0x9f, 0xf7, 0x21, 0xff,
+  0xaf, 0x4d, 0x22, 0xf8, 0xef, 0xb0, 0x24, 0x87, 0x33, 0x6c, 0xc9, 0x1e,
+  0x7a, 0xe6, 0x41, 0x8b, 0xd7, 0x58, 0x60, 0x8a, 0x46, 0x92, 0x40, 0x44,
+  0x0b, 0xb9, 0x64, 0xd6, 0x59, 0xc6, 0x26, 0x43, 0x13, 0x9b, 0xa0, 0x3e,
+  0x91, 0xb1, 0x2d, 0x8b, 0x40, 0x2a, 0x8d, 0xba, 0x88, 0xb4, 0xb4, 0x04,
+  0x3a, 0xd6, 0x4d, 0x56, 0x33, 0x9f, 0xc5, 0xc8, 0x88, 0x79, 0x11, 0x0d,
+  0x97, 0x62, 0xce, 0x56, 0xc5, 0xa4, 0x8a, 0x3a, 0xc3, 0xfa, 0xcb, 0x7d,
+  0x74, 0xb1, 0x2b, 0x04, 0x56, 0xb9, 0xeb, 0x12, 0xe1, 0xf9, 0xd8, 0x08,
+  0x7d, 0x1f, 0x3d, 0x3d, 0x53, 0x9b, 0x75, 0x4d, 0x85, 0x74, 0x21, 0xdd,
+  0x0a, 0xf2, 0xfd, 0x0b, 0xa5, 0x2b, 0x51, 0xa8, 0xcc, 0x4a, 0x44, 0xe6,
+  0x4c, 0x64, 0xc7, 0xa8, 0xc4, 0x40, 0xe4, 0x33, 0x39, 0xe2, 0xf1, 0x67,
+  0xf0, 0xd5, 0x8b, 0x41, 0x2b, 0xe2, 0xfd, 0xc1, 0x2b, 0x2c, 0x26, 0x0f,
+  0x12, 0xad, 0xa2, 0x80, 0x57, 0x3b, 0x4f, 0xb8, 0xec, 0xb1, 0x8b, 0xd5,
+  0xcf, 0x2f, 0xb0, 0x5a, 0x18, 0x73, 0xe3, 0x85, 0x57, 0x5d, 0xd8, 0x21,
+  0x87, 0x5a, 0xa9, 0x44, 0x55, 0xf5, 0x74, 0xb3, 0x5c, 0xb1, 0xb3, 0x4a,
+  0x53, 0xc5, 0x7d, 0x45, 0x96, 0x12, 0x1b, 0xc3, 0x59, 0x89, 0x98, 0x5d,
+  0x90, 0xae, 0xab, 0x31, 0x55, 0xb5, 0x82, 0xde, 0x15, 0xeb, 0xfe, 0x80,
+  0xec, 0x2a, 0xbb, 0xaf, 0x1d, 0xab, 0x97, 0x23, 0x6f, 0xba, 0x4e, 0xa8,
+  0x6d, 0x79, 0xae, 0xc5, 0xf5, 0x75, 0x5d, 0x43, 0x51, 0xca, 0x8f, 0x11,
+  0x32, 0x4e, 0x9c, 0xd3, 0x95, 0xb8, 0x13, 0x42, 0xeb, 0x59, 0x44, 0xd1,
+  0xfd, 0x24, 0xa4, 0x50, 0x29, 0x9e, 0xae, 0x29, 0x0b, 0x0c, 0xfd, 0xa6,
+  0x0f, 0xed, 0x28, 0x76, 0x6a, 0xf3, 0x7e, 0xea, 0xe4, 0x39, 0xc6, 0x5d,
+  0xbc, 0xb1, 0x31, 0xaf, 0x17, 0x77, 0x56, 0x5d, 0x7c, 0x5a, 0x50, 0x48,
+  0x2f, 0xc4, 0x0b, 0x93, 0x0c, 0x49, 0x21, 0xc9, 0x9c, 0xb2, 0x75, 0xcc,
+  0x2e, 0x53, 0x52, 0x0e, 0xef, 0x1c, 0x1c, 0x1c, 0x1c, 0x59, 0x63, 0xfb,
+  0x35, 0xbf, 0x6b, 0x4b, 0xdc, 0x8d, 0xd2, 0x3a, 0xee, 0xd1, 0xa5, 0x6c,
+  0x52, 0x1a, 0x52, 0xcc, 0x82, 0x46, 0xda, 0x00, 0x59, 0xd6, 0x1c, 0x50,
+  0x13, 0xfa, 0x26, 0x4f, 0x9d, 0x1f, 0x99, 0x21, 0xf0, 0xb8, 0x10, 0x5e,
+  0xc2, 0xf6, 0x8a, 0x5d, 0xe3, 0x8a, 0x80, 0xb2, 0x9b, 0x5b, 0xb7, 0x6a,
+  0xd6, 0x58, 0xd0, 0x1b, 0x86, 0xc3, 0x4f, 0xc5, 0x25, 0x89, 0xd9, 0xc5,
+  0x3c, 0x2f, 0x9d, 0x28, 0x36, 0xe8, 0x65, 0xa0, 0x21, 0xeb, 0x3f, 0x26,
+  0x9d, 0xdd, 0x7e, 0x4b, 0x6b, 0xfb, 0xf1, 0x67, 0xf8, 0x73, 0xa3, 0xf5,
+  0x48, 0x85, 0x7c, 0xda, 0x6d, 0xcf, 0xd8, 0xad, 0xae, 0xd7, 0x6f, 0xa6,
+  0x5e, 0xc6, 0x4e, 0x7a, 0x2b, 0xbd, 0x91, 0xe0, 0x38, 0xd5, 0x84, 0xcf,
+  0xfb, 0x60, 0x45, 0x02, 0x46, 0xc1, 0xd8, 0xc0, 0x69, 0x79, 0x42, 0x15,
+  0xff, 0x45, 0x6a, 0x96, 0x9f, 0x33, 0x51, 0x71, 0x87, 0x6a, 0x8d, 0xa6,
+  0x8d, 0x5a, 0x21, 0x12, 0x9b, 0x15, 0x16, 0xa4, 0xf1, 0x16, 0x26, 0x5b,
+  0x41, 0xa3, 0xca, 0xc2, 0xd6, 0xc4, 0xf4, 0x26, 0xe1, 0x99, 0x44, 0x45,
+  0x9d, 0x05, 0xb8, 0xa9, 0x81, 0x68, 0x2b, 0xed, 0x69, 0x55, 0xd6, 0x55,
+  0x08, 0xd1, 0x9a, 0x46, 0x0a, 0xd5, 0x06, 0xe2, 0xfe, 0x2e, 0xd1, 0xa6,
+  0x4a, 0xa5, 0xe5, 0xf1, 0xbc, 0x50, 0xab, 0x3a, 0x67, 0x21, 0xb3, 0x34,
+  0x8d, 0x90, 0xbb, 0x40, 0xad, 0xa3, 0x27, 0x52, 0x7d, 0x68, 0xa9, 0xe3,
+  0x98, 0x58, 0xed, 0xc8, 0x69, 0x3f, 0x43, 0xaa, 0x83, 0x96, 0xed, 0xfa,
+  0xdc, 0xe7, 0x40, 0x32, 0xf7, 0x0b, 0xee, 0x6d, 0x41, 0xe9, 0x6c, 0xf1,
+  0x13, 0x92, 0x2e, 0xde, 0x10, 0x88, 0x1e, 0x1f, 0xde, 0x23, 0x53, 0xb8,
+  0x06, 0xae, 0xe2, 0xd6, 0xb7, 0xc9, 0xcc, 0x61, 0xb1, 0x5c, 0xb0, 0x0f,
+  0xf9, 0x6d, 0x4c, 0x78, 0x0a, 0x90, 0xdd, 0xcf, 0x83, 0xc7, 0x00, 0x13,
+  0x8c, 0xa5, 0x38, 0x78, 0x3d, 0xae, 0x4f, 0x59, 0x65, 0x0a, 0x3b, 0x46,
+  0x69, 0x74, 0x71, 0x59, 0xc9, 0x6c, 0x4e, 0xcb, 0x02, 0xd9, 0x41, 0xd9,
+  0x8b, 0xb2, 0x72, 0xe1, 0xc9, 0xc1, 0x10, 0x7c, 0xa5, 0xc0, 0x71, 0xf4,
+  0x96, 0xec, 0xb2, 0xcc, 0x84, 0xfa, 0xf7, 0x60, 0x6d, 0x06, 0x20, 0x7a,
+  0x84, 0x9f, 0xc7, 0x92, 0x55, 0x18, 0xb1, 0x84, 0x46, 0xb0, 0x98, 0x9e,
+  0x2f, 0xdd, 0xa5, 0x8a, 0x3f, 0x54, 0x12, 0xa4, 0x95, 0xb9, 0xb1, 0xba,
+  0xb6, 0x1a, 0x36, 0x4f, 0x66, 0xb2, 0x3c, 0x47, 0x3d, 0x0a, 0xee, 0x39,
+  0x5c, 0x01, 0x51, 0x8b, 0x02, 0x66, 0xe5, 0x07, 0x91, 0x50, 0x7a, 0xcd,
+  0x0e, 0x23, 0xda, 0xd6, 0x3f, 0x3a, 0xb8, 0x4c, 0x9d, 0x2b, 0xde, 0xd0,
+  0x6a, 0xf1, 0x88, 0xe3, 0xa0, 0x28, 0x44, 0x79, 0x8e, 0x29, 0x8f, 0x4a,
+  0x0e, 0xfb, 0x7d, 0xd3, 0xf6, 0x54, 0xdc, 0xfd, 0xb2, 0x41, 0x2f, 0xae,
+  0x9d, 0x5b, 0xcb, 0x68, 0xe3, 0xe7, 0xbe, 0xb3, 0x52, 0xc0, 0xaa, 0xe4,
+  0xc2, 0xaa, 0xeb, 0xa2, 0x00, 0xd5, 0xf7, 0xd3, 0xcf, 0x40, 0xed, 0xee,
+  0x17, 0x7a, 0x1f, 0xa7, 0x86, 0x78, 0x2b, 0xe5, 0xfd, 0x31, 0xe9, 0xb3,
+  0x32, 0x60, 0x41, 0x99, 0xd2, 0xca, 0x9b, 0xcc, 0xc0, 0x92, 0xac, 0x53,
+  0x63, 0xc9, 0x5a, 0x0a, 0x89, 0xfc, 0xfa, 0x2b, 0x69, 0x48, 0xa3, 0x34,
+  0x2b, 0x94, 0x9e, 0xfe, 0xb1, 0x5e, 0x31, 0x9e, 0x63, 0xa9, 0x0c, 0x31,
+  0x2e, 0xca, 0xf1, 0x74, 0xdb, 0xd4, 0xe7, 0x88, 0x0b, 0x14, 0xa8, 0x98,
+  0x9d, 0x12, 0x74, 0x91, 0x12, 0x9a, 0x32, 0x1f, 0x49, 0x3c, 0xce, 0xb3,
+  0x11, 0x78, 0xfc, 0x66, 0xb0, 0xab, 0xa4, 0x39, 0x1f, 0x9d, 0x83, 0xc6,
+  0x5d, 0xeb, 0xe3, 0xef, 0x6d, 0x30, 0x71, 0x30, 0xa5, 0x6a, 0x3a, 0x98,
+  0xc5, 0x7b, 0x94, 0x1c, 0x18, 0x17, 0x15, 0x18, 0x03, 0x62, 0xbb, 0x33,
+  0x6e, 0x13, 0xb6, 0x8f, 0x1c, 0x9f, 0x25, 0x5a, 0x18, 0x41, 0x59, 0x56,
+  0xfd, 0x3e, 0x2e, 0x54, 0x5a, 0x49, 0x3c, 0x79, 0xc2, 0x23, 0x4d, 0x46,
+  0x73, 0xea, 0x41, 0x12, 0x50, 0x33, 0xb6, 0x4c, 0xbf, 0x59, 0x67, 0x8d,
+  0x79, 0x45, 0x40, 0xac, 0x0b, 0x44, 0xa3, 0xdc, 0x33, 0xe4, 0x0d, 0x5f,
+  0x39, 0x9e, 0xcf, 0xf3, 0xe9, 0x4c, 0x2e, 0x65, 0xf2, 0x34, 0x4d, 0x1c,
+  0x62, 0x3d, 0xb6, 0x73, 0xeb, 0x78, 0x41, 0xd7, 0x6a, 0xbe, 0x42, 0x35,
+  0x69, 0x69, 0x21, 0xa7, 0xfe, 0x1c, 0x7b, 0xc1, 0x4c, 0x94, 0x27, 0x29,
+  0x8e, 0xdd, 0x36, 0x11, 0x6a, 0xe6, 0xcf, 0xc4, 0xfa, 0x55, 0xe8, 0x3b,
+  0x56, 0x0a, 0x6c, 0xb5, 0x0a, 0x81, 0x28, 0x75, 0x0d, 0x5e, 0x94, 0xac,
+  0x81, 0xc8, 0x62, 0x27, 0x42, 0xe4, 0xa5, 0xc2, 0xe2, 0xcd, 0xbc, 0x73,
+  0x09, 0xec, 0xd4, 0x79, 0xe7, 0x00, 0x4f, 0x62, 0xf5, 0x47, 0x06, 0xc9,
+  0x98, 0xea, 0x7c, 0xea, 0xb4, 0x79, 0xe6, 0x8f, 0x50, 0x05, 0x61, 0xa5,
+  0x6c, 0x60, 0x92, 0xde, 0xf4, 0x75, 0x7a, 0x75, 0x08, 0x18, 0x52, 0xbf,
+  0xab, 0x98, 0x4a, 0x68, 0xde, 0x94, 0xb8, 0x8c, 0x7a, 0x06, 0x5d, 0xf7,
+  0x1e, 0x0b, 0x49, 0x2d, 0xa3, 0x15, 0xf3, 0xa3, 0xd2, 0xb5, 0xa4, 0x92,
+  0xeb, 0x49, 0xfd, 0x26, 0x56, 0x91, 0x22, 0x9c, 0xc4, 0xed, 0xa2, 0x69,
+  0x3b, 0x5e, 0x26, 0x8d, 0x70, 0x84, 0x55, 0xf1, 0xb1, 0x7f, 0x23, 0xfb,
+  0x32, 0x15, 0xa4, 0x94, 0xae, 0x42, 0x55, 0x83, 0xa2, 0x06, 0xac, 0x0d,
+  0xd4, 0x51, 0x48, 0x7e, 0x19, 0x32, 0x2f, 0x5e, 0x74, 0xec, 0x8a, 0x34,
+  0x83, 0x08, 0x9f, 0x3b, 0x11, 0x3e, 0xab, 0x28, 0x65, 0x11, 0xfb, 0x46,
+  0xdc, 0xff, 0xe6, 0x80, 0xd9, 0xc0, 0xe6, 0x28, 0x36, 0x16, 0x28, 0xfe,
+  0x08, 0xc8, 0xa3, 0xf7, 0x2f, 0x8f, 0xcb, 0x3e, 0x6f, 0x75, 0x42, 0x21,
+  0x99, 0xf1, 0x94, 0x56, 0x82, 0x41, 0xb3, 0xef, 0xf4, 0x0f, 0x8c, 0x55,
+  0xcb, 0x4d, 0x4a, 0x0e, 0x36, 0x29, 0x11, 0x94, 0xd6, 0xe3, 0x5a, 0xa5,
+  0x3f, 0xb7, 0xd0, 0xc0, 0x0a, 0x43, 0xd9, 0x43, 0xbc, 0x84, 0x25, 0x4c,
+  0xf2, 0xb5, 0x56, 0x57, 0x0f, 0x5e, 0x3f, 0x4c, 0xf6, 0x5d, 0xbd, 0x9f,
+  0x94, 0x09, 0x3f, 0x98, 0x5d, 0x87, 0xa7, 0x84, 0x4a, 0xea, 0x72, 0x98,
+  0xd4, 0xe0, 0x2d, 0x32, 0xda, 0x6f, 0x74, 0xf0, 0x41, 0x59, 0xf7, 0x92,
+  0x3a, 0x99, 0xd2, 0x93, 0x7c, 0x3f, 0xd5, 0x57, 0x39, 0x56, 0x1c, 0x56,
+  0x65, 0x56, 0x80, 0x7e, 0x70, 0x3e, 0xab, 0xb2, 0xad, 0x3d, 0x1b, 0x9e,
+  0x96, 0x46, 0xf1, 0x2b, 0xf1, 0x5b, 0xe6, 0x42, 0x0b, 0x35, 0x32, 0x25,
+  0x33, 0x0b, 0xb7, 0x3a, 0x32, 0x3e, 0x52, 0xca, 0x6c, 0xda, 0xe6, 0x63,
+  0xff, 0x15, 0x22, 0x45, 0x5b, 0x82, 0xef, 0x72, 0x00, 0x90, 0xdd, 0x01,
+  0x86, 0xbf, 0xde, 0x18, 0x33, 0xa3, 0x21, 0xa2, 0x9f, 0x59, 0x69, 0xcd,
+  0x82, 0xb2, 0xeb, 0x01, 0xb1, 0xcc, 0x4b, 0xc4, 0xff, 0x98, 0xef, 0x89,
+  0x2c, 0x76, 0xeb, 0x01, 0x2d, 0x51, 0xcd, 0x3a, 0x20, 0x47, 0x16, 0x34,
+  0x42, 0x11, 0xb3, 0xa4, 0x4e, 0xc0, 0x2c, 0x8f, 0x9f, 0xca, 0x0b, 0xbd,
+  0x71, 0x27, 0x9e, 0xe6, 0x4f, 0xec, 0x41, 0x5f, 0xb3, 0xeb, 0xd7, 0x59,
+  0xf4, 0xbb, 0xb2, 0xfa, 0x58, 0x3f, 0xc9, 0xc4, 0xe3, 0x8d, 0xd9, 0xd2,
+  0x98, 0x82, 0x8b, 0x52, 0x97, 0x7c, 0x10, 0x10, 0xc9, 0x48, 0x66, 0xe8,
+  0x6e, 0x7c, 0x3b, 0xb8, 0xd9, 0x68, 0xc1, 0xd9, 0x65, 0x00, 0x85, 0xd5,
+  0x96, 0xe0, 0x0d, 0x37, 0x82, 0x97, 0xdd, 0x56, 0x50, 0x01, 0x71, 0x74,
+  0xf3, 0x34, 0x2c, 0x29, 0x27, 0x6c, 0xd4, 0x04, 0xc2, 0x9f, 0xb5, 0xe8,
+  0xbb, 0x08, 0x53, 0xad, 0x7c, 0x2f, 0xb1, 0xad, 0x43, 0xf0, 0x83, 0x0e,
+  0xc9, 0xc7, 0x9b, 0x62, 0x9e, 0x4a, 0xca, 0xec, 0xf0, 0x1e, 0xdc, 0xad,
+  0x30, 0x25, 0x79, 0xa4, 0xe9, 0xec, 0x60, 0xf2, 0x46, 0x99, 0x12, 0xeb,
+  0xfc, 0xf1, 0xf3, 0x0d, 0x98, 0xd5, 0x7b, 0xad, 0xaa, 0x48, 0x43, 0xce,
+  0x1c, 0xe5, 0x9b, 0x20, 0xbf, 0xaa, 0xf0, 0x21, 0x6a, 0xf5, 0xf9, 0xd4,
+  0xe2, 0x1f, 0xa7, 0xab, 0x9e, 0x5b, 0xb5, 0xd4, 0xd4, 0x6c, 0x35, 0x3f,
+  0x0e, 0xaf, 0x58, 0x5a, 0x78, 0x09, 0x23, 0xa8, 0x02, 0x6e, 0xe9, 0xb3,
+  0x45, 0xe5, 0xc6, 0x96, 0xc1, 0x2c, 0xac, 0xb4, 0xbd, 0x2a, 0x4a, 0xc7,
+  0x1e, 0xa4, 0x0d, 0x3f, 0x03, 0x80, 0xcd, 0xf5, 0x60, 0x45, 0x5c, 0x8c,
+  0x63, 0xa4, 0x45, 0x4e, 0xe0, 0x21, 0xab, 0x0c, 0xbf, 0x64, 0xc5, 0x10,
+  0x27, 0xe4, 0xa3, 0x95, 0x06, 0x25, 0x00, 0x2b, 0x51, 0x12, 0x8a, 0x1f,
+  0x5f, 0x89, 0xf3, 0xd2, 0xf8, 0x59, 0x38, 0xaf, 0xf8, 0x71, 0x92, 0x84,
+  0xab, 0x15, 0x3c, 0xbd, 0x51, 0x77, 0xff, 0xb5, 0x28, 0x5c, 0x10, 0x10,
+  0x79, 0x11, 0x11, 0xb6, 0xcf, 0xca, 0x74, 0xf0, 0x0b, 0xab, 0x8e, 0xc1,
+  0x0f, 0xe7, 0xe1, 0x44, 0x87, 0xf0, 0xd4, 0x31, 0x99, 0xda, 0x08, 0x51,
+  0x7a, 0xb3, 0x66, 0x31, 0x44, 0x54, 0x9f, 0x1c, 0xca, 0x84, 0xde, 0x7d,
+  0x42, 0x4b, 0xf4, 0x8d, 0x1a, 0x4b, 0x29, 0x1c, 0x63, 0x23, 0xea, 0xf1,
+  0xc2, 0x6d, 0xb2, 0x33, 0x22, 0xc7, 0x27, 0x39, 0x40, 0xa9, 0x78, 0xe1,
+  0x88, 0x35, 0xe3, 0x6d, 0xca, 0x02, 0x29, 0x1b, 0xa6, 0x90, 0x36, 0xcc,
+  0x2c, 0xe7, 0x58, 0xc5, 0xeb, 0x29, 0x93, 0x95, 0x36, 0xa2, 0xd3, 0x6f,
+  0x33, 0xac, 0x46, 0xc3, 0x56, 0x0b, 0x66, 0xba, 0xf2, 0x9d, 0x19, 0xb5,
+  0x7b, 0xff, 0xd3, 0xef, 0xdd, 0xb6, 0xc9, 0x56, 0xd9, 0x88, 0xcf, 0x9d,
+  0xd7, 0xcf, 0x50, 0xfd, 0xc8, 0x50, 0x63, 0xf9, 0xfc, 0x9b, 0x27, 0xcf,
+  0xe7, 0x6b, 0xa7, 0x02, 0xb3, 0x33, 0x80, 0x36, 0x83, 0xf3, 0xef, 0x7f,
+  0xb3, 0xfc, 0x50, 0x49, 0x2a, 0xa8, 0x95, 0x1d, 0x12, 0xc4, 0x5e, 0x79,
+  0x9a, 0x47, 0xcf, 0xf1, 0xf0, 0x73, 0x84, 0x46, 0xc4, 0xb7, 0xf3, 0x11,
+  0xb3, 0x8d, 0xf7, 0x51, 0x9b, 0xf9, 0xc1, 0xcd, 0x8d, 0x32, 0x10, 0x36,
+  0x56, 0xf6, 0xbe, 0xd6, 0x61, 0x67, 0x28, 0x75, 0x30, 0xc4, 0x49, 0x1a,
+  0xe4, 0x17, 0x1e, 0x1e, 0x05, 0xa9, 0x10, 0x7d, 0x4f, 0x18, 0x63, 0x90,
+  0xae, 0x1f, 0x7d, 0xc6, 0x03, 0x8a, 0x05, 0x5d, 0xc3, 0x54, 0x0c, 0x1f,
+  0xdc, 0xe0, 0x2e, 0x6f, 0xa4, 0x3d, 0xce, 0x2f, 0xde, 0x5e, 0x5c, 0x5f,
+  0x3c, 0x50, 0x7f, 0x54, 0x2a, 0x0c, 0xe9, 0x6a, 0xb7, 0x46, 0x15, 0xc9,
+  0x55, 0x9e, 0xe7, 0x86, 0x14, 0x65, 0x33, 0x7b, 0x7d, 0x71, 0x7a, 0x5e,
+  0xe6, 0x25, 0x22, 0x72, 0x0d, 0x26, 0x56, 0x20, 0xfe, 0x84, 0xff, 0xe6,
+  0x0d, 0xeb, 0xdf, 0x25, 0x1f, 0x58, 0xfc, 0x12, 0x45, 0x2f, 0x22, 0xa5,
+  0x1d, 0x80, 0x29, 0x21, 0xca, 0x46, 0xc5, 0x9a, 0x2a, 0x4b, 0x2d, 0x9d,
+  0xd9, 0x27, 0x96, 0xfc, 0xd7, 0x8b, 0x0a, 0xf0, 0x05, 0x98, 0x56, 0xa6,
+  0xa3, 0xe9, 0x45, 0xd1, 0x98, 0x15, 0x0e, 0xa1, 0xf9, 0x61, 0x78, 0xb7,
+  0x42, 0xec, 0x0c, 0xcf, 0xbd, 0xc0, 0xa5, 0xdf, 0x54, 0xef, 0xb0, 0xea,
+  0x6c, 0xfb, 0x5e, 0xae, 0x63, 0x0a, 0x15, 0x59, 0x62, 0x22, 0xaa, 0x98,
+  0x55, 0xe7, 0xff, 0x91, 0x0f, 0xb7, 0x4d, 0xbc, 0x1b, 0xa3, 0x95, 0x9d,
+  0x62, 0x93, 0x36, 0xdb, 0x7b, 0x1a, 0xac, 0x90, 0x8a, 0x7f, 0x00, 0x5a,
+  0xa6, 0x41, 0x6e, 0x2a, 0x50, 0x35, 0x68, 0xa9, 0x12, 0x3c, 0x07, 0x3a,
+  0xae, 0x69, 0x77, 0xbe, 0xfc, 0x00, 0x63, 0x92, 0x60, 0x49, 0x76, 0x17,
+  0xc3, 0xf6, 0x67, 0x0b, 0x27, 0x3a, 0x43, 0xed, 0xdc, 0x14, 0x58, 0xf9,
+  0xc4, 0x8d, 0x33, 0x42, 0x10, 0x25, 0x91, 0x31, 0xc6, 0x75, 0xcc, 0xd4,
+  0xd3, 0x8c, 0xb8, 0xf4, 0xda, 0x29, 0x13, 0x5b, 0xd6, 0x52, 0x92, 0x9f,
+  0x44, 0xee, 0x70, 0xac, 0x2a, 0xe8, 0x09, 0x6a, 0x1b, 0xcc, 0x8f, 0x5f,
+  0xd0, 0xa5, 0x43, 0x4f, 0xab, 0x8f, 0x29, 0x21, 0xac, 0x05, 0xe8, 0x1b,
+  0xcc, 0x04, 0x8e, 0x29, 0xbf, 0x04, 0x40, 0x41, 0xce, 0x74, 0xfc, 0xb8,
+  0x02, 0xf9, 0xf2, 0x1b, 0xb6, 0x78, 0xeb, 0x47, 0xb1, 0xe1, 0x5c, 0x43,
+  0xad, 0x11, 0xd6, 0xea, 0x4d, 0x2a, 0xbc, 0x24, 0x3e, 0x59, 0xfa, 0xcc,
+  0x1a, 0x91, 0x92, 0xc5, 0xd9, 0xef, 0x71, 0x5a, 0xb2, 0x52, 0x97, 0xda,
+  0x6f, 0x9b, 0x3a, 0xe0, 0x8f, 0x31, 0x5a, 0x63, 0xfe, 0xf3, 0x13, 0xe3,
+  0x53, 0xfe, 0xdb, 0xce, 0x57, 0x21, 0x4c, 0x90, 0xbc, 0x3b, 0x3d, 0x4b,
+  0x7f, 0x60, 0x42, 0xee, 0xc5, 0x22, 0x02, 0x96, 0x64, 0xcd, 0xf0, 0x9a,
+  0xdd, 0x77, 0xce, 0xcc, 0xe6, 0xf2, 0xa3, 0xa5, 0x58, 0x36, 0x98, 0xb7,
+  0xe6, 0xff, 0x3e, 0x14, 0x29, 0xb4, 0x63, 0x50, 0x48, 0x3f, 0x0c, 0x1f,
+  0x90, 0x1c, 0x4f, 0x8e, 0x10, 0xbb, 0x09, 0xbf, 0x14, 0x93, 0xcc, 0x3a,
+  0xe4, 0x5b, 0x39, 0x35, 0x11, 0xb9, 0x85, 0xa8, 0x18, 0x86, 0x8f, 0x47,
+  0x85, 0xb9, 0x59, 0x31, 0x61, 0xe9, 0xce, 0x1a, 0x94, 0x04, 0xa7, 0x89,
+  0xac, 0x6d, 0xf3, 0xf1, 0xf5, 0xf7, 0x32, 0x33, 0xab, 0x30, 0xc7, 0xc5,
+  0x1a, 0x08, 0x1d, 0xd8, 0x62, 0x64, 0xba, 0x2f, 0x7b, 0xc8, 0x7e, 0x0c,
+  0xc4, 0xf4, 0x63, 0xed, 0xd6, 0x38, 0xbb, 0x8b, 0x8c, 0x4f, 0xf5, 0xb8,
+  0xb7, 0x18, 0xe9, 0x36, 0xab, 0xc0, 0x22, 0x3d, 0x4e, 0xc9, 0xb1, 0x02,
+  0x87, 0xc5, 0xfd, 0x66, 0xb8, 0x1e, 0xb1, 0x86, 0xc4, 0xf2, 0x3d, 0xc4,
+  0x29, 0xaa, 0xa6, 0x5f, 0x84, 0xb5, 0x4c, 0x86, 0xb3, 0x0e, 0x37, 0x4e,
+  0xa2, 0x30, 0xb8, 0x15, 0xbf, 0x38, 0xf4, 0x33, 0x2e, 0x02, 0xe0, 0x84,
+  0xa4, 0x3f, 0xc4, 0x1f, 0x5a, 0x64, 0xef, 0xf0, 0x3a, 0x9e, 0x06, 0x90,
+  0xd8, 0xef, 0x4c, 0x0b, 0x74, 0xb4, 0x1f, 0x4d, 0x51, 0x6f, 0x90, 0xc6,
+  0x2b, 0xe3, 0x4b, 0x7e, 0xff, 0x54, 0x62, 0x83, 0xf2, 0xfa, 0xb2, 0x26,
+  0x1c, 0xa0, 0xdf, 0x9a, 0x56, 0x28, 0x88, 0x7a, 0xfc, 0xaa, 0xbf, 0x76,
+  0xe2, 0xc5, 0xcc, 0x49, 0x80, 0xb1, 0x71, 0x2f, 0x9b, 0x16, 0xfd, 0x31,
+  0x6b, 0x28, 0x7e, 0x7e, 0x5c, 0xff, 0xc9, 0x71, 0xab, 0x11, 0x63, 0x35,
+  0xe4, 0xa9, 0xfa, 0x15, 0x63, 0xbf, 0x81, 0x83, 0xfa, 0xd1, 0xbc, 0x5c,
+  0xb5, 0xd8, 0x15, 0x47, 0xcd, 0xd6, 0xf6, 0x4f, 0xe2, 0x0a, 0x1e, 0x66,
+  0xcd, 0x49, 0x5f, 0x99, 0x19, 0x25, 0xbe, 0x17, 0x8b, 0x23, 0x8d, 0x6b,
+  0x6f, 0x62, 0x92, 0x1f, 0xad, 0xea, 0xb5, 0x30, 0x31, 0x4c, 0xd3, 0xc5,
+  0x93, 0xef, 0x3e, 0x65, 0xa7, 0x65, 0x9a, 0xb0, 0xbd, 0xf8, 0xa5, 0x84,
+  0x1a, 0x16, 0x11, 0x5b, 0xee, 0x12, 0xa5, 0xf2, 0x24, 0xa1, 0xab, 0xb8,
+  0x72, 0x1b, 0x6a, 0xbd, 0x07, 0x5d, 0x72, 0x16, 0xae, 0xee, 0x59, 0x7a,
+  0x23, 0xe5, 0x4e, 0xae, 0x69, 0x88, 0x33, 0x0d, 0xbf, 0xd2, 0x7a, 0x08,
+  0xc3, 0x2e, 0x99, 0x38, 0x5f, 0x29, 0xcb, 0x86, 0x90, 0x39, 0x56, 0x5e,
+  0xd8, 0xb4, 0x7b, 0xdb, 0x6d, 0xf3, 0x65, 0xeb, 0x26, 0xdf, 0x92, 0x56,
+  0x3d, 0x90, 0x11, 0x78, 0x37, 0x6b, 0x60, 0x1d, 0xae, 0xee, 0x16, 0x02,
+  0x91, 0xce, 0x12, 0x4c, 0xa4, 0xfd, 0x7e, 0x3f, 0x07, 0xc5, 0x98, 0x0a,
+  0x63, 0x5e, 0xf8, 0x25, 0xd5, 0x7d, 0xb5, 0xd0, 0x77, 0xba, 0xe4, 0x7d,
+  0x44, 0xd2, 0x1f, 0xd3, 0x25, 0xc7, 0x0e, 0x59, 0x80, 0xd3, 0x7a, 0x62,
+  0xcd, 0xb8, 0x10, 0xee, 0x0e, 0xf1, 0x64, 0xbe, 0x95, 0x35, 0x18, 0x2b,
+  0xcf, 0x8f, 0x7b, 0xce, 0x98, 0x38, 0x01, 0xbb, 0x76, 0xd1, 0x80, 0x20,
+  0x6b, 0x43, 0x94, 0x1e, 0x26, 0x24, 0xb7, 0x36, 0x63, 0x2d, 0x63, 0x1d,
+  0x7e, 0x43, 0xf6, 0xe2, 0xd7, 0x33, 0x3c, 0x19, 0x7f, 0x5d, 0x86, 0x42,
+  0x47, 0xa5, 0x93, 0x74, 0xbb, 0xe4, 0x3a, 0xba, 0x07, 0x23, 0x17, 0x83,
+  0x74, 0x31, 0xbb, 0x92, 0x5f, 0x64, 0x07, 0xc3, 0x28, 0x4f, 0x09, 0xb8,
+  0x1e, 0x06, 0x38, 0x78, 0xa9, 0x1d, 0x06, 0xd6, 0xbb, 0x9b, 0x52, 0xa0,
+  0xa8, 0x99, 0xeb, 0x4e, 0xb0, 0xa5, 0x17, 0xcf, 0x6b, 0x57, 0xc4, 0x65,
+  0x03, 0xd5, 0x39, 0xca, 0x9b, 0x1d, 0xc8, 0xfc, 0x5e, 0x65, 0xbf, 0x16,
+  0x54, 0x83, 0x59, 0xfd, 0x93, 0x57, 0xb0, 0x5f, 0x0a, 0xca, 0xbf, 0x62,
+  0x9d, 0xd5, 0x1f, 0x84, 0xae, 0xb4, 0x88, 0x75, 0x26, 0x5f, 0xc1, 0x07,
+  0x89, 0xc7, 0xcf, 0xd3, 0xdd, 0x70, 0x75, 0x76, 0x7a, 0x85, 0x5b, 0x88,
+  0xff, 0xc6, 0xd9, 0x18, 0x54, 0x13, 0xf9, 0xbb, 0x87, 0x01, 0x1d, 0x07,
+  0x7f, 0x22, 0x96, 0x3f, 0xc4, 0x3d, 0xb0, 0xc1, 0x50, 0x8b, 0x19, 0x7c,
+  0xfa, 0x66, 0x1a, 0xec, 0xf5, 0x19, 0x8c, 0xf6, 0x0f, 0x6d, 0x38, 0x21,
+  0x77, 0x1e, 0x38, 0x18, 0xce, 0x0b, 0xcb, 0xab, 0xcc, 0x33, 0xbb, 0xfc,
+  0xcb, 0x13, 0xcf, 0x4d, 0x97, 0x15, 0xd9, 0x68, 0x5c, 0x58, 0x18, 0x67,
+  0x46, 0xf6, 0xb6, 0x1b, 0x8e, 0x56, 0x6a, 0x95, 0x3e, 0xbf, 0x6a, 0x79,
+  0xb8, 0x5a, 0x29, 0xaa, 0x94, 0x8c, 0x28, 0x4c, 0xad, 0xb0, 0x35, 0x67,
+  0xaa, 0xa1, 0xba, 0xe3, 0xb0, 0x4c, 0x09, 0x0c, 0x77, 0x25, 0x11, 0xcb,
+  0x99, 0xab, 0x81, 0x22, 0x28, 0xaa, 0x18, 0x50, 0x02, 0x77, 0x1e, 0x58,
+  0xf4, 0xf9, 0xb2, 0x3c, 0x5c, 0xa0, 0x57, 0x0f, 0xc6, 0x35, 0x8e, 0x13,
+  0x38, 0xfe, 0xfd, 0xff, 0x52, 0xc6, 0x88, 0x78, 0xca, 0x26, 0xe3, 0xbd,
+  0x07, 0xfa, 0x25, 0xa6, 0x68, 0xc3, 0xf3, 0x7a, 0x27, 0x58, 0x58, 0xbb,
+  0xa1, 0x99, 0x2a, 0x79, 0x73, 0x35, 0x9d, 0xb8, 0x5f, 0x87, 0x43, 0x90,
+  0x09, 0x4c, 0x25, 0x75, 0xf4, 0x9a, 0x0f, 0x25, 0xb9, 0x81, 0x26, 0xd2,
+  0xe0, 0x91, 0x65, 0x76, 0x67, 0xb3, 0xd1, 0x72, 0xdb, 0xd8, 0xba, 0x63,
+  0x17, 0xa1, 0xd2, 0x6f, 0x0c, 0xdf, 0xf2, 0xfb, 0x2f, 0x6b, 0x82, 0x43,
+  0x2c, 0xd2, 0x73, 0x8c, 0x57, 0xfe, 0x57, 0xc4, 0x87, 0x58, 0xe4, 0x5a,
+  0x8c, 0x54, 0x1d, 0x97, 0xb9, 0xe1, 0x17, 0x4d, 0x5a, 0xc6, 0x8a, 0x63,
+  0x0c, 0x31, 0x8d, 0x86, 0x18, 0x61, 0x1a, 0xc1, 0x10, 0x12, 0x40, 0xeb,
+  0x7f, 0x02, 0xab, 0xa6, 0x34, 0xda, 0xcc, 0x6a, 0x58, 0xd9, 0xab, 0x01,
+  0xc2, 0x5a, 0x7d, 0x3b, 0x3b, 0xde, 0xdd, 0xb2, 0x36, 0x31, 0x8f, 0x69,
+  0xe2, 0x78, 0x7e, 0x5c, 0xf1, 0x53, 0x53, 0x75, 0x96, 0x2f, 0xbf, 0x13,
+  0x36, 0xab, 0xac, 0x5d, 0x47, 0x31, 0xba, 0x16, 0xab, 0x90, 0x15, 0x04,
+  0x1d, 0x11, 0x3c, 0x46, 0xd4, 0xb9, 0xa3, 0x78, 0x8f, 0xd4, 0x21, 0xd9,
+  0x43, 0x92, 0xaf, 0x1c, 0x17, 0x33, 0xc5, 0xa9, 0x47, 0x69, 0x72, 0x81,
+  0xc9, 0x14, 0x36, 0x3b, 0x8d, 0x3a, 0x91, 0xe3, 0x7a, 0xeb, 0x98, 0xff,
+  0xa2, 0xa7, 0x35, 0xc6, 0xea, 0x72, 0xf2, 0xc1, 0xb9, 0x13, 0x3b, 0x42,
+  0x8c, 0x5c, 0x87, 0xe0, 0x2a, 0xa2, 0xc6, 0xd9, 0x71, 0xe1, 0x9b, 0xc7,
+  0x76, 0x32, 0x92, 0x4a, 0x01, 0x1d, 0xe8, 0x5b, 0xcf, 0xb2, 0x9c, 0x82,
+  0x7f, 0x98, 0xdd, 0x24, 0x71, 0x26, 0xfb, 0x28, 0x19, 0x45, 0xa2, 0x2e,
+  0xc5, 0xb6, 0x50, 0x5b, 0x6e, 0xf3, 0x96, 0xdd, 0x24, 0xe4, 0xe1, 0x5f,
+  0x7b, 0xb0, 0xd7, 0x6a, 0x75, 0x63, 0xdf, 0x9b, 0x51, 0xbb, 0x33, 0xac,
+  0xc8, 0x60, 0x28, 0x41, 0x2f, 0xe8, 0x2b, 0xef, 0x14, 0x31, 0x02, 0x7f,
+  0xd1, 0x5d, 0x62, 0xd5, 0xaf, 0xdd, 0xeb, 0x7e, 0x1f, 0xfe, 0xe8, 0xdd,
+  0xa6, 0x77, 0x97, 0x1e, 0x6e, 0xb5, 0x60, 0xcc, 0xdf, 0xf1, 0xc7, 0xc4,
+  0xce, 0x9c, 0xfc, 0x16, 0x50, 0xe3, 0x54, 0xca, 0x7e, 0x03, 0x85, 0xfa,
+  0xa6, 0x0b, 0xb0, 0x1a, 0xff, 0xc2, 0x4a, 0x7e, 0x61, 0x8d, 0xf2, 0x6b,
+  0x2d, 0x85, 0x6b, 0x51, 0xb2, 0x8a, 0x1f, 0xea, 0x8b, 0xea, 0xa4, 0xd6,
+  0x13, 0x5d, 0x8e, 0xa2, 0xde, 0x5b, 0xc8, 0x5b, 0xe1, 0x43, 0x3e, 0x51,
+  0x9c, 0xbc, 0xd5, 0x7a, 0xee, 0x1b, 0x52, 0x14, 0x1c, 0xb2, 0x76, 0xf5,
+  0x58, 0x6c, 0x58, 0xd1, 0x05, 0xc4, 0xde, 0xeb, 0x1b, 0x0a, 0x48, 0xa9,
+  0x4a, 0x7c, 0xfb, 0xa3, 0x31, 0x29, 0x6d, 0x7d, 0x08, 0x6f, 0xd7, 0xec,
+  0x94, 0xef, 0x36, 0x39, 0xa7, 0xce, 0x1a, 0x2c, 0x05, 0x5b, 0x14, 0x82,
+  0xb4, 0xac, 0xb6, 0xb9, 0xcb, 0xcb, 0x08, 0xcc, 0x1c, 0x20, 0x4c, 0x92,
+  0xf5, 0x38, 0x05, 0x7e, 0xaa, 0xe8, 0x90, 0x5a, 0xfe, 0xef, 0xf1, 0x84,
+  0x51, 0x0e, 0xbe, 0xd0, 0xf8, 0xe6, 0x59, 0x6f, 0x7c, 0x51, 0x79, 0x82,
+  0x05, 0xf2, 0x9e, 0x61, 0x2d, 0x06, 0x8f, 0x58, 0x8b, 0x57, 0x58, 0x43,
+  0x46, 0x44, 0xbd, 0x4d, 0x09, 0x29, 0xf1, 0x4c, 0xd6, 0x4c, 0x34, 0x8a,
+  0x9f, 0x8d, 0x84, 0xc6, 0xdb, 0x67, 0x14, 0x02, 0x42, 0x8b, 0x67, 0x21,
+  0xdf, 0xf0, 0x29, 0x79, 0xb9, 0x29, 0x07, 0x97, 0x53, 0x7b, 0x39, 0xf5,
+  0xf0, 0xa0, 0x9c, 0xb8, 0x1b, 0xe8, 0xa1, 0xe4, 0x2e, 0xbd, 0x20, 0x53,
+  0x21, 0x69, 0x7a, 0xfb, 0xa5, 0xb8, 0x14, 0x93, 0xd7, 0x96, 0x36, 0xbc,
+  0xd4, 0xc7, 0x7c, 0x3a, 0x43, 0x23, 0x9b, 0x23, 0x7f, 0x63, 0x45, 0x24,
+  0x0f, 0x11, 0xf3, 0xbc, 0x10, 0x5f, 0x3a, 0xa0, 0x9e, 0xfe, 0x84, 0xbb,
+  0x8c, 0x6c, 0x71, 0xa8, 0x2c, 0xf6, 0x9a, 0xd5, 0x60, 0x70, 0x88, 0x6d,
+  0x9e, 0x3a, 0xd4, 0x24, 0x3f, 0x9a, 0x95, 0xe2, 0x37, 0xe3, 0x4b, 0x4b,
+  0xa4, 0x2c, 0xde, 0x40, 0xa7, 0x11, 0x7f, 0x9a, 0x71, 0x14, 0x4f, 0x4c,
+  0x9a, 0x5a, 0x88, 0xec, 0x3c, 0x47, 0xc3, 0xd8, 0x22, 0xfb, 0x95, 0xfa,
+  0x13, 0x62, 0x8b, 0xf4, 0x2b, 0x3b, 0x1e, 0xda, 0xf0, 0x97, 0x59, 0x74,
+  0xca, 0xc9, 0x75, 0x38, 0x7c, 0x84, 0xd2, 0x8b, 0x1f, 0xc1, 0xdc, 0x12,
+  0x3f, 0x8d, 0x77, 0xdc, 0xe3, 0x3f, 0x75, 0x09, 0x2e, 0x09, 0xd8, 0x25,
+  0xe3, 0xff, 0x0b, 0xcb, 0xcc, 0x92, 0x8b, 0x7b, 0xb6, 0x00, 0x00
 };
-static const unsigned int page_index_len = 6923;
+static const unsigned int page_index_len = 9395;
 
 #endif
@@ -0,0 +1,226 @@
+/**
+ * @file telemetry_stream.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Implements WebSocket stream of live capture telemetry
+ */
+#include "telemetry_stream.h"
+
+#include <stdbool.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+
+#include "attack.h"
+#include "attack_telemetry.h"
+#include "wifi_controller.h"
+
+static const char *TAG = "telemetry_stream";
+
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_FLAG_PAIR_FOUND (1 << 0)
+#define TELEMETRY_FLAG_COMPLETED (1 << 1)
+
+/**
+ * @brief Header of telemetry message
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t version;
+    uint8_t state;
+    uint8_t type;
+    uint8_t flags;
+    uint16_t interval_ms;
+    uint16_t data_frames;
+    uint16_t mgmt_frames;
+    uint16_t ctrl_frames;
+    int8_t ap_rssi;
+    uint8_t sessions;
+    uint8_t sta_count;
+    uint8_t reserved;
+} telemetry_header_t;
+
+static httpd_handle_t server = NULL;
+static SemaphoreHandle_t clients_mutex = NULL;
+static int clients[CONFIG_WEBSERVER_TELEMETRY_MAX_CLIENTS];
+static unsigned client_count = 0;
+static esp_timer_handle_t telemetry_timer_handle;
+/**
+ * @brief Set while telemetry work waits in httpd queue, so slow httpd task doesn't accumulate messages
+ */
+static volatile bool work_pending = false;
+/**
+ * @brief State of telemetry messages. Owned by httpd task.
+ * @{
+ */
+static uint8_t message[sizeof(telemetry_header_t) + ATTACK_TELEMETRY_MAX_STAS * sizeof(attack_telemetry_sta_t)];
+static wifictl_sniffer_counters_t last_counters;
+static int64_t last_time = 0;
+static uint8_t last_state = READY;
+//@}
+
+static uint16_t clamp_u16(uint32_t value){
+    return (value > UINT16_MAX) ? UINT16_MAX : value;
+}
+
+/**
+ * @brief Removes client from the list and stops telemetry timer when the last client is gone.
+ * @return true if client was found
+ */
+static bool remove_client(int sockfd){
+    bool found = false;
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < client_count; i++){
+        if(clients[i] == sockfd){
+            clients[i] = clients[--client_count];
+            found = true;
+            break;
+        }
+    }
+    if(found && (client_count == 0)){
+        esp_timer_stop(telemetry_timer_handle);
+    }
+    xSemaphoreGive(clients_mutex);
+    return found;
+}
+
+/**
+ * @brief Serializes telemetry collected since previous message.
+ * @return size_t size of the message
+ */
+static size_t build_message(const attack_status_t *status){
+    wifictl_sniffer_counters_t counters;
+    wifictl_sniffer_get_counters(&counters);
+    int64_t now = esp_timer_get_time();
+    attack_telemetry_t telemetry;
+    attack_telemetry_get(&telemetry);
+
+    telemetry_header_t header = {
+        .version = TELEMETRY_VERSION,
+        .state = status->state,
+        .type = status->type,
+        .flags = (telemetry.pair_found ? TELEMETRY_FLAG_PAIR_FOUND : 0) | (telemetry.completed ? TELEMETRY_FLAG_COMPLETED : 0),
+        .interval_ms = clamp_u16((now - last_time) / 1000),
+        .data_frames = clamp_u16(counters.data - last_counters.data),
+        .mgmt_frames = clamp_u16(counters.mgmt - last_counters.mgmt),
+        .ctrl_frames = clamp_u16(counters.ctrl - last_counters.ctrl),
+        .ap_rssi = telemetry.ap_rssi,
+        .sessions = telemetry.sessions,
+        .sta_count = telemetry.sta_count,
+        .reserved = 0
+    };
+    memcpy(&last_counters, &counters, sizeof(wifictl_sniffer_counters_t));
+    last_time = now;
+
+    memcpy(message, &header, sizeof(telemetry_header_t));
+    size_t stas_size = telemetry.sta_count * sizeof(attack_telemetry_sta_t);
+    memcpy(&message[sizeof(telemetry_header_t)], telemetry.stas, stas_size);
+    return sizeof(telemetry_header_t) + stas_size;
+}
+
+/**
+ * @brief Sends one telemetry message to all clients. Work function queued by telemetry timer, runs in httpd task.
+ * @param arg not used
+ */
+static void send_telemetry_work(void *arg){
+    attack_status_t status;
+    attack_get_status(&status);
+    bool send = (status.state == RUNNING) || (last_state == RUNNING);
+    last_state = status.state;
+    if(!send){
+        // keep rates relative to previous interval
+        wifictl_sniffer_get_counters(&last_counters);
+        last_time = esp_timer_get_time();
+        work_pending = false;
+        return;
+    }
+
+    httpd_ws_frame_t frame = {
+        .final = true,
+        .fragmented = false,
+        .type = HTTPD_WS_TYPE_BINARY,
+        .payload = message,
+        .len = build_message(&status)
+    };
+    int sockets[CONFIG_WEBSERVER_TELEMETRY_MAX_CLIENTS];
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    unsigned count = client_count;
+    memcpy(sockets, clients, count * sizeof(int));
+    xSemaphoreGive(clients_mutex);
+    for(unsigned i = 0; i < count; i++){
+        if(httpd_ws_send_frame_async(server, sockets[i], &frame) != ESP_OK){
+            ESP_LOGD(TAG, "Client %d gone", sockets[i]);
+            remove_client(sockets[i]);
+            httpd_sess_trigger_close(server, sockets[i]);
+        }
+    }
+    work_pending = false;
+}
+
+/**
+ * @brief Callback for telemetry timer. Runs in esp_timer task, so it only queues send_telemetry_work().
+ *
+ * Nothing is queued while previous message wasn't sent yet.
+ * @param arg not used
+ */
+static void telemetry_timer_callback(void *arg){
+    if(work_pending){
+        return;
+    }
+    work_pending = true;
+    if(httpd_queue_work(server, send_telemetry_work, NULL) != ESP_OK){
+        work_pending = false;
+    }
+}
+
+esp_err_t telemetry_stream_init(httpd_handle_t server_handle){
+    server = server_handle;
+    clients_mutex = xSemaphoreCreateMutex();
+    if(clients_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create telemetry stream resources");
+        return ESP_ERR_NO_MEM;
+    }
+    const esp_timer_create_args_t telemetry_timer_args = {
+        .callback = &telemetry_timer_callback
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&telemetry_timer_args, &telemetry_timer_handle));
+    return ESP_OK;
+}
+
+esp_err_t telemetry_stream_add_client(httpd_req_t *req){
+    int sockfd = httpd_req_to_sockfd(req);
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(clients_mutex, portMAX_DELAY);
+    if(client_count >= CONFIG_WEBSERVER_TELEMETRY_MAX_CLIENTS){
+        err = ESP_ERR_NO_MEM;
+    }
+    else {
+        clients[client_count++] = sockfd;
+        if(client_count == 1){
+            // handler runs in httpd task too, so message state can be reset here
+            wifictl_sniffer_get_counters(&last_counters);
+            last_time = esp_timer_get_time();
+            esp_timer_start_periodic(telemetry_timer_handle, CONFIG_WEBSERVER_TELEMETRY_INTERVAL_MS * 1000);
+        }
+    }
+    xSemaphoreGive(clients_mutex);
+    if(err != ESP_OK){
+        ESP_LOGW(TAG, "Maximum number of telemetry clients reached");
+        return err;
+    }
+    ESP_LOGD(TAG, "Telemetry client %d added", sockfd);
+    return ESP_OK;
+}
+
+void telemetry_stream_remove_client(int sockfd){
+    if((clients_mutex != NULL) && remove_client(sockfd)){
+        ESP_LOGD(TAG, "Telemetry client %d removed", sockfd);
+    }
+}
@@ -0,0 +1,47 @@
+/**
+ * @file telemetry_stream.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ *
+ * @brief WebSocket stream of live capture telemetry for \c /telemetry endpoint
+ *
+ * Telemetry is batched into single binary message per CONFIG_WEBSERVER_TELEMETRY_INTERVAL_MS, no matter how many frames arrive,
+ * and at most one message is waiting for httpd task at any time, so telemetry can't overload webserver.
+ * Messages are sent while attack is running and once after it stops.
+ *
+ * Message layout (little endian):
+ * - header (16 bytes): version u8 (1), state u8, type u8, flags u8 (bit 0 crackable pair found, bit 1 completion policy satisfied),
+ *   interval_ms u16, data/mgmt/ctrl frames captured during interval u16 each, AP RSSI i8, M1+M2 sessions u8, STA count u8, reserved u8
+ * - STA count x attack_telemetry_sta_t (12 bytes): MAC, RSSI i8, reserved u8, number of M1 to M4 messages u8 each
+ */
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/**
+ * @brief Initialises telemetry stream for given server.
+ *
+ * @param server running webserver
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM
+ */
+esp_err_t telemetry_stream_init(httpd_handle_t server);
+
+/**
+ * @brief Adds client after WebSocket handshake.
+ *
+ * @param req \c /telemetry handshake request
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if maximum number of clients is reached
+ */
+esp_err_t telemetry_stream_add_client(httpd_req_t *req);
+
+/**
+ * @brief Forgets closed socket. Called from session close callback of the server.
+ *
+ * @param sockfd closed socket
+ */
+void telemetry_stream_remove_client(int sockfd);
+
+#endif
@@ -11,6 +11,10 @@
  */
 #include "webserver.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
@@ -20,9 +24,14 @@
 
 #include "wifi_controller.h"
 #include "attack.h"
-#include "pcap_serializer.h"
-#include "hccapx_serializer.h"
+#include "attack_jobs.h"
+#include "attack_timing.h"
+#include "capture_store.h"
 #include "file_manager.h"
+#include "event_stream.h"
+#include "telemetry_stream.h"
+#include "metrics.h"
+#include "live_pcap.h"
 
 #include "pages/page_index.h"
 
@@ -72,34 +81,135 @@ static httpd_uri_t uri_reset_head = {
 };
 //@}
 
+/**
+ * @brief Kinds of entries in \c /ap-list response
+ */
+typedef enum {
+    AP_ENTRY_FULL = 1,      ///< slot, kind, RSSI, BSSID (6), SSID length, SSID
+    AP_ENTRY_RSSI = 2,      ///< slot, kind, RSSI
+    AP_ENTRY_REMOVED = 3    ///< slot, kind
+} ap_entry_kind_t;
+
+/**
+ * @brief Flag of \c /ap-list response header, response contains all present APs and client drops everything else
+ */
+#define AP_LIST_FLAG_SNAPSHOT 0x01
+/**
+ * @brief Size of \c /ap-list response header: version (u32), flags (u8), entry count (u8), 2 reserved bytes
+ */
+#define AP_LIST_HEADER_SIZE 8
+/**
+ * @brief Size of the longest \c /ap-list entry
+ */
+#define AP_LIST_ENTRY_MAX_SIZE (10 + 32)
+
+/**
+ * @brief Serialises AP table changes since given version. Caller holds AP table.
+ * 
+ * @param ap_records AP table
+ * @param since version known by client, 0 or unknown version means whole table
+ * @param buffer output buffer of AP_LIST_HEADER_SIZE + CONFIG_SCAN_MAX_AP * AP_LIST_ENTRY_MAX_SIZE bytes
+ * @return size_t length of response
+ */
+static size_t serialize_ap_list(const wifictl_ap_records_t *ap_records, uint32_t since, uint8_t *buffer){
+    // version from before reboot is unknown to the table
+    bool snapshot = (since == 0) || (since > ap_records->version);
+    size_t length = AP_LIST_HEADER_SIZE;
+    uint8_t count = 0;
+    for(unsigned slot = 0; slot < ap_records->count; slot++){
+        const wifictl_ap_slot_t *state = &ap_records->slots[slot];
+        const wifi_ap_record_t *record = &ap_records->records[slot];
+        if(!snapshot && (state->seq <= since)){
+            continue;
+        }
+        if(!state->present){
+            if(!snapshot){
+                buffer[length++] = slot;
+                buffer[length++] = AP_ENTRY_REMOVED;
+                count++;
+            }
+            continue;
+        }
+        buffer[length++] = slot;
+        if(!snapshot && (state->added_seq <= since)){
+            buffer[length++] = AP_ENTRY_RSSI;
+            buffer[length++] = (uint8_t) record->rssi;
+        } else {
+            uint8_t ssid_len = strnlen((const char *) record->ssid, 32);
+            buffer[length++] = AP_ENTRY_FULL;
+            buffer[length++] = (uint8_t) record->rssi;
+            memcpy(&buffer[length], record->bssid, 6);
+            length += 6;
+            buffer[length++] = ssid_len;
+            memcpy(&buffer[length], record->ssid, ssid_len);
+            length += ssid_len;
+        }
+        count++;
+    }
+    memcpy(buffer, &ap_records->version, sizeof(uint32_t));
+    buffer[4] = snapshot ? AP_LIST_FLAG_SNAPSHOT : 0;
+    buffer[5] = count;
+    buffer[6] = 0;
+    buffer[7] = 0;
+    return length;
+}
+
 /**
  * @brief Handlers for \c /ap-list endpoint
  *
- * This endpoint returns list of available APs nearby.
- * It calls wifi_controller ap_scanner and serialize their SSIDs into octet response.
- * @attention reponse may take few seconds
- * @attention client may be disconnected from ESP AP after calling this endpoint
+ * This endpoint returns AP table of wifi_controller ap_scanner in compact binary form. With \c since query parameter
+ * only slots changed after given table version are sent: whole entry for added or changed AP, RSSI for AP whose only RSSI changed
+ * and removal notice for AP that disappeared. Without it, whole table is sent as snapshot.
+ * Background scan is requested when table is older than CONFIG_SCAN_CACHE_TTL or when \c refresh query parameter is present,
+ * but response never waits for it. \c X-Scan-Pending header tells client that newer list will be available.
+ * ETag is table version, so client polling with \c If-None-Match gets \c 304 until the table changes.
+ * No scan is started while attack is running, because scanning switches channels.
+ * @attention client may be disconnected from ESP AP while background scan runs
  * @param req
  * @return esp_err_t
  * @{
  */
 static esp_err_t uri_ap_list_get_handler(httpd_req_t *req) {
-    wifictl_scan_nearby_aps();
+    char query[32] = {0};
+    char value[12];
+    uint32_t since = 0;
+    if((httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) &&
+        (httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK)){
+        since = strtoul(value, NULL, 10);
+    }
+    bool refresh = (strstr(query, "refresh") != NULL);
+    bool scan_pending = false;
+    if(attack_is_running()){
+        ESP_LOGD(TAG, "Attack running, serving cached AP list");
+    } else {
+        scan_pending = wifictl_request_scan(refresh);
+    }
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "X-Scan-Pending", scan_pending ? "1" : "0"));
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "Cache-Control", "no-cache"));
 
-    const wifictl_ap_records_t *ap_records;
-    ap_records = wifictl_get_ap_records();
+    const wifictl_ap_records_t *ap_records = wifictl_acquire_ap_records();
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%u\"", ap_records->version);
+
+    char if_none_match[16];
+    size_t if_none_match_len = httpd_req_get_hdr_value_len(req, "If-None-Match");
+    if((if_none_match_len > 0) && (if_none_match_len < sizeof(if_none_match)) &&
+        (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK) &&
+        (strcmp(if_none_match, etag) == 0)){
+        wifictl_release_ap_records();
+        ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "ETag", etag));
+        ESP_ERROR_CHECK(httpd_resp_set_status(req, "304 Not Modified"));
+        return httpd_resp_send(req, NULL, 0);
+    }
 
-    // 33 SSID + 6 BSSID + 1 RSSI
-    char resp_chunk[40];
+    // whole response is serialized while table is locked so it matches ETag
+    static uint8_t resp[AP_LIST_HEADER_SIZE + CONFIG_SCAN_MAX_AP * AP_LIST_ENTRY_MAX_SIZE];
+    size_t length = serialize_ap_list(ap_records, since, resp);
+    wifictl_release_ap_records();
 
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "ETag", etag));
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    for(unsigned i = 0; i < ap_records->count; i++){
-        memcpy(resp_chunk, ap_records->records[i].ssid, 33);
-        memcpy(&resp_chunk[33], ap_records->records[i].bssid, 6);
-        memcpy(&resp_chunk[39], &ap_records->records[i].rssi, 1);
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, resp_chunk, 40));
-    }
-    return httpd_resp_send_chunk(req, resp_chunk, 0);
+    return httpd_resp_send(req, (const char *) resp, length);
 }
 
 static httpd_uri_t uri_ap_list_get = {
@@ -110,10 +220,25 @@ static httpd_uri_t uri_ap_list_get = {
 };
 //@}
 
+/**
+ * @brief Checks that AP slot of attack request still holds AP with requested BSSID
+ *
+ * Background scan can hand slot of disappeared AP to another one between client's last \c /ap-list and its request.
+ * Attack controller checks it again when the request is processed.
+ * @param attack_request request to check
+ * @return true if slot holds requested AP
+ */
+static bool attack_request_target_matches(const attack_request_t *attack_request){
+    wifi_ap_record_t ap_record;
+    return (wifictl_get_ap_record(attack_request->ap_record_id, &ap_record) == ESP_OK) &&
+        (memcmp(ap_record.bssid, attack_request->bssid, sizeof(attack_request->bssid)) == 0);
+}
+
 /**
  * @brief Handlers for \c /run-attack endpoint
  *
  * This endpoint receives attack configuration from client. It deserialize it from octet stream to attack_request_t structure.
+ * Request whose AP slot no longer holds requested BSSID is rejected with \c 409.
  * @param req
  * @return esp_err_t
  * @{
@@ -133,6 +258,11 @@ static esp_err_t uri_run_attack_post_handler(httpd_req_t *req) {
         }
         return ESP_FAIL;
     }
+    if (!attack_request_target_matches(&attack_request)) {
+        ESP_LOGW(TAG, "AP slot %u no longer holds requested BSSID", attack_request.ap_record_id);
+        httpd_resp_set_status(req, "409 Conflict");
+        return httpd_resp_sendstr(req, "Target AP changed, select it again");
+    }
     
     esp_err_t res = httpd_resp_send(req, NULL, 0);
     ESP_ERROR_CHECK(esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, &attack_request, sizeof(attack_request_t), portMAX_DELAY));
@@ -147,6 +277,174 @@ static httpd_uri_t uri_run_attack_post = {
 };
 //@}
 
+/**
+ * @brief Handlers for \c /jobs endpoint
+ *
+ * \c POST appends jobs to job queue. Body is array of attack_request_t, one per job. If AP slot of any job no longer holds
+ * its BSSID, no job is added and \c 409 is returned.
+ * \c GET returns all jobs. Each job is serialized as 33 bytes SSID + 6 bytes BSSID + type + method + timeout + state.
+ * \c DELETE stops running job and clears job queue.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_jobs_post_handler(httpd_req_t *req) {
+    if ((req->content_len == 0) || (req->content_len % sizeof(attack_request_t) != 0)
+        || (req->content_len > CONFIG_ATTACK_JOB_QUEUE_SIZE * sizeof(attack_request_t))) {
+        ESP_LOGE(TAG, "Invalid jobs request size: %d", req->content_len);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid request size");
+        return ESP_FAIL;
+    }
+
+    attack_request_t attack_requests[CONFIG_ATTACK_JOB_QUEUE_SIZE];
+    unsigned count = req->content_len / sizeof(attack_request_t);
+    for (unsigned i = 0; i < count; i++) {
+        int ret = httpd_req_recv(req, (char *)&attack_requests[i], sizeof(attack_request_t));
+        if (ret != sizeof(attack_request_t)) {
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+                httpd_resp_send_408(req);
+            }
+            return ESP_FAIL;
+        }
+        if (!attack_request_target_matches(&attack_requests[i])) {
+            ESP_LOGW(TAG, "AP slot %u no longer holds requested BSSID", attack_requests[i].ap_record_id);
+            httpd_resp_set_status(req, "409 Conflict");
+            return httpd_resp_sendstr(req, "Target AP changed, select it again");
+        }
+    }
+    for (unsigned i = 0; i < count; i++) {
+        ESP_ERROR_CHECK(esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_JOB_ADD, &attack_requests[i], sizeof(attack_request_t), portMAX_DELAY));
+    }
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t uri_jobs_get_handler(httpd_req_t *req) {
+    attack_job_t *jobs = (attack_job_t *) malloc(CONFIG_ATTACK_JOB_QUEUE_SIZE * sizeof(attack_job_t));
+    if (jobs == NULL) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    unsigned count = attack_jobs_get(jobs, CONFIG_ATTACK_JOB_QUEUE_SIZE);
+
+    // 33 SSID + 6 BSSID + type + method + timeout + state
+    char resp_chunk[43];
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    for (unsigned i = 0; i < count; i++) {
+        memcpy(resp_chunk, jobs[i].ap_record.ssid, 33);
+        memcpy(&resp_chunk[33], jobs[i].ap_record.bssid, 6);
+        resp_chunk[39] = jobs[i].type;
+        resp_chunk[40] = jobs[i].method;
+        resp_chunk[41] = jobs[i].timeout;
+        resp_chunk[42] = jobs[i].state;
+        if (httpd_resp_send_chunk(req, resp_chunk, sizeof(resp_chunk)) != ESP_OK) {
+            free(jobs);
+            return ESP_FAIL;
+        }
+    }
+    free(jobs);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static esp_err_t uri_jobs_delete_handler(httpd_req_t *req) {
+    ESP_ERROR_CHECK(esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_JOBS_CLEAR, NULL, 0, portMAX_DELAY));
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static httpd_uri_t uri_jobs_post = {
+    .uri = "/jobs",
+    .method = HTTP_POST,
+    .handler = uri_jobs_post_handler,
+    .user_ctx = NULL
+};
+
+static httpd_uri_t uri_jobs_get = {
+    .uri = "/jobs",
+    .method = HTTP_GET,
+    .handler = uri_jobs_get_handler,
+    .user_ctx = NULL
+};
+
+static httpd_uri_t uri_jobs_delete = {
+    .uri = "/jobs",
+    .method = HTTP_DELETE,
+    .handler = uri_jobs_delete_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Size of buffer used to coalesce rendered data into HTTP chunks
+ */
+#define RESPONSE_CHUNK_SIZE 1024
+
+/**
+ * @brief Buffers rendered data and sends them to client in chunks of RESPONSE_CHUNK_SIZE.
+ * 
+ * Result of any size is streamed this way without allocating single heap block for it.
+ */
+typedef struct {
+    httpd_req_t *req;
+    size_t len;
+    uint8_t buffer[RESPONSE_CHUNK_SIZE];
+} chunk_writer_t;
+
+static esp_err_t chunk_writer_flush(chunk_writer_t *writer){
+    if(writer->len == 0){
+        return ESP_OK;
+    }
+    esp_err_t err = httpd_resp_send_chunk(writer->req, (const char *) writer->buffer, writer->len);
+    writer->len = 0;
+    return err;
+}
+
+/**
+ * @brief Write callback for capture_store that appends rendered data to chunk_writer_t
+ * 
+ * @param data rendered data
+ * @param size size of data
+ * @param arg expects chunk_writer_t
+ * @return esp_err_t 
+ */
+static esp_err_t chunk_writer_write(const uint8_t *data, size_t size, void *arg){
+    chunk_writer_t *writer = (chunk_writer_t *) arg;
+    while(size > 0){
+        size_t part = RESPONSE_CHUNK_SIZE - writer->len;
+        if(part > size){
+            part = size;
+        }
+        memcpy(&writer->buffer[writer->len], data, part);
+        writer->len += part;
+        data += part;
+        size -= part;
+        if(writer->len == RESPONSE_CHUNK_SIZE){
+            esp_err_t err = chunk_writer_flush(writer);
+            if(err != ESP_OK){
+                return err;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Renders view from capture_store and streams it to client in chunks.
+ * 
+ * @param req 
+ * @param view 
+ * @return esp_err_t 
+ */
+static esp_err_t send_capture_view(httpd_req_t *req, capture_view_t view){
+    chunk_writer_t writer = { .req = req, .len = 0 };
+    esp_err_t err = capture_store_render(view, chunk_writer_write, &writer);
+    if(err == ESP_OK){
+        err = chunk_writer_flush(&writer);
+    }
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to send %s: %s", req->uri, esp_err_to_name(err));
+    }
+    return err;
+}
+
 /**
  * @brief Handlers for \c /status endpoint
  *
@@ -157,15 +455,18 @@ static httpd_uri_t uri_run_attack_post = {
  */
 static esp_err_t uri_status_get_handler(httpd_req_t *req) {
     ESP_LOGD(TAG, "Fetching attack status...");
-    const attack_status_t *attack_status;
-    attack_status = attack_get_status();
+    attack_status_t attack_status;
+    attack_get_status(&attack_status);
 
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
     // first send attack result header
-    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) attack_status, 4));
-    // send attack result content
-    if(((attack_status->state == FINISHED) || (attack_status->state == TIMEOUT)) && (attack_status->content_size > 0)){
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, attack_status->content, attack_status->content_size));
+    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) &attack_status, ATTACK_STATUS_HEADER_SIZE));
+    // stream attack result content
+    if(((attack_status.state == FINISHED) || (attack_status.state == TIMEOUT)) && (attack_status.content_size > 0)){
+        esp_err_t err = send_capture_view(req, CAPTURE_VIEW_STATUS);
+        if(err != ESP_OK){
+            return err;
+        }
     }
     return httpd_resp_send_chunk(req, NULL, 0);
 }
@@ -179,90 +480,378 @@ static httpd_uri_t uri_status_get = {
 //@}
 
 /**
- * @brief Handlers for \c /capture.pcap endpoint
+ * @brief Handlers for \c /events endpoint
  *
- * This endpoint forwards PCAP binary data from pcap_serializer via octet stream to client.
+ * This endpoint keeps connection open and pushes attack status as Server-Sent Events, see event_stream.h.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_events_get_handler(httpd_req_t *req) {
+    ESP_LOGD(TAG, "Opening event stream...");
+    esp_err_t err = event_stream_add_client(req);
+    if(err == ESP_ERR_NO_MEM){
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Too many event stream clients");
+    }
+    return err;
+}
+
+static httpd_uri_t uri_events_get = {
+    .uri = "/events",
+    .method = HTTP_GET,
+    .handler = uri_events_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /telemetry WebSocket endpoint
  *
- * @note Most browsers will start download process when this endpoint is called.
+ * After handshake the client receives binary telemetry messages, see telemetry_stream.h.
+ * Messages from client are not expected, they are read and dropped.
  * @param req
  * @return esp_err_t
  * @{
  */
-static esp_err_t uri_capture_pcap_get_handler(httpd_req_t *req){
-    ESP_LOGD(TAG, "Providing PCAP file...");
+static esp_err_t uri_telemetry_handler(httpd_req_t *req) {
+    if(req->method == HTTP_GET){
+        ESP_LOGD(TAG, "Telemetry client connected");
+        return telemetry_stream_add_client(req);
+    }
+    uint8_t buffer[16];
+    httpd_ws_frame_t frame = { .payload = NULL };
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if((err != ESP_OK) || (frame.len > sizeof(buffer))){
+        return ESP_FAIL;
+    }
+    frame.payload = buffer;
+    return httpd_ws_recv_frame(req, &frame, frame.len);
+}
+
+static httpd_uri_t uri_telemetry = {
+    .uri = "/telemetry",
+    .method = HTTP_GET,
+    .handler = uri_telemetry_handler,
+    .user_ctx = NULL,
+    .is_websocket = true
+};
+//@}
+
+/**
+ * @brief Handlers for \c /timing endpoint
+ * 
+ * This endpoint returns attack phase timing as octet stream:
+ * - header: phase count (u8), bucket count (u8), reserved (u16)
+ * - phase durations of current or last run in microseconds (u32 per phase, 0 if phase wasn't reached)
+ * - rolling histogram of every phase (attack_timing_histogram_t)
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_timing_get_handler(httpd_req_t *req) {
+    uint8_t header[4] = { ATTACK_PHASE_COUNT, ATTACK_TIMING_BUCKET_COUNT, 0, 0 };
+    uint32_t phase_us[ATTACK_PHASE_COUNT];
+    attack_timing_histogram_t histograms[ATTACK_PHASE_COUNT];
+    attack_timing_get_run(phase_us);
+    attack_timing_get_histograms(histograms);
+
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) pcap_serializer_get_buffer(), pcap_serializer_get_size());
+    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) header, sizeof(header)));
+    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) phase_us, sizeof(phase_us)));
+    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) histograms, sizeof(histograms)));
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
-static httpd_uri_t uri_capture_pcap_get = {
-    .uri = "/capture.pcap",
+static httpd_uri_t uri_timing_get = {
+    .uri = "/timing",
     .method = HTTP_GET,
-    .handler = uri_capture_pcap_get_handler,
+    .handler = uri_timing_get_handler,
     .user_ctx = NULL
 };
 //@}
 
 /**
- * @brief Handlers for \c /capture.hccapx endpoint
+ * @brief Handlers for \c /metrics endpoint
+ * 
+ * This endpoint returns device health and capture pipeline counters in Prometheus text exposition format, see metrics.h.
+ * It doesn't wait for restore of previous session, so device can be scraped right after boot.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_metrics_get_handler(httpd_req_t *req) {
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "text/plain; version=0.0.4"));
+    esp_err_t err = metrics_send(req);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to send metrics: %s", esp_err_to_name(err));
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_metrics_get = {
+    .uri = "/metrics",
+    .method = HTTP_GET,
+    .handler = uri_metrics_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Answers \c 503 with \c Retry-After while results of previous session are being restored
  *
- * This endpoint forwards HCCAPX binary data from hccapx_serializer via octet stream to client.
+ * Restore runs at low priority and may format results partition, so handlers never wait for it in httpd task.
+ * @param req request
+ * @return true if request was answered and handler should return
+ */
+static bool reply_if_restoring(httpd_req_t *req){
+    if(attack_is_restored()){
+        return false;
+    }
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "1");
+    httpd_resp_sendstr(req, "Restoring previous session");
+    return true;
+}
+
+/**
+ * @brief Handlers for \c /capture.* endpoints
  *
- * @note Most browsers will start download process when this endpoint is called.
+ * These endpoints render requested view of captured data from capture_store and stream it to client as octet stream.
+ * View is passed in user_ctx of each endpoint.
+ *
+ * @note Most browsers will start download process when these endpoints are called.
  * @param req
  * @return esp_err_t
  * @{
  */
-static esp_err_t uri_capture_hccapx_get_handler(httpd_req_t *req){
-    ESP_LOGD(TAG, "Providing HCCAPX file...");
-    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) hccapx_serializer_get(), sizeof(hccapx_t));
+static esp_err_t uri_capture_get_handler(httpd_req_t *req){
+    capture_view_t view = (capture_view_t) req->user_ctx;
+    ESP_LOGD(TAG, "Providing %s file...", req->uri);
+    if(reply_if_restoring(req)){
+        return ESP_OK;
+    }
+    if(capture_store_get_view_size(view) == 0){
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Nothing captured for this format");
+        return ESP_FAIL;
+    }
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, (view == CAPTURE_VIEW_22000) ? "text/plain" : HTTPD_TYPE_OCTET));
+    esp_err_t err = send_capture_view(req, view);
+    if(err != ESP_OK){
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
+static httpd_uri_t uri_capture_pcap_get = {
+    .uri = "/capture.pcap",
+    .method = HTTP_GET,
+    .handler = uri_capture_get_handler,
+    .user_ctx = (void *) CAPTURE_VIEW_PCAP
+};
+
+static httpd_uri_t uri_capture_pcapng_get = {
+    .uri = "/capture.pcapng",
+    .method = HTTP_GET,
+    .handler = uri_capture_get_handler,
+    .user_ctx = (void *) CAPTURE_VIEW_PCAPNG
+};
+
 static httpd_uri_t uri_capture_hccapx_get = {
     .uri = "/capture.hccapx",
     .method = HTTP_GET,
-    .handler = uri_capture_hccapx_get_handler,
+    .handler = uri_capture_get_handler,
+    .user_ctx = (void *) CAPTURE_VIEW_HCCAPX
+};
+
+static httpd_uri_t uri_capture_22000_get = {
+    .uri = "/capture.22000",
+    .method = HTTP_GET,
+    .handler = uri_capture_get_handler,
+    .user_ctx = (void *) CAPTURE_VIEW_22000
+};
+//@}
+
+/**
+ * @brief Handlers for \c /capture/live.pcap endpoint
+ *
+ * This endpoint keeps connection open and streams PCAP of frames as they are captured, see live_pcap.h.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_capture_live_get_handler(httpd_req_t *req) {
+    ESP_LOGD(TAG, "Opening live PCAP stream...");
+    esp_err_t err = live_pcap_add_client(req);
+    if(err == ESP_ERR_NO_MEM){
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Too many live PCAP clients");
+    }
+    return err;
+}
+
+static httpd_uri_t uri_capture_live_get = {
+    .uri = "/capture/live.pcap",
+    .method = HTTP_GET,
+    .handler = uri_capture_live_get_handler,
     .user_ctx = NULL
 };
 //@}
 
+/**
+ * @brief Size of buffer used to stream result files from SPIFFS
+ */
+#define FILE_CHUNK_SIZE 4096
+
+/**
+ * @brief Buffer for streaming result files. Handlers run only in httpd task, so single static buffer is enough.
+ */
+static uint8_t file_chunk[FILE_CHUNK_SIZE];
+
+/**
+ * @brief Decodes URL encoded query value in place
+ * @return length of decoded value
+ */
+static size_t url_decode(char *value){
+    char *out = value;
+    for(const char *in = value; *in != '\0'; in++){
+        unsigned byte;
+        if((in[0] == '%') && (in[1] != '\0') && (in[2] != '\0') && (sscanf(&in[1], "%2x", &byte) == 1)){
+            *out++ = (char) byte;
+            in += 2;
+        } else {
+            *out++ = (*in == '+') ? ' ' : *in;
+        }
+    }
+    *out = '\0';
+    return out - value;
+}
+
+/**
+ * @brief Parses filter and page of result files from query of \c /results and \c /results.tar requests
+ *
+ * Query parameters are \c ext (extension, compressed variant included), \c since (unix time), \c ssid,
+ * \c bssid (\c aa:bb:cc:dd:ee:ff), \c offset and \c limit (0 or missing for all files).
+ * @param req request
+ * @param filter output parameter for filter
+ * @param offset output parameter for number of matching files to skip
+ * @param limit output parameter for maximal number of files
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if query is too long or malformed
+ */
+static esp_err_t parse_results_query(httpd_req_t *req, file_manager_filter_t *filter, unsigned *offset, unsigned *limit){
+    memset(filter, 0, sizeof(file_manager_filter_t));
+    *offset = 0;
+    *limit = 0;
+    char query[256];
+    char value[100];
+    esp_err_t err = httpd_req_get_url_query_str(req, query, sizeof(query));
+    if(err == ESP_ERR_NOT_FOUND){
+        return ESP_OK;
+    }
+    if(err != ESP_OK){
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_query_key_value(query, "ext", filter->ext, sizeof(filter->ext));
+    if(httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK){
+        filter->since = strtoul(value, NULL, 10);
+    }
+    if(httpd_query_key_value(query, "offset", value, sizeof(value)) == ESP_OK){
+        *offset = strtoul(value, NULL, 10);
+    }
+    if(httpd_query_key_value(query, "limit", value, sizeof(value)) == ESP_OK){
+        *limit = strtoul(value, NULL, 10);
+    }
+    if(httpd_query_key_value(query, "ssid", value, sizeof(value)) == ESP_OK){
+        size_t ssid_len = url_decode(value);
+        if((ssid_len == 0) || (ssid_len > sizeof(filter->ssid))){
+            return ESP_ERR_INVALID_ARG;
+        }
+        memcpy(filter->ssid, value, ssid_len);
+        filter->ssid_len = ssid_len;
+    }
+    if(httpd_query_key_value(query, "bssid", value, sizeof(value)) == ESP_OK){
+        unsigned bytes[6];
+        url_decode(value);
+        if(sscanf(value, "%2x:%2x:%2x:%2x:%2x:%2x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4], &bytes[5]) != 6){
+            return ESP_ERR_INVALID_ARG;
+        }
+        for(unsigned i = 0; i < 6; i++){
+            filter->bssid[i] = bytes[i];
+        }
+        filter->match_bssid = true;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Page of \c /results listing being collected in file_chunk
+ */
+typedef struct {
+    httpd_req_t *req;
+    size_t used;        ///< bytes of file_chunk waiting to be sent
+} results_page_t;
+
+/**
+ * @brief List callback that appends index entry to file_chunk, full buffer is sent as HTTP chunk
+ * @param arg expects results_page_t
+ */
+static esp_err_t results_entry_add(const file_info_t *info, void *arg){
+    results_page_t *page = (results_page_t *) arg;
+    if(page->used + sizeof(file_info_t) > FILE_CHUNK_SIZE){
+        esp_err_t err = httpd_resp_send_chunk(page->req, (const char *) file_chunk, page->used);
+        if(err != ESP_OK){
+            return err;
+        }
+        page->used = 0;
+    }
+    memcpy(&file_chunk[page->used], info, sizeof(file_info_t));
+    page->used += sizeof(file_info_t);
+    return ESP_OK;
+}
+
 /**
  * @brief Handlers for \c /results endpoint
  *
- * This endpoint returns a list of saved result files from SPIFFS
- * Response format: array of file info structures containing filename, size, and timestamp
+ * This endpoint returns page of saved result files from results index, newest first, filtered by query (see parse_results_query()).
+ * Response format: 8 bytes header (number of matching files u32, offset u32) followed by file_info_t entries (96 bytes each).
+ * Entries are streamed through file_chunk, so neither memory nor filesystem access depends on number of saved files.
  * @param req
  * @return esp_err_t
  * @{
  */
 static esp_err_t uri_results_get_handler(httpd_req_t *req) {
     ESP_LOGD(TAG, "Listing saved result files...");
+    // results partition is mounted by restore
+    if(reply_if_restoring(req)){
+        return ESP_OK;
+    }
 
-    file_info_t files[32];
-    int file_count = file_manager_list_files(files, 32);
+    file_manager_filter_t filter;
+    unsigned offset;
+    unsigned limit;
+    if(parse_results_query(req, &filter, &offset, &limit) != ESP_OK){
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid query");
+        return ESP_FAIL;
+    }
 
-    if (file_count < 0) {
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    results_page_t page = { .req = req, .used = 2 * sizeof(uint32_t) };
+    uint32_t header[2] = { file_manager_count_files(&filter), offset };
+    memcpy(file_chunk, header, sizeof(header));
+    esp_err_t err = file_manager_for_each_file(&filter, offset, limit, results_entry_add, &page);
+    if (err == ESP_ERR_INVALID_STATE) {
         ESP_LOGE(TAG, "Failed to list files");
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to list files");
         return ESP_FAIL;
     }
-
-    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-
-    // Send file count first (4 bytes)
-    uint32_t count = (uint32_t)file_count;
-    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *)&count, sizeof(uint32_t)));
-
-    // Send file info for each file
-    for (int i = 0; i < file_count; i++) {
-        // Filename (128 bytes)
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, files[i].filename, 128));
-        // File size (4 bytes)
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *)&files[i].size, sizeof(uint32_t)));
-        // Timestamp (4 bytes)
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *)&files[i].timestamp, sizeof(uint32_t)));
+    if (err != ESP_OK) {
+        return ESP_FAIL;
+    }
+    err = httpd_resp_send_chunk(req, (const char *) file_chunk, page.used);
+    if (err != ESP_OK) {
+        return err;
     }
-
     return httpd_resp_send_chunk(req, NULL, 0);
 }
 
@@ -274,15 +863,132 @@ static httpd_uri_t uri_results_get = {
 };
 //@}
 
+/**
+ * @brief Number of consecutive send timeouts (each is send_wait_timeout of the server) after which client is considered gone
+ */
+#define RAW_SEND_MAX_TIMEOUTS 2
+
+/**
+ * @brief Sends whole buffer directly to client socket, httpd_send() may send only part of it
+ * 
+ * Client that doesn't take any data for RAW_SEND_MAX_TIMEOUTS timeouts (e.g. disconnected from management AP) fails the send,
+ * so httpd task isn't blocked until TCP stack aborts the connection.
+ * @param req request
+ * @param data data to send
+ * @param size size of data
+ * @return esp_err_t ESP_OK on success, ESP_FAIL if socket failed or timed out
+ */
+static esp_err_t raw_send(httpd_req_t *req, const char *data, size_t size){
+    unsigned timeouts = 0;
+    while(size > 0){
+        int sent = httpd_send(req, data, size);
+        if((sent == HTTPD_SOCK_ERR_TIMEOUT) && (++timeouts < RAW_SEND_MAX_TIMEOUTS)){
+            continue;
+        }
+        if(sent <= 0){
+            return ESP_FAIL;
+        }
+        data += sent;
+        size -= sent;
+        timeouts = 0;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Read callback for file_manager that sends read part of file directly to client socket
+ * 
+ * @param data part of file
+ * @param size size of data
+ * @param arg expects httpd_req_t
+ * @return esp_err_t 
+ */
+static esp_err_t file_chunk_send(const uint8_t *data, size_t size, void *arg){
+    return raw_send((httpd_req_t *) arg, (const char *) data, size);
+}
+
+/**
+ * @brief Result of Range header parsing
+ */
+typedef enum {
+    RANGE_NONE,         ///< no usable Range header, whole file is sent
+    RANGE_SATISFIABLE,  ///< single range inside the file
+    RANGE_UNSATISFIABLE ///< range starts beyond end of file
+} range_result_t;
+
+/**
+ * @brief Parses single byte range from Range header
+ *
+ * Supports \c bytes=first-last, \c bytes=first- and \c bytes=-suffix. Multiple ranges and malformed values are ignored
+ * and whole file is sent, as allowed by RFC 9110.
+ * @param value Range header value
+ * @param file_size size of requested file
+ * @param first output parameter for offset of the first byte
+ * @param last output parameter for offset of the last byte (inclusive)
+ * @return range_result_t 
+ */
+static range_result_t parse_range(const char *value, uint32_t file_size, uint32_t *first, uint32_t *last){
+    if((strncmp(value, "bytes=", 6) != 0) || (strchr(value, ',') != NULL)){
+        return RANGE_NONE;
+    }
+    const char *spec = value + 6;
+    char *end;
+    if(*spec == '-'){
+        unsigned long suffix = strtoul(spec + 1, &end, 10);
+        if((end == spec + 1) || (*end != '\0')){
+            return RANGE_NONE;
+        }
+        if((suffix == 0) || (file_size == 0)){
+            return RANGE_UNSATISFIABLE;
+        }
+        *first = (suffix < file_size) ? file_size - suffix : 0;
+        *last = file_size - 1;
+        return RANGE_SATISFIABLE;
+    }
+    unsigned long start = strtoul(spec, &end, 10);
+    if((end == spec) || (*end != '-')){
+        return RANGE_NONE;
+    }
+    spec = end + 1;
+    unsigned long stop = file_size - 1;
+    if(*spec != '\0'){
+        stop = strtoul(spec, &end, 10);
+        if((end == spec) || (*end != '\0') || (stop < start)){
+            return RANGE_NONE;
+        }
+    }
+    if(start >= file_size){
+        return RANGE_UNSATISFIABLE;
+    }
+    *first = start;
+    *last = (stop < file_size) ? stop : file_size - 1;
+    return RANGE_SATISFIABLE;
+}
+
+/**
+ * @brief Reads request header into buffer
+ * @return true if header is present and fits into buffer
+ */
+static bool get_header(httpd_req_t *req, const char *field, char *value, size_t size){
+    size_t length = httpd_req_get_hdr_value_len(req, field);
+    return (length > 0) && (length < size) && (httpd_req_get_hdr_value_str(req, field, value, size) == ESP_OK);
+}
+
 /**
  * @brief Handlers for \c /results/{filename} endpoint
  *
- * This endpoint serves a specific saved result file from SPIFFS
+ * This endpoint serves a specific saved result file from SPIFFS.
+ * Single byte range is supported, so interrupted downloads can be resumed. ETag is derived from write sequence and size of the file
+ * and \c If-Range is honoured, so resumed download never mixes two different versions of the file.
+ * Response is written directly to the socket, because esp_http_server sends only chunked responses with unknown length.
  * @param req
  * @return esp_err_t
  * @{
  */
 static esp_err_t uri_results_download_get_handler(httpd_req_t *req) {
+    if(reply_if_restoring(req)){
+        return ESP_OK;
+    }
     // Extract filename from URI path
     char filename[128] = {0};
     size_t uri_len = strlen(req->uri);
@@ -290,6 +996,7 @@ static esp_err_t uri_results_download_get_handler(httpd_req_t *req) {
     // URI format: /results/filename.ext
     if (uri_len > 9) { // "/results/" = 9 characters
         strncpy(filename, req->uri + 9, sizeof(filename) - 1);
+        filename[strcspn(filename, "?")] = '\0';
     }
 
     if (filename[0] == '\0') {
@@ -298,21 +1005,77 @@ static esp_err_t uri_results_download_get_handler(httpd_req_t *req) {
         return ESP_FAIL;
     }
 
-    ESP_LOGD(TAG, "Serving result file: %s", filename);
-
-    uint32_t file_size = 0;
-    uint8_t *file_buffer = file_manager_get_file(filename, &file_size);
-
-    if (file_buffer == NULL) {
-        ESP_LOGE(TAG, "Failed to load file: %s", filename);
+    file_info_t info;
+    if (file_manager_get_file_info(filename, &info) != ESP_OK) {
+        ESP_LOGE(TAG, "File not found: %s", filename);
         httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "File not found");
         return ESP_FAIL;
     }
 
-    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    ESP_ERROR_CHECK(httpd_resp_send(req, (char *)file_buffer, file_size));
+    char etag[24];
+    // timestamps restart after reboot, write sequence is unique for every written file
+    snprintf(etag, sizeof(etag), "\"%08x-%08x\"", info.sequence, info.size);
+
+    uint32_t first = 0;
+    uint32_t last = (info.size > 0) ? info.size - 1 : 0;
+    range_result_t range = RANGE_NONE;
+    char header[64];
+    if (get_header(req, "Range", header, sizeof(header))) {
+        range = parse_range(header, info.size, &first, &last);
+        // range of changed file would be spliced with the old part the client already has
+        if ((range != RANGE_NONE) && get_header(req, "If-Range", header, sizeof(header)) && (strcmp(header, etag) != 0)) {
+            ESP_LOGD(TAG, "If-Range doesn't match %s, sending whole file", etag);
+            range = RANGE_NONE;
+            first = 0;
+            last = (info.size > 0) ? info.size - 1 : 0;
+        }
+    }
 
-    free(file_buffer);
+    char headers[384];
+    int length;
+    if (range == RANGE_UNSATISFIABLE) {
+        ESP_LOGD(TAG, "Unsatisfiable range for %s (%u bytes)", filename, info.size);
+        length = snprintf(headers, sizeof(headers), "HTTP/1.1 416 Range Not Satisfiable\r\n"
+            "Content-Range: bytes */%u\r\n"
+            "Content-Length: 0\r\n"
+            "\r\n", info.size);
+        return raw_send(req, headers, length);
+    }
+
+    uint32_t content_length = (info.size > 0) ? last - first + 1 : 0;
+    if (range == RANGE_SATISFIABLE) {
+        ESP_LOGD(TAG, "Serving result file: %s (bytes %u-%u of %u)", filename, first, last, info.size);
+        length = snprintf(headers, sizeof(headers), "HTTP/1.1 206 Partial Content\r\n"
+            "Content-Range: bytes %u-%u/%u\r\n", first, last, info.size);
+    } else {
+        ESP_LOGD(TAG, "Serving result file: %s (%u bytes)", filename, info.size);
+        length = snprintf(headers, sizeof(headers), "HTTP/1.1 200 OK\r\n");
+    }
+    length += snprintf(&headers[length], sizeof(headers) - length, "Content-Type: %s\r\n"
+        "Content-Length: %u\r\n"
+        "Accept-Ranges: bytes\r\n"
+        "ETag: %s\r\n", HTTPD_TYPE_OCTET, content_length, etag);
+    // Compressed files are decoded by client, so the saved file has the original name without suffix
+    if (file_manager_is_compressed(filename)) {
+        length += snprintf(&headers[length], sizeof(headers) - length, "Content-Encoding: gzip\r\n"
+            "Content-Disposition: attachment; filename=\"%.*s\"\r\n",
+            (int)(strlen(filename) - strlen(FILE_MANAGER_GZIP_SUFFIX)), filename);
+    }
+    length += snprintf(&headers[length], sizeof(headers) - length, "\r\n");
+    if (raw_send(req, headers, length) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to send headers for %s", filename);
+        return ESP_FAIL;
+    }
+    if (content_length == 0) {
+        return ESP_OK;
+    }
+
+    esp_err_t err = file_manager_read_file(filename, first, content_length, file_chunk, FILE_CHUNK_SIZE, file_chunk_send, req);
+    if (err != ESP_OK) {
+        // headers are already sent, client sees truncated response and can resume it with Range
+        ESP_LOGE(TAG, "Failed to send %s: %s", filename, esp_err_to_name(err));
+        return ESP_FAIL;
+    }
     return ESP_OK;
 }
 
@@ -324,6 +1087,155 @@ static httpd_uri_t uri_results_download_get = {
 };
 //@}
 
+/**
+ * @brief Size of tar header and data block
+ */
+#define TAR_BLOCK_SIZE 512
+
+/**
+ * @brief State of \c /results.tar archive being streamed
+ */
+typedef struct {
+    httpd_req_t *req;
+    uint32_t sent;      ///< bytes of current file sent
+    unsigned count;     ///< number of files whose header was sent
+} tar_stream_t;
+
+/**
+ * @brief Read callback for file_manager that sends read part of file as HTTP chunk of archive
+ * 
+ * @param data part of file
+ * @param size size of data
+ * @param arg expects tar_stream_t
+ * @return esp_err_t 
+ */
+static esp_err_t tar_chunk_send(const uint8_t *data, size_t size, void *arg){
+    tar_stream_t *tar = (tar_stream_t *) arg;
+    tar->sent += size;
+    return httpd_resp_send_chunk(tar->req, (const char *) data, size);
+}
+
+/**
+ * @brief Sends given number of zero bytes from file_chunk
+ */
+static esp_err_t tar_send_zeros(httpd_req_t *req, size_t size){
+    memset(file_chunk, 0, (size < FILE_CHUNK_SIZE) ? size : FILE_CHUNK_SIZE);
+    while(size > 0){
+        size_t part = (size < FILE_CHUNK_SIZE) ? size : FILE_CHUNK_SIZE;
+        esp_err_t err = httpd_resp_send_chunk(req, (const char *) file_chunk, part);
+        if(err != ESP_OK){
+            return err;
+        }
+        size -= part;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Fills ustar header of regular file into first TAR_BLOCK_SIZE bytes of file_chunk
+ */
+static void tar_fill_header(const file_info_t *info){
+    char *header = (char *) file_chunk;
+    memset(header, 0, TAR_BLOCK_SIZE);
+    strncpy(header, info->filename, 99);
+    snprintf(&header[100], 8, "%07o", 0644);    // mode
+    snprintf(&header[108], 8, "%07o", 0);       // uid
+    snprintf(&header[116], 8, "%07o", 0);       // gid
+    snprintf(&header[124], 12, "%011o", info->size);
+    snprintf(&header[136], 12, "%011o", info->timestamp);
+    memset(&header[148], ' ', 8);               // checksum is computed with spaces in its field
+    header[156] = '0';                          // regular file
+    memcpy(&header[257], "ustar", 6);
+    memcpy(&header[263], "00", 2);
+    unsigned checksum = 0;
+    for(unsigned i = 0; i < TAR_BLOCK_SIZE; i++){
+        checksum += file_chunk[i];
+    }
+    snprintf(&header[148], 8, "%06o", checksum);
+    header[155] = ' ';
+}
+
+/**
+ * @brief List callback that appends file to archive
+ * 
+ * @param info file to append
+ * @param arg expects tar_stream_t
+ * @return esp_err_t ESP_OK to continue with next file, otherwise client is gone
+ */
+static esp_err_t tar_add_file(const file_info_t *info, void *arg){
+    tar_stream_t *tar = (tar_stream_t *) arg;
+    tar_fill_header(info);
+    esp_err_t err = httpd_resp_send_chunk(tar->req, (const char *) file_chunk, TAR_BLOCK_SIZE);
+    if(err != ESP_OK){
+        return err;
+    }
+    tar->count++;
+    tar->sent = 0;
+    err = file_manager_read_file(info->filename, 0, info->size, file_chunk, FILE_CHUNK_SIZE, tar_chunk_send, tar);
+    if((err != ESP_OK) && (tar->sent == 0)){
+        // archive structure is kept even if file disappeared after listing
+        ESP_LOGW(TAG, "Failed to read %s: %s", info->filename, esp_err_to_name(err));
+    } else if(err != ESP_OK){
+        return err;
+    }
+    // file shrunk since it was listed, header promised info->size bytes
+    uint32_t padding = (info->size - tar->sent) + ((TAR_BLOCK_SIZE - (info->size % TAR_BLOCK_SIZE)) % TAR_BLOCK_SIZE);
+    return tar_send_zeros(tar->req, padding);
+}
+
+/**
+ * @brief Handlers for \c /results.tar endpoint
+ *
+ * This endpoint streams saved result files as single ustar archive generated on the fly.
+ * Every file is sent through file_chunk, so memory usage doesn't depend on number or size of files.
+ * Archived files are selected by the same query parameters as \c /results listing (see parse_results_query()).
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_results_tar_get_handler(httpd_req_t *req) {
+    if(reply_if_restoring(req)){
+        return ESP_OK;
+    }
+    tar_stream_t tar = { .req = req };
+    file_manager_filter_t filter;
+    unsigned offset;
+    unsigned limit;
+    if(parse_results_query(req, &filter, &offset, &limit) != ESP_OK){
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid query");
+        return ESP_FAIL;
+    }
+
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "application/x-tar"));
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"results.tar\""));
+    esp_err_t err = file_manager_for_each_file(&filter, offset, limit, tar_add_file, &tar);
+    if(err == ESP_ERR_INVALID_STATE){
+        ESP_LOGE(TAG, "Failed to list files");
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to list files");
+        return ESP_FAIL;
+    }
+    if(err != ESP_OK){
+        // headers are already sent, client sees truncated archive
+        ESP_LOGE(TAG, "Failed to send archive: %s", esp_err_to_name(err));
+        return ESP_FAIL;
+    }
+    ESP_LOGD(TAG, "Archived %u result files", tar.count);
+    // end of archive is marked by two zero blocks
+    err = tar_send_zeros(req, 2 * TAR_BLOCK_SIZE);
+    if(err != ESP_OK){
+        return err;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_results_tar_get = {
+    .uri = "/results.tar",
+    .method = HTTP_GET,
+    .handler = uri_results_tar_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
 /**
  * @brief Handlers for \c /results/{filename} endpoint (DELETE)
  *
@@ -333,6 +1245,9 @@ static httpd_uri_t uri_results_download_get = {
  * @{
  */
 static esp_err_t uri_results_delete_handler(httpd_req_t *req) {
+    if(reply_if_restoring(req)){
+        return ESP_OK;
+    }
     // Extract filename from URI path
     char filename[128] = {0};
     size_t uri_len = strlen(req->uri);
@@ -340,6 +1255,7 @@ static esp_err_t uri_results_delete_handler(httpd_req_t *req) {
     // URI format: /results/filename.ext
     if (uri_len > 9) { // "/results/" = 9 characters
         strncpy(filename, req->uri + 9, sizeof(filename) - 1);
+        filename[strcspn(filename, "?")] = '\0';
     }
 
     if (filename[0] == '\0') {
@@ -368,17 +1284,28 @@ static httpd_uri_t uri_results_delete = {
 };
 //@}
 
+/**
+ * @brief Session close callback. Event stream, telemetry and live PCAP clients are forgotten before their socket can be reused.
+ * @param server
+ * @param sockfd closed socket
+ */
+static void webserver_close_fn(httpd_handle_t server, int sockfd){
+    event_stream_remove_client(sockfd);
+    telemetry_stream_remove_client(sockfd);
+    live_pcap_remove_client(sockfd);
+    close(sockfd);
+}
+
 void webserver_run(){
     ESP_LOGD(TAG, "Running webserver");
 
-    // Initialize file manager for SPIFFS
-    if (file_manager_init() != ESP_OK) {
-        ESP_LOGW(TAG, "File manager initialization failed, results won't be saved to SPIFFS");
-    }
-
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.max_uri_handlers = 11;
+    config.max_uri_handlers = 21;
+    config.close_fn = webserver_close_fn;
     config.stack_size = 8192;
+    // "/results/*" routes need wildcard matching, exact routes are matched as before.
+    // "/results" and "/results.tar" don't start with "/results/", so the wildcard never takes them.
+    config.uri_match_fn = httpd_uri_match_wildcard;
     httpd_handle_t server = NULL;
 
     esp_err_t ret = httpd_start(&server, &config);
@@ -387,16 +1314,37 @@ void webserver_run(){
         return;
     }
     
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_root_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_reset_head));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_ap_list_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_run_attack_post));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_status_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_pcap_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_hccapx_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_results_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_results_download_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_results_delete));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_root_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_reset_head));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_ap_list_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_run_attack_post));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_status_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_timing_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_metrics_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_events_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_telemetry));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_capture_pcap_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_capture_pcapng_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_capture_hccapx_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_capture_22000_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_capture_live_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_results_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_results_download_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_results_tar_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_results_delete));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_jobs_post));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_jobs_get));
+    ESP_ERROR_CHECK(metrics_register_uri_handler(server, &uri_jobs_delete));
+    
+    if (event_stream_init(server) != ESP_OK) {
+        ESP_LOGW(TAG, "Event stream unavailable, clients have to poll /status");
+    }
+    if (telemetry_stream_init(server) != ESP_OK) {
+        ESP_LOGW(TAG, "Telemetry stream unavailable");
+    }
+    if (live_pcap_init(server) != ESP_OK) {
+        ESP_LOGW(TAG, "Live PCAP stream unavailable");
+    }
     
     ESP_LOGI(TAG, "Webserver started successfully");
 }
\ No newline at end of file
@@ -8,22 +8,148 @@
  */
 #include "ap_scanner.h"
 
+#include <string.h>
+
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 #include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+/**
+ * @brief Scanner task parameters
+ * @{
+ */
+#define SCANNER_STACK_SIZE 3072
+#define SCANNER_PRIORITY (tskIDLE_PRIORITY + 2)
+//@}
 
 static const char* TAG = "wifi_controller/ap_scanner";
 /**
- * @brief Stores last scanned AP records into linked list.
+ * @brief AP table merged from finished scans. Guarded by records_mutex.
  * 
  */
 static wifictl_ap_records_t ap_records;
+/**
+ * @brief Records of scan in progress. Owned by scanning task.
+ */
+static wifictl_ap_records_t scan_records;
+static SemaphoreHandle_t records_mutex = NULL;
+/**
+ * @brief Held for the whole scan, so wifictl_pause_scans() can wait for it
+ */
+static SemaphoreHandle_t scan_mutex = NULL;
+/**
+ * @brief Set by wifictl_pause_scans() while attack uses the radio. Changed only under scan_mutex.
+ */
+static volatile bool scans_paused = false;
+static TaskHandle_t scanner_task_handle = NULL;
+/**
+ * @brief Set when scan is requested, cleared when it finishes
+ */
+static volatile bool scan_pending = false;
+
+/**
+ * @brief Whether AP record changed in a way that client must receive whole record again
+ */
+static bool record_info_changed(const wifi_ap_record_t *old_record, const wifi_ap_record_t *new_record){
+    return (memcmp(old_record->ssid, new_record->ssid, sizeof(old_record->ssid)) != 0) ||
+        (old_record->primary != new_record->primary) ||
+        (old_record->authmode != new_record->authmode);
+}
+
+/**
+ * @brief Finds slot for newly seen AP
+ * 
+ * Unused slot is preferred, otherwise slot of AP removed longest ago is reused.
+ * @return slot index, -1 if all slots hold present APs
+ */
+static int find_free_slot(){
+    if(ap_records.count < CONFIG_SCAN_MAX_AP){
+        return ap_records.count++;
+    }
+    int free_slot = -1;
+    for(unsigned i = 0; i < ap_records.count; i++){
+        if(!ap_records.slots[i].present && ((free_slot < 0) || (ap_records.slots[i].seq < ap_records.slots[free_slot].seq))){
+            free_slot = i;
+        }
+    }
+    return free_slot;
+}
+
+/**
+ * @brief Merges records of finished scan into AP table. Caller holds records_mutex.
+ * 
+ * APs are matched by BSSID. Changed slots are stamped with next table version, table version is incremented only if anything changed.
+ * @return number of changed slots
+ */
+static unsigned merge_scan_records(){
+    uint32_t seq = ap_records.version + 1;
+    bool seen[CONFIG_SCAN_MAX_AP] = { false };
+    bool matched[CONFIG_SCAN_MAX_AP] = { false };
+    unsigned changes = 0;
+
+    // update APs that are already in the table
+    for(unsigned i = 0; i < scan_records.count; i++){
+        const wifi_ap_record_t *record = &scan_records.records[i];
+        for(unsigned slot = 0; slot < ap_records.count; slot++){
+            if(!ap_records.slots[slot].present || seen[slot] || (memcmp(ap_records.records[slot].bssid, record->bssid, 6) != 0)){
+                continue;
+            }
+            if(record_info_changed(&ap_records.records[slot], record)){
+                ap_records.slots[slot].seq = ap_records.slots[slot].added_seq = seq;
+                changes++;
+            } else if(ap_records.records[slot].rssi != record->rssi){
+                ap_records.slots[slot].seq = seq;
+                changes++;
+            }
+            memcpy(&ap_records.records[slot], record, sizeof(wifi_ap_record_t));
+            seen[slot] = true;
+            matched[i] = true;
+            break;
+        }
+    }
+    // remove APs missing in this scan, their slots can be reused
+    for(unsigned slot = 0; slot < ap_records.count; slot++){
+        if(ap_records.slots[slot].present && !seen[slot]){
+            ap_records.slots[slot].present = false;
+            ap_records.slots[slot].seq = seq;
+            changes++;
+        }
+    }
+    // add newly seen APs
+    for(unsigned i = 0; i < scan_records.count; i++){
+        if(matched[i]){
+            continue;
+        }
+        int slot = find_free_slot();
+        if(slot < 0){
+            break;
+        }
+        memcpy(&ap_records.records[slot], &scan_records.records[i], sizeof(wifi_ap_record_t));
+        ap_records.slots[slot].present = true;
+        ap_records.slots[slot].seq = ap_records.slots[slot].added_seq = seq;
+        changes++;
+    }
+    if(changes > 0){
+        ap_records.version = seq;
+    }
+    return changes;
+}
 
 void wifictl_scan_nearby_aps(){
+    xSemaphoreTake(scan_mutex, portMAX_DELAY);
+    if(scans_paused){
+        ESP_LOGD(TAG, "Scans paused, scan skipped");
+        xSemaphoreGive(scan_mutex);
+        return;
+    }
     ESP_LOGD(TAG, "Scanning nearby APs...");
 
-    ap_records.count = CONFIG_SCAN_MAX_AP;
+    scan_records.count = CONFIG_SCAN_MAX_AP;
 
     wifi_scan_config_t scan_config = {
         .ssid = NULL,
@@ -32,20 +158,105 @@ void wifictl_scan_nearby_aps(){
         .scan_type = WIFI_SCAN_TYPE_ACTIVE
     };
     
-    ESP_ERROR_CHECK(esp_wifi_scan_start(&scan_config, true));
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&ap_records.count, ap_records.records));
-    ESP_LOGI(TAG, "Found %u APs.", ap_records.count);
+    int64_t scan_start = esp_timer_get_time();
+    // scan runs in background, so failure (e.g. STA busy connecting) keeps previous result instead of aborting
+    esp_err_t err = esp_wifi_scan_start(&scan_config, true);
+    if(err == ESP_OK){
+        err = esp_wifi_scan_get_ap_records(&scan_records.count, scan_records.records);
+    }
+    xSemaphoreGive(scan_mutex);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Scan failed: %s", esp_err_to_name(err));
+        return;
+    }
+
+    xSemaphoreTake(records_mutex, portMAX_DELAY);
+    unsigned changes = merge_scan_records();
+    ap_records.timestamp = esp_timer_get_time();
+    xSemaphoreGive(records_mutex);
+    ESP_LOGI(TAG, "Found %u APs in %lld ms, %u slots changed (version %u).", scan_records.count, (ap_records.timestamp - scan_start) / 1000, changes, ap_records.version);
     ESP_LOGD(TAG, "Scan done.");
 }
 
-const wifictl_ap_records_t *wifictl_get_ap_records() {
+/**
+ * @brief Scanner task, performs one scan per notification.
+ * @param arg not used
+ */
+static void scanner_task(void *arg){
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        wifictl_scan_nearby_aps();
+        scan_pending = false;
+    }
+}
+
+void wifictl_ap_scanner_init(){
+    records_mutex = xSemaphoreCreateMutex();
+    scan_mutex = xSemaphoreCreateMutex();
+    if((records_mutex == NULL) || (scan_mutex == NULL)){
+        ESP_LOGE(TAG, "Failed to create AP records mutex");
+        return;
+    }
+    if(xTaskCreate(scanner_task, "ap_scanner", SCANNER_STACK_SIZE, NULL, SCANNER_PRIORITY, &scanner_task_handle) != pdPASS){
+        ESP_LOGE(TAG, "Failed to create scanner task");
+    }
+}
+
+bool wifictl_request_scan(bool force){
+    if(scanner_task_handle == NULL){
+        return false;
+    }
+    if(scans_paused){
+        return false;
+    }
+    if(scan_pending){
+        return true;
+    }
+    xSemaphoreTake(records_mutex, portMAX_DELAY);
+    bool fresh = (ap_records.timestamp > 0) && (esp_timer_get_time() - ap_records.timestamp < CONFIG_SCAN_CACHE_TTL * 1000000LL);
+    xSemaphoreGive(records_mutex);
+    if(fresh && !force){
+        return false;
+    }
+    ESP_LOGD(TAG, "Scan requested%s", force ? " (forced)" : "");
+    scan_pending = true;
+    xTaskNotifyGive(scanner_task_handle);
+    return true;
+}
+
+void wifictl_pause_scans(){
+    // running scan holds the mutex until it finishes
+    xSemaphoreTake(scan_mutex, portMAX_DELAY);
+    scans_paused = true;
+    xSemaphoreGive(scan_mutex);
+    ESP_LOGD(TAG, "Scans paused");
+}
+
+void wifictl_resume_scans(){
+    xSemaphoreTake(scan_mutex, portMAX_DELAY);
+    scans_paused = false;
+    xSemaphoreGive(scan_mutex);
+    ESP_LOGD(TAG, "Scans resumed");
+}
+
+const wifictl_ap_records_t *wifictl_acquire_ap_records() {
+    xSemaphoreTake(records_mutex, portMAX_DELAY);
     return &ap_records;
 }
 
-const wifi_ap_record_t *wifictl_get_ap_record(unsigned index) {
-    if(index > ap_records.count){
-        ESP_LOGE(TAG, "Index out of bounds! %u records available, but %u requested", ap_records.count, index);
-        return NULL;
+void wifictl_release_ap_records() {
+    xSemaphoreGive(records_mutex);
+}
+
+esp_err_t wifictl_get_ap_record(unsigned index, wifi_ap_record_t *ap_record) {
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(records_mutex, portMAX_DELAY);
+    if((index >= ap_records.count) || !ap_records.slots[index].present){
+        ESP_LOGE(TAG, "No AP in slot %u! %u slots used", index, ap_records.count);
+        ret = ESP_ERR_INVALID_ARG;
+    } else {
+        memcpy(ap_record, &ap_records.records[index], sizeof(wifi_ap_record_t));
     }
-    return &ap_records.records[index];
-}
\ No newline at end of file
+    xSemaphoreGive(records_mutex);
+    return ret;
+}
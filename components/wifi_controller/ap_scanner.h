@@ -5,40 +5,97 @@
  * @copyright Copyright (c) 2021
  * 
  * @brief Provides an interface for AP scanning functionality.
+ * 
+ * Scans run in background scanner task and their results are merged into AP table when scan finishes,
+ * so readers always see complete result of the last scan.
+ * 
+ * Every AP keeps its slot in the table while it's seen by consecutive scans, so slot index identifies the AP.
+ * Scan that changes the table increments table version and stamps changed slots with it,
+ * so clients holding older version can fetch only slots changed since then.
  */
 #ifndef AP_SCANNER_H
 #define AP_SCANNER_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
 #include "esp_wifi_types.h"
 
 /**
- * @brief Linked list of wifi_ap_record_t records.
+ * @brief Change tracking of single AP table slot
+ */
+typedef struct {
+    uint32_t seq;           ///< table version of the last change of this slot (added, updated or removed)
+    uint32_t added_seq;     ///< table version when AP was added to this slot or its SSID, channel or auth mode changed
+    bool present;           ///< AP was seen by the last scan, otherwise slot holds removed AP
+} wifictl_ap_slot_t;
+
+/**
+ * @brief AP table built from finished scans.
  * 
  */
 typedef struct {
-    uint16_t count;
+    uint32_t version;       ///< incremented by every scan that changed the table, 0 if no scan changed it yet
+    int64_t timestamp;      ///< esp_timer time of the last finished scan in microseconds
+    uint16_t count;         ///< number of used slots, including slots of removed APs
+    wifictl_ap_slot_t slots[CONFIG_SCAN_MAX_AP];
     wifi_ap_record_t records[CONFIG_SCAN_MAX_AP];
 } wifictl_ap_records_t;
 
+/**
+ * @brief Creates scanner task. Called once when Wi-Fi is initialised.
+ */
+void wifictl_ap_scanner_init();
+
 /**
  * @brief Switches ESP into scanning mode and stores result.
  * 
+ * Blocks until scan finishes. Use wifictl_request_scan() from tasks that must not block.
+ * Does nothing while scans are paused by wifictl_pause_scans().
  */
 void wifictl_scan_nearby_aps();
 
 /**
- * @brief Returns current list of scanned APs.
+ * @brief Waits for running scan to finish and stops further scans until wifictl_resume_scans().
+ *
+ * Scan hops channels, so it must not run while attack uses the radio.
+ */
+void wifictl_pause_scans();
+
+/**
+ * @brief Allows scans again after wifictl_pause_scans().
+ */
+void wifictl_resume_scans();
+
+/**
+ * @brief Requests background scan unless cached result is still fresh.
+ * 
+ * Returns immediately, finished scan is merged into AP table.
+ * @param force scan even if cached result is younger than CONFIG_SCAN_CACHE_TTL
+ * @return true if scan is pending or running, false also while scans are paused
+ */
+bool wifictl_request_scan(bool force);
+
+/**
+ * @brief Locks AP table and returns it. Table must be released by wifictl_release_ap_records().
  * 
  * @return const wifictl_ap_records_t* 
  */
-const wifictl_ap_records_t *wifictl_get_ap_records();
+const wifictl_ap_records_t *wifictl_acquire_ap_records();
+
+/**
+ * @brief Unlocks AP table locked by wifictl_acquire_ap_records().
+ */
+void wifictl_release_ap_records();
 
 /**
- * @brief Returns AP record on given index
+ * @brief Copies AP record from given slot of AP table
  * 
- * @param index 
- * @return const wifi_ap_record_t* 
+ * @param index slot index
+ * @param ap_record output parameter
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if index is out of bounds or AP in the slot was removed
  */
-const wifi_ap_record_t *wifictl_get_ap_record(unsigned index);
+esp_err_t wifictl_get_ap_record(unsigned index, wifi_ap_record_t *ap_record);
 
-#endif
\ No newline at end of file
+#endif
@@ -14,6 +14,7 @@
 
 #include "../ap_scanner.h"
 #include "../sniffer.h"
+#include "../sta_reconnect.h"
 
 #include "esp_wifi_types.h"
 
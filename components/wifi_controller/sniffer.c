@@ -19,6 +19,11 @@ static const char *TAG = "sniffer";
 
 ESP_EVENT_DEFINE_BASE(SNIFFER_EVENTS);
 
+/**
+ * @brief Frame counters. Written only from promiscuous callback, 32-bit reads are atomic.
+ */
+static volatile wifictl_sniffer_counters_t counters;
+
 /**
  * @brief Callback for promiscuous reciever. 
  * 
@@ -39,12 +44,15 @@ static void frame_handler(void *buf, wifi_promiscuous_pkt_type_t type) {
     switch (type) {
         case WIFI_PKT_DATA:
             event_id = SNIFFER_EVENT_CAPTURED_DATA;
+            counters.data++;
             break;
         case WIFI_PKT_MGMT:
             event_id = SNIFFER_EVENT_CAPTURED_MGMT;
+            counters.mgmt++;
             break;
         case WIFI_PKT_CTRL:
             event_id = SNIFFER_EVENT_CAPTURED_CTRL;
+            counters.ctrl++;
             break;
         default:
             return;
@@ -83,4 +91,10 @@ void wifictl_sniffer_start(uint8_t channel) {
 void wifictl_sniffer_stop() {
     ESP_LOGI(TAG, "Stopping promiscuous mode...");
     esp_wifi_set_promiscuous(false);
-}
\ No newline at end of file
+}
+
+void wifictl_sniffer_get_counters(wifictl_sniffer_counters_t *counters_out) {
+    counters_out->data = counters.data;
+    counters_out->mgmt = counters.mgmt;
+    counters_out->ctrl = counters.ctrl;
+}
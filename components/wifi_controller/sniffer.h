@@ -10,6 +10,7 @@
 #define SNIFFER_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "esp_event.h"
 
 ESP_EVENT_DECLARE_BASE(SNIFFER_EVENTS);
@@ -20,6 +21,15 @@ enum {
     SNIFFER_EVENT_CAPTURED_CTRL
 };
 
+/**
+ * @brief Number of frames captured by sniffer since boot, per frame type
+ */
+typedef struct {
+    uint32_t data;
+    uint32_t mgmt;
+    uint32_t ctrl;
+} wifictl_sniffer_counters_t;
+
 /**
  * @brief Sets sniffer filter for specific frame types. 
  * 
@@ -42,4 +52,11 @@ void wifictl_sniffer_start(uint8_t channel);
  */
 void wifictl_sniffer_stop();
 
+/**
+ * @brief Copies frame counters. Counters only grow, rates are computed from differences.
+ * 
+ * @param counters output parameter
+ */
+void wifictl_sniffer_get_counters(wifictl_sniffer_counters_t *counters);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+/**
+ * @file sta_reconnect.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements STA association retry engine.
+ */
+#include "sta_reconnect.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_wifi.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "wifi_controller.h"
+
+static const char* TAG = "wifi_controller/sta_reconnect";
+
+static SemaphoreHandle_t reconnect_mutex = NULL;
+/**
+ * @brief Timer that either expires current attempt or starts next one
+ */
+static esp_timer_handle_t attempt_timer_handle = NULL;
+static wifi_ap_record_t target_ap_record;
+static char target_password[64];
+static bool running = false;
+static bool attempt_active = false;
+static int64_t attempt_start = 0;
+static uint32_t backoff_ms = CONFIG_WIFICTL_STA_RECONNECT_INITIAL_BACKOFF_MS;
+static wifictl_sta_reconnect_stats_t stats;
+
+/**
+ * @brief Starts new association attempt. Expects reconnect_mutex to be taken.
+ */
+static void start_attempt(){
+    attempt_active = true;
+    attempt_start = esp_timer_get_time();
+    stats.attempts++;
+    ESP_LOGD(TAG, "Association attempt %u (backoff %u ms)", stats.attempts, backoff_ms);
+    wifictl_sta_connect_to_ap(&target_ap_record, target_password);
+    esp_timer_start_once(attempt_timer_handle, backoff_ms * 1000ULL);
+}
+
+/**
+ * @brief Finishes current attempt and schedules next one. Expects reconnect_mutex to be taken.
+ * 
+ * @param disconnect whether STA has to be disconnected
+ * @param next_delay_ms delay before next attempt
+ */
+static void end_attempt(bool disconnect, uint32_t next_delay_ms){
+    esp_timer_stop(attempt_timer_handle);
+    attempt_active = false;
+    if(disconnect){
+        esp_wifi_disconnect();
+    }
+    esp_timer_start_once(attempt_timer_handle, next_delay_ms * 1000ULL);
+}
+
+static void grow_backoff(){
+    backoff_ms *= 2;
+    if(backoff_ms > CONFIG_WIFICTL_STA_RECONNECT_MAX_BACKOFF_MS){
+        backoff_ms = CONFIG_WIFICTL_STA_RECONNECT_MAX_BACKOFF_MS;
+    }
+}
+
+/**
+ * @brief Callback for attempt timer.
+ * 
+ * If attempt is in progress, it didn't get M1 in time, so it's ended and backoff grows.
+ * Then new attempt is started.
+ * 
+ * @param arg not used
+ */
+static void attempt_timer_callback(void *arg){
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    if(running){
+        if(attempt_active){
+            stats.timeouts++;
+            esp_wifi_disconnect();
+            grow_backoff();
+        }
+        start_attempt();
+    }
+    xSemaphoreGive(reconnect_mutex);
+}
+
+/**
+ * @brief Callback for WIFI_EVENT_STA_DISCONNECTED event.
+ * 
+ * AP refused or dropped association during attempt. Next attempt is started after backoff.
+ * Disconnects initiated by this engine are ignored.
+ * 
+ * @param args not used
+ * @param event_base expects WIFI_EVENT
+ * @param event_id expects WIFI_EVENT_STA_DISCONNECTED
+ * @param event_data expects wifi_event_sta_disconnected_t
+ */
+static void sta_disconnected_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    wifi_event_sta_disconnected_t *event = (wifi_event_sta_disconnected_t *) event_data;
+    if(event->reason == WIFI_REASON_ASSOC_LEAVE){
+        return;
+    }
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    if(running && attempt_active){
+        ESP_LOGD(TAG, "Association failed (reason %u)", event->reason);
+        stats.failures++;
+        end_attempt(false, backoff_ms);
+        grow_backoff();
+    }
+    xSemaphoreGive(reconnect_mutex);
+}
+
+void wifictl_sta_reconnect_start(const wifi_ap_record_t *ap_record, const char password[]){
+    if(reconnect_mutex == NULL){
+        reconnect_mutex = xSemaphoreCreateMutex();
+        const esp_timer_create_args_t attempt_timer_args = {
+            .callback = &attempt_timer_callback
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&attempt_timer_args, &attempt_timer_handle));
+    }
+    if(strlen(password) >= sizeof(target_password)){
+        ESP_LOGE(TAG, "Password is too long. Max supported length is 63");
+        return;
+    }
+
+    // event handler is (un)registered without reconnect_mutex, because event loop may be blocked by the handler waiting for it
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &sta_disconnected_handler, NULL));
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    memcpy(&target_ap_record, ap_record, sizeof(wifi_ap_record_t));
+    strcpy(target_password, password);
+    memset(&stats, 0, sizeof(stats));
+    backoff_ms = CONFIG_WIFICTL_STA_RECONNECT_INITIAL_BACKOFF_MS;
+    running = true;
+    start_attempt();
+    xSemaphoreGive(reconnect_mutex);
+}
+
+void wifictl_sta_reconnect_stop(){
+    if(reconnect_mutex == NULL){
+        return;
+    }
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    bool was_running = running;
+    if(running){
+        running = false;
+        attempt_active = false;
+        esp_timer_stop(attempt_timer_handle);
+        ESP_LOGI(TAG, "%u attempts, %u M1, %u timeouts, %u failures, mean M1 latency %u us", 
+            stats.attempts, stats.m1_count, stats.timeouts, stats.failures, 
+            (stats.m1_count > 0) ? (uint32_t) (stats.total_latency_us / stats.m1_count) : 0);
+    }
+    xSemaphoreGive(reconnect_mutex);
+    if(was_running){
+        esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &sta_disconnected_handler);
+        esp_wifi_disconnect();
+    }
+}
+
+void wifictl_sta_reconnect_m1_received(){
+    if(reconnect_mutex == NULL){
+        return;
+    }
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    if(running && attempt_active){
+        uint32_t latency_us = esp_timer_get_time() - attempt_start;
+        stats.m1_count++;
+        stats.last_latency_us = latency_us;
+        stats.total_latency_us += latency_us;
+        if((stats.m1_count == 1) || (latency_us < stats.min_latency_us)){
+            stats.min_latency_us = latency_us;
+        }
+        if(latency_us > stats.max_latency_us){
+            stats.max_latency_us = latency_us;
+        }
+        ESP_LOGD(TAG, "M1 received %u us after attempt start", latency_us);
+        backoff_ms = CONFIG_WIFICTL_STA_RECONNECT_INITIAL_BACKOFF_MS;
+        end_attempt(true, CONFIG_WIFICTL_STA_RECONNECT_DELAY_MS);
+    }
+    xSemaphoreGive(reconnect_mutex);
+}
+
+void wifictl_sta_reconnect_get_stats(wifictl_sta_reconnect_stats_t *stats_out){
+    if(reconnect_mutex == NULL){
+        memset(stats_out, 0, sizeof(wifictl_sta_reconnect_stats_t));
+        return;
+    }
+    xSemaphoreTake(reconnect_mutex, portMAX_DELAY);
+    memcpy(stats_out, &stats, sizeof(wifictl_sta_reconnect_stats_t));
+    xSemaphoreGive(reconnect_mutex);
+}
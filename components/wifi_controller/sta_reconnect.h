@@ -0,0 +1,62 @@
+/**
+ * @file sta_reconnect.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides an interface for STA association retry engine.
+ * 
+ * Engine repeatedly associates STA to target AP. Every attempt waits for EAPoL M1 for current backoff time,
+ * when it expires, STA is disconnected and backoff is doubled up to maximum. When M1 is received,
+ * STA is disconnected right away, so AP sends fresh M1 on next attempt, and backoff is reset.
+ */
+#ifndef STA_RECONNECT_H
+#define STA_RECONNECT_H
+
+#include <stdint.h>
+
+#include "esp_wifi_types.h"
+
+/**
+ * @brief Statistics of association attempts since last wifictl_sta_reconnect_start()
+ */
+typedef struct {
+    uint32_t attempts;          ///< started association attempts
+    uint32_t m1_count;          ///< attempts finished by received EAPoL M1
+    uint32_t timeouts;          ///< attempts without M1 within backoff time
+    uint32_t failures;          ///< attempts ended by AP (disconnect)
+    uint32_t last_latency_us;   ///< attempt start to M1 latency of the last successful attempt
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint64_t total_latency_us;  ///< sum of latencies of successful attempts, divide by m1_count for mean
+} wifictl_sta_reconnect_stats_t;
+
+/**
+ * @brief Starts association retry loop against given AP.
+ * 
+ * @param ap_record target AP, it's copied
+ * @param password password used for association
+ */
+void wifictl_sta_reconnect_start(const wifi_ap_record_t *ap_record, const char password[]);
+
+/**
+ * @brief Stops association retry loop and disconnects STA.
+ */
+void wifictl_sta_reconnect_stop();
+
+/**
+ * @brief Reports that EAPoL M1 of current attempt was received.
+ * 
+ * Latency of current attempt is recorded, STA is disconnected and next attempt is started after CONFIG_WIFICTL_STA_RECONNECT_DELAY_MS.
+ * Can be called from any task.
+ */
+void wifictl_sta_reconnect_m1_received();
+
+/**
+ * @brief Copies statistics of association attempts.
+ * 
+ * @param stats output parameter
+ */
+void wifictl_sta_reconnect_get_stats(wifictl_sta_reconnect_stats_t *stats);
+
+#endif
@@ -45,6 +45,7 @@ static void wifi_init_apsta(){
     ESP_ERROR_CHECK(esp_wifi_get_mac(WIFI_IF_AP, original_mac_ap));
 
     ESP_ERROR_CHECK(esp_wifi_start());
+    wifictl_ap_scanner_init();
     wifi_init = true;
 }
 
@@ -9,6 +9,7 @@
 
 #include "attack.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -17,242 +18,607 @@
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_timer.h"
-#include "nvs_flash.h"
-#include "pcap_serializer.h"
-#include "hccapx_serializer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "capture_store.h"
 #include "../components/webserver/file_manager.h"
-#include "nvs.h"
+#include "result_log.h"
+#include "run_arena.h"
+#include "gzip_stream.h"
 
 #include "attack_pmkid.h"
 #include "attack_handshake.h"
 #include "attack_dos.h"
+#include "attack_jobs.h"
+#include "attack_timing.h"
+#include "attack_telemetry.h"
 #include "webserver.h"
 #include "wifi_controller.h"
 
-#define NVS_NAMESPACE "attack_data"
-#define NVS_KEY_STATE "state"
-#define NVS_KEY_TYPE "type"
-#define NVS_KEY_CONTENT_SIZE "content_size"
-#define NVS_KEY_CONTENT "content"
+/**
+ * @brief Types of records appended to result log
+ */
+typedef enum {
+    RESULT_RECORD_ATTACK = 1,   ///< saved_result_header_t, capture_store_meta_t and captured frame records
+    RESULT_RECORD_CLEARED = 2,  ///< results were reset, previous records must not be restored
+    RESULT_RECORD_CHECKPOINT = 3 ///< checkpoint_header_t, capture_store_meta_t and frame records captured since previous checkpoint
+} result_record_type_t;
+
+/**
+ * @brief Header of RESULT_RECORD_ATTACK payload
+ */
+typedef struct {
+    uint8_t state;
+    uint8_t type;
+    uint16_t reserved;
+    uint32_t records_size;  ///< size of captured frame records following capture_store_meta_t
+} saved_result_header_t;
+
+/**
+ * @brief Header of RESULT_RECORD_CHECKPOINT payload
+ * 
+ * Checkpoints of one run form chain of consecutive records. The first one has records_offset 0,
+ * every next one continues where the previous one ended.
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t reserved2;
+    uint32_t run_id;
+    uint32_t records_offset;    ///< offset of contained frame records within all records of the run
+    uint32_t records_size;      ///< size of frame records following capture_store_meta_t
+} checkpoint_header_t;
+
+/**
+ * @brief Maximum number of delta checkpoints in a chain.
+ * 
+ * When reached, next checkpoint contains all records again. Chain has to fit into result log index to be restorable.
+ */
+#define CHECKPOINT_MAX_DELTAS (CONFIG_RESULT_LOG_INDEX_SIZE / 2)
+
+/**
+ * @brief Attack controller task parameters
+ * 
+ * Priority is kept below default event loop task, so frame processing is never delayed by attack start/stop.
+ * Stack covers restore (SPIFFS mount and results index reconciliation through VFS, result log replay) and saving
+ * of results through GZIP compressor, free stack left by restore is logged.
+ * @{
+ */
+#define ATTACK_CONTROLLER_STACK_SIZE 6144
+#define ATTACK_CONTROLLER_PRIORITY 5
+#define ATTACK_CONTROLLER_QUEUE_LENGTH 8
+//@}
+
+/**
+ * @brief Priority of attack controller task while restoring results of previous session.
+ * 
+ * Restore only reads flash, so it runs just above idle and doesn't delay webserver responses.
+ */
+#define ATTACK_RESTORE_PRIORITY (tskIDLE_PRIORITY + 1)
+
+/**
+ * @brief Bits of restore_events event group
+ * @{
+ */
+#define RESTORE_REQUESTED_BIT (1 << 0)
+#define RESTORE_DONE_BIT (1 << 1)
+//@}
+
+/**
+ * @brief Commands consumed by attack controller task.
+ */
+typedef enum {
+    ATTACK_CMD_START,   ///< start new attack described by attack_command_t.request
+    ATTACK_CMD_STOP,    ///< stop running attack and keep its results
+    ATTACK_CMD_TIMEOUT, ///< attack timeout timer expired
+    ATTACK_CMD_RESULT,  ///< running attack obtained its result
+    ATTACK_CMD_RESET,   ///< clear results and return to READY state
+    ATTACK_CMD_JOB_ADD, ///< append job described by attack_command_t.request to job queue
+    ATTACK_CMD_JOBS_CLEAR, ///< stop running job and remove all jobs
+    ATTACK_CMD_CHECKPOINT ///< append records captured by running attack to result log
+} attack_command_type_t;
+
+/**
+ * @brief Command passed through attack controller queue.
+ */
+typedef struct {
+    attack_command_type_t type;
+    uint32_t run_id;            ///< run the command belongs to (TIMEOUT and RESULT), stale commands are dropped
+    attack_request_t request;   ///< valid for ATTACK_CMD_START and ATTACK_CMD_JOB_ADD
+} attack_command_t;
 
 static const char* TAG = "attack";
-static attack_status_t attack_status = { .state = READY, .type = -1, .content_size = 0, .content = NULL };
+ESP_EVENT_DEFINE_BASE(ATTACK_EVENTS);
+static attack_status_t attack_status = { .state = READY, .type = -1, .flags = 0, .reserved = 0, .content_size = 0 };
+static SemaphoreHandle_t status_mutex = NULL;
 static esp_timer_handle_t attack_timeout_handle;
+static esp_timer_handle_t checkpoint_timer_handle;
+static QueueHandle_t command_queue = NULL;
+static EventGroupHandle_t restore_events = NULL;
+/**
+ * @brief Identifier of current attack run. Owned by attack controller task.
+ */
+static uint32_t run_id = 0;
+/**
+ * @brief Copy of target AP record of current run, so the run doesn't depend on AP scan results or job table.
+ */
+static wifi_ap_record_t current_ap_record;
+/**
+ * @brief Whether current run was started from job queue.
+ */
+static bool job_running = false;
+/**
+ * @brief Progress of checkpoints of current run. Owned by attack controller task.
+ * @{
+ */
+static size_t checkpoint_records_size = 0;
+static capture_store_meta_t checkpoint_meta;
+static unsigned checkpoint_deltas = 0;
+//@}
+
+void attack_get_status(attack_status_t *status) {
+    // while restore is pending status is READY and capture store is empty, so nothing waits for it
+    xSemaphoreTake(status_mutex, portMAX_DELAY);
+    memcpy(status, &attack_status, sizeof(attack_status_t));
+    xSemaphoreGive(status_mutex);
+    status->flags = (capture_store_get_dropped_frames() > 0) ? ATTACK_STATUS_FLAG_TRUNCATED : 0;
+    status->content_size = capture_store_get_view_size(CAPTURE_VIEW_STATUS);
+    attack_timing_get_run(status->phase_us);
+}
 
-const attack_status_t *attack_get_status() {
-    return &attack_status;
+bool attack_is_running() {
+    xSemaphoreTake(status_mutex, portMAX_DELAY);
+    bool running = (attack_status.state == RUNNING);
+    xSemaphoreGive(status_mutex);
+    return running;
 }
 
-void attack_update_status(attack_state_t state) {
+/**
+ * @brief Sets new attack state and type and posts ATTACK_EVENT_STATUS_CHANGED. Called only from attack controller task.
+ */
+static void set_status(attack_state_t state, uint8_t type) {
+    attack_status_t status;
+    xSemaphoreTake(status_mutex, portMAX_DELAY);
     attack_status.state = state;
-    if(state == FINISHED) {
-        ESP_LOGD(TAG, "Stopping attack timeout timer");
-        ESP_ERROR_CHECK(esp_timer_stop(attack_timeout_handle));
-        
-        // Save results to flash when finished
-        if (attack_status.content_size > 0) {
-            ESP_LOGI(TAG, "Saving finished results to flash...");
-            attack_save_results_to_flash();
-        }
-    } 
+    attack_status.type = type;
+    memcpy(&status, &attack_status, ATTACK_STATUS_HEADER_SIZE);
+    xSemaphoreGive(status_mutex);
+    status.flags = (capture_store_get_dropped_frames() > 0) ? ATTACK_STATUS_FLAG_TRUNCATED : 0;
+    status.content_size = capture_store_get_view_size(CAPTURE_VIEW_STATUS);
+    ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(ATTACK_EVENTS, ATTACK_EVENT_STATUS_CHANGED, &status, ATTACK_STATUS_HEADER_SIZE, portMAX_DELAY));
+}
+
+/**
+ * @brief Releases all memory of previous run at once. Capture store is cleared first, so no view points into the arena.
+ */
+static void reset_run_memory() {
+    capture_store_clear();
+    run_arena_reset();
 }
 
-void attack_append_status_content(uint8_t *buffer, unsigned size){
-    if(size == 0){
-        ESP_LOGE(TAG, "Size can't be 0 if you want to reallocate");
+/**
+ * @brief Posts command into attack controller queue.
+ * 
+ * Queue is never expected to be full. If it is, the command is dropped rather than blocking caller
+ * which may be event loop or esp_timer task.
+ */
+static void post_command(attack_command_type_t type, uint32_t command_run_id, const attack_request_t *request) {
+    attack_command_t command = { .type = type, .run_id = command_run_id };
+    if (request != NULL) {
+        command.request = *request;
+    }
+    if (xQueueSend(command_queue, &command, 0) != pdTRUE) {
+        ESP_LOGE(TAG, "Attack command queue full, command %d dropped", type);
+    }
+}
+
+void attack_report_result(uint32_t result_run_id) {
+    post_command(ATTACK_CMD_RESULT, result_run_id, NULL);
+}
+
+/**
+ * @brief Renders view of capture_store into new result file on SPIFFS.
+ * 
+ * @param view view to be saved
+ * @param extension file extension
+ * @param compress whether file should be compressed
+ */
+static void save_view_to_file(capture_view_t view, const char *extension, bool compress) {
+    if (capture_store_get_view_size(view) == 0) {
         return;
     }
-    // temporarily save new location in case of realloc failure to preserve current content
-    char *reallocated_content = realloc(attack_status.content, attack_status.content_size + size);
-    if(reallocated_content == NULL){
-        ESP_LOGE(TAG, "Error reallocating status content! Status content may not be complete.");
+    // compressor state is per-run memory too, heap is used only if arena is full
+    void *stream_buffer = compress ? run_arena_alloc(gzip_stream_get_size()) : NULL;
+    file_manager_writer_t *writer = file_manager_writer_open(extension, compress, stream_buffer);
+    if (writer == NULL) {
+        ESP_LOGW(TAG, "Failed to create %s file on SPIFFS", extension);
         return;
     }
-    // copy new data after current content
-    memcpy(&reallocated_content[attack_status.content_size], buffer, size);
-    attack_status.content = reallocated_content;
-    attack_status.content_size += size;
+    capture_store_meta_t meta;
+    capture_store_get_meta(&meta);
+    file_manager_writer_set_target(writer, meta.ssid, meta.ssid_len, meta.bssid);
+    esp_err_t err = capture_store_render(view, file_manager_writer_write, writer);
+    if (file_manager_writer_close(writer, err == ESP_OK) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to save %s file to SPIFFS", extension);
+    }
 }
 
-char *attack_alloc_result_content(unsigned size) {
-    if (size == 0) {
-        ESP_LOGW(TAG, "Attempting to allocate 0 bytes");
-        return NULL;
+/**
+ * @brief Appends complete capture_store content to result log as RESULT_RECORD_ATTACK.
+ *
+ * Store stays locked while records are written, so they can't be cleared under the writer.
+ * Each contiguous segment of records (run arena, heap chunks) is one part of the record.
+ */
+static esp_err_t append_result_record(uint8_t state, uint8_t type) {
+    const capture_store_meta_t *meta;
+    const uint8_t *segment;
+    size_t records_size;
+    capture_store_lock();
+    capture_store_get_raw(&meta, &records_size);
+
+    unsigned part_count = 2;
+    for (size_t offset = 0; offset < records_size; part_count++) {
+        offset += capture_store_get_segment(offset, &segment);
     }
-    
-    // Free existing content if present
-    if (attack_status.content != NULL) {
-        ESP_LOGD(TAG, "Freeing existing content before new allocation");
-        free(attack_status.content);
-        attack_status.content = NULL;
-        attack_status.content_size = 0;
+    result_log_part_t *parts = (result_log_part_t *) malloc(part_count * sizeof(result_log_part_t));
+    if (parts == NULL) {
+        capture_store_unlock();
+        ESP_LOGE(TAG, "Failed to allocate result record parts");
+        return ESP_ERR_NO_MEM;
     }
-    
-    attack_status.content_size = size;
-    attack_status.content = (char *) malloc(size);
-    if (attack_status.content == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate %u bytes for attack content", size);
-        attack_status.content_size = 0;
+    saved_result_header_t header = {
+        .state = state,
+        .type = type,
+        .reserved = 0,
+        .records_size = records_size
+    };
+    parts[0].data = &header;
+    parts[0].size = sizeof(saved_result_header_t);
+    parts[1].data = meta;
+    parts[1].size = sizeof(capture_store_meta_t);
+    size_t offset = 0;
+    for (unsigned i = 2; i < part_count; i++) {
+        parts[i].size = capture_store_get_segment(offset, &segment);
+        parts[i].data = segment;
+        offset += parts[i].size;
+    }
+    esp_err_t err = result_log_append(RESULT_RECORD_ATTACK, parts, part_count, NULL);
+    capture_store_unlock();
+    free(parts);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to append results to result log: %s", esp_err_to_name(err));
+    } else {
+        ESP_LOGI(TAG, "Saved %u bytes of captured frames to flash", header.records_size);
     }
-    return attack_status.content;
+    return err;
 }
 
 esp_err_t attack_save_results_to_flash() {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
+    int64_t save_start = esp_timer_get_time();
+    esp_err_t err = append_result_record(attack_status.state, attack_status.type);
+
+    // Additionally save PCAP and HCCAPX files to SPIFFS
+    save_view_to_file(CAPTURE_VIEW_PCAP, "pcap", FILE_MANAGER_COMPRESS_PCAP);
+    save_view_to_file(CAPTURE_VIEW_HCCAPX, "hccapx", false);
+    save_view_to_file(CAPTURE_VIEW_22000, "22000", false);
+
+    attack_timing_record(ATTACK_PHASE_FLASH_SAVE, esp_timer_get_time() - save_start);
+    return err;
+}
+
+/**
+ * @brief Frame records stored in single result log record
+ */
+typedef struct {
+    const result_log_entry_t *entry;
+    size_t records_offset;  ///< offset of records in payload
+} record_reader_t;
+
+/**
+ * @brief Implements capture_store_read_cb_t for records of RESULT_RECORD_ATTACK.
+ */
+static esp_err_t read_result_records(size_t offset, uint8_t *buffer, size_t size, void *arg) {
+    record_reader_t *reader = (record_reader_t *) arg;
+    return result_log_read(reader->entry, reader->records_offset + offset, buffer, size);
+}
 
-    err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+/**
+ * @brief Restores capture_store from RESULT_RECORD_ATTACK record.
+ */
+static esp_err_t load_result_record(const result_log_entry_t *entry) {
+    esp_err_t err = result_log_verify(entry);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS handle: %s", esp_err_to_name(err));
+        ESP_LOGE(TAG, "Saved results are corrupted: %s", esp_err_to_name(err));
         return err;
     }
 
-    // Save state, type, and content size
-    err = nvs_set_u8(nvs_handle, NVS_KEY_STATE, attack_status.state);
+    saved_result_header_t header;
+    capture_store_meta_t meta;
+    err = result_log_read(entry, 0, &header, sizeof(saved_result_header_t));
+    if (err == ESP_OK) {
+        err = result_log_read(entry, sizeof(saved_result_header_t), &meta, sizeof(capture_store_meta_t));
+    }
+    if (err == ESP_OK && entry->length != sizeof(saved_result_header_t) + sizeof(capture_store_meta_t) + header.records_size) {
+        err = ESP_ERR_INVALID_SIZE;
+    }
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save state to NVS: %s", esp_err_to_name(err));
-        nvs_close(nvs_handle);
+        ESP_LOGE(TAG, "Failed to load saved results: %s", esp_err_to_name(err));
         return err;
     }
 
-    err = nvs_set_u8(nvs_handle, NVS_KEY_TYPE, attack_status.type);
+    reset_run_memory();
+    record_reader_t reader = { .entry = entry, .records_offset = sizeof(saved_result_header_t) + sizeof(capture_store_meta_t) };
+    err = capture_store_restore(&meta, header.records_size, read_result_records, &reader);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save type to NVS: %s", esp_err_to_name(err));
-        nvs_close(nvs_handle);
+        ESP_LOGE(TAG, "Failed to load captured frames: %s", esp_err_to_name(err));
+        reset_run_memory();
         return err;
     }
+    if (capture_store_get_view_size(CAPTURE_VIEW_STATUS) > 0) {
+        set_status(header.state, header.type);
+        ESP_LOGI(TAG, "Loaded %u bytes of captured frames from flash", header.records_size);
+    }
+    return ESP_OK;
+}
 
-    err = nvs_set_u16(nvs_handle, NVS_KEY_CONTENT_SIZE, attack_status.content_size);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save content size to NVS: %s", esp_err_to_name(err));
-        nvs_close(nvs_handle);
-        return err;
+/**
+ * @brief Reads and validates header of RESULT_RECORD_CHECKPOINT record.
+ */
+static esp_err_t read_checkpoint_header(const result_log_entry_t *entry, checkpoint_header_t *header) {
+    esp_err_t err = result_log_read(entry, 0, header, sizeof(checkpoint_header_t));
+    if (err == ESP_OK && entry->length != sizeof(checkpoint_header_t) + sizeof(capture_store_meta_t) + header->records_size) {
+        err = ESP_ERR_INVALID_SIZE;
     }
+    return err;
+}
+
+/**
+ * @brief Frame records spread over checkpoint chain
+ */
+typedef struct {
+    const result_log_entry_t *entries;
+    int index;                      ///< checkpoint being read
+    int newest;                     ///< last checkpoint of the chain
+    checkpoint_header_t header;     ///< header of checkpoint being read
+} checkpoint_reader_t;
 
-    // Save content if present
-    if (attack_status.content != NULL && attack_status.content_size > 0) {
-        err = nvs_set_blob(nvs_handle, NVS_KEY_CONTENT, attack_status.content, attack_status.content_size);
+/**
+ * @brief Implements capture_store_read_cb_t for records of checkpoint chain.
+ *
+ * Records are read from start to end, so the reader only moves forward through the chain.
+ */
+static esp_err_t read_checkpoint_records(size_t offset, uint8_t *buffer, size_t size, void *arg) {
+    checkpoint_reader_t *reader = (checkpoint_reader_t *) arg;
+    while (size > 0) {
+        while (offset >= reader->header.records_offset + reader->header.records_size) {
+            if (reader->index >= reader->newest) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            reader->index++;
+            esp_err_t err = read_checkpoint_header(&reader->entries[reader->index], &reader->header);
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+        size_t part = reader->header.records_offset + reader->header.records_size - offset;
+        if (part > size) {
+            part = size;
+        }
+        size_t payload_offset = sizeof(checkpoint_header_t) + sizeof(capture_store_meta_t) + offset - reader->header.records_offset;
+        esp_err_t err = result_log_read(&reader->entries[reader->index], payload_offset, buffer, part);
         if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to save content to NVS: %s", esp_err_to_name(err));
-            nvs_close(nvs_handle);
             return err;
         }
-        ESP_LOGI(TAG, "Saved %d bytes of attack results to flash", attack_status.content_size);
+        offset += part;
+        buffer += part;
+        size -= part;
     }
+    return ESP_OK;
+}
 
-    // Commit changes
-    err = nvs_commit(nvs_handle);
+/**
+ * @brief Reconstructs capture of interrupted run from chain of checkpoints ending with given entry.
+ * 
+ * Restored run is put into TIMEOUT state and consolidated into single RESULT_RECORD_ATTACK record,
+ * so the chain doesn't have to be replayed on next boot.
+ * 
+ * @param entries result log index, oldest first
+ * @param newest index of the newest checkpoint of the chain
+ */
+static esp_err_t load_checkpoints(const result_log_entry_t *entries, int newest) {
+    checkpoint_header_t newest_header, header;
+    esp_err_t err = read_checkpoint_header(&entries[newest], &newest_header);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit to NVS: %s", esp_err_to_name(err));
+        return err;
     }
 
-    nvs_close(nvs_handle);
-
-    // Additionally save PCAP and HCCAPX files to SPIFFS
-    // Save PCAP file if data is available
-    uint8_t *pcap_buffer = pcap_serializer_get_buffer();
-    unsigned pcap_size = pcap_serializer_get_size();
-    if (pcap_buffer != NULL && pcap_size > 0) {
-        if (file_manager_save_pcap(pcap_buffer, pcap_size) != ESP_OK) {
-            ESP_LOGW(TAG, "Failed to save PCAP file to SPIFFS");
+    // walk back to the first checkpoint of the run
+    int first = newest;
+    memcpy(&header, &newest_header, sizeof(checkpoint_header_t));
+    while (header.records_offset > 0) {
+        uint32_t expected_end = header.records_offset;
+        first--;
+        if (first < 0 || entries[first].type != RESULT_RECORD_CHECKPOINT) {
+            ESP_LOGE(TAG, "Checkpoint chain is incomplete");
+            return ESP_ERR_NOT_FOUND;
         }
-    }
-
-    // Save HCCAPX file if data is available
-    hccapx_t *hccapx = hccapx_serializer_get();
-    if (hccapx != NULL) {
-        if (file_manager_save_hccapx((uint8_t *)hccapx, sizeof(hccapx_t), hccapx->essid, hccapx->essid_len) != ESP_OK) {
-            ESP_LOGW(TAG, "Failed to save HCCAPX file to SPIFFS");
+        err = read_checkpoint_header(&entries[first], &header);
+        if (err != ESP_OK) {
+            return err;
+        }
+        if (header.run_id != newest_header.run_id || header.records_offset + header.records_size != expected_end) {
+            ESP_LOGE(TAG, "Checkpoint chain is inconsistent");
+            return ESP_ERR_INVALID_STATE;
         }
     }
 
-    return err;
+    size_t records_size = newest_header.records_offset + newest_header.records_size;
+    for (int i = first; (i <= newest) && (err == ESP_OK); i++) {
+        err = result_log_verify(&entries[i]);
+    }
+    capture_store_meta_t meta;
+    checkpoint_reader_t reader = { .entries = entries, .index = first, .newest = newest };
+    if (err == ESP_OK) {
+        err = result_log_read(&entries[newest], sizeof(checkpoint_header_t), &meta, sizeof(capture_store_meta_t));
+    }
+    if (err == ESP_OK) {
+        err = read_checkpoint_header(&entries[first], &reader.header);
+    }
+    reset_run_memory();
+    if (err == ESP_OK) {
+        err = capture_store_restore(&meta, records_size, read_checkpoint_records, &reader);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to load checkpoints: %s", esp_err_to_name(err));
+        reset_run_memory();
+        return err;
+    }
+    if (capture_store_get_view_size(CAPTURE_VIEW_STATUS) > 0) {
+        set_status(TIMEOUT, newest_header.type);
+        ESP_LOGI(TAG, "Reconstructed %u bytes of captured frames from %d checkpoints", records_size, newest - first + 1);
+        append_result_record(TIMEOUT, newest_header.type);
+    }
+    return ESP_OK;
 }
 
 esp_err_t attack_load_results_from_flash() {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
+    result_log_entry_t *entries = (result_log_entry_t *) malloc(CONFIG_RESULT_LOG_INDEX_SIZE * sizeof(result_log_entry_t));
+    if (entries == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    unsigned count = result_log_get_entries(entries, CONFIG_RESULT_LOG_INDEX_SIZE);
 
-    err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        if (err == ESP_ERR_NVS_NOT_FOUND) {
-            ESP_LOGD(TAG, "No saved results found in flash");
-        } else {
-            ESP_LOGE(TAG, "Failed to open NVS handle: %s", esp_err_to_name(err));
+    // the newest known record decides what is restored
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    for (int i = count - 1; i >= 0; i--) {
+        if (entries[i].type == RESULT_RECORD_ATTACK) {
+            err = load_result_record(&entries[i]);
+            break;
         }
-        return err;
+        if (entries[i].type == RESULT_RECORD_CHECKPOINT) {
+            err = load_checkpoints(entries, i);
+            break;
+        }
+        if (entries[i].type == RESULT_RECORD_CLEARED) {
+            break;
+        }
+    }
+    free(entries);
+    if (err == ESP_ERR_NOT_FOUND) {
+        ESP_LOGD(TAG, "No saved results found in flash");
     }
+    return err;
+}
 
-    // Load state, type, and content size
-    uint8_t state, type;
-    uint16_t content_size;
+/**
+ * @brief Starts new checkpoint chain for run that was just started.
+ */
+static void reset_checkpoints() {
+    const uint8_t *delta;
+    size_t delta_size;
+    capture_store_get_delta(&checkpoint_meta, 0, &delta, &delta_size);
+    checkpoint_records_size = 0;
+    checkpoint_deltas = 0;
+}
 
-    err = nvs_get_u8(nvs_handle, NVS_KEY_STATE, &state);
+/**
+ * @brief Handles ATTACK_CMD_CHECKPOINT.
+ * 
+ * Appends frame records captured since previous checkpoint together with current metadata.
+ * Nothing is written if capture didn't change. After CHECKPOINT_MAX_DELTAS deltas, all records are written again,
+ * so every frame is written at most once per CHECKPOINT_MAX_DELTAS checkpoints plus once in final result.
+ */
+static void checkpoint_attack() {
+    bool full = (checkpoint_deltas >= CHECKPOINT_MAX_DELTAS);
+    size_t offset = full ? 0 : checkpoint_records_size;
+    capture_store_meta_t meta, segment_meta;
+    const uint8_t *delta;
+    size_t delta_size;
+    // new records may continue in further segments (run arena, heap chunks), each of them is one part of the checkpoint
+    size_t records_end = offset;
+    unsigned part_count = 2;
+    esp_err_t err;
+    do {
+        err = capture_store_get_delta(&meta, records_end, &delta, &delta_size);
+        records_end += delta_size;
+        part_count++;
+    } while ((err == ESP_OK) && (delta_size > 0));
     if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
+        ESP_LOGW(TAG, "Failed to get checkpoint data: %s", esp_err_to_name(err));
+        return;
     }
-
-    err = nvs_get_u8(nvs_handle, NVS_KEY_TYPE, &type);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
+    if ((records_end == checkpoint_records_size) && (memcmp(&meta, &checkpoint_meta, sizeof(capture_store_meta_t)) == 0)) {
+        return;
     }
 
-    err = nvs_get_u16(nvs_handle, NVS_KEY_CONTENT_SIZE, &content_size);
-    if (err != ESP_OK) {
-        nvs_close(nvs_handle);
-        return err;
+    result_log_part_t *parts = (result_log_part_t *) malloc(part_count * sizeof(result_log_part_t));
+    if (parts == NULL) {
+        ESP_LOGW(TAG, "Failed to allocate checkpoint parts");
+        return;
     }
-
-    // Load content if present
-    if (content_size > 0) {
-        // Free existing content first
-        if (attack_status.content != NULL) {
-            free(attack_status.content);
-        }
-
-        attack_status.content = (char *)malloc(content_size);
-        if (attack_status.content == NULL) {
-            ESP_LOGE(TAG, "Failed to allocate memory for loaded content");
-            nvs_close(nvs_handle);
-            return ESP_ERR_NO_MEM;
-        }
-
-        size_t required_size = content_size;
-        err = nvs_get_blob(nvs_handle, NVS_KEY_CONTENT, attack_status.content, &required_size);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to load content from NVS: %s", esp_err_to_name(err));
-            free(attack_status.content);
-            attack_status.content = NULL;
-            nvs_close(nvs_handle);
-            return err;
+    checkpoint_header_t header = {
+        .type = attack_status.type,
+        .run_id = run_id,
+        .records_offset = offset,
+        .records_size = records_end - offset
+    };
+    parts[0].data = &header;
+    parts[0].size = sizeof(checkpoint_header_t);
+    parts[1].data = &meta;
+    parts[1].size = sizeof(capture_store_meta_t);
+    // records never move, only the last segment may have grown since it was counted
+    size_t position = offset;
+    for (unsigned i = 2; i < part_count; i++) {
+        capture_store_get_delta(&segment_meta, position, &delta, &delta_size);
+        if (delta_size > records_end - position) {
+            delta_size = records_end - position;
         }
-
-        attack_status.state = state;
-        attack_status.type = type;
-        attack_status.content_size = content_size;
-        ESP_LOGI(TAG, "Loaded %d bytes of attack results from flash", content_size);
+        parts[i].data = delta;
+        parts[i].size = delta_size;
+        position += delta_size;
     }
+    err = result_log_append(RESULT_RECORD_CHECKPOINT, parts, part_count, NULL);
+    free(parts);
+    if (err != ESP_OK) {
+        // progress is kept, so the same data are retried by next checkpoint
+        ESP_LOGW(TAG, "Failed to append checkpoint: %s", esp_err_to_name(err));
+        return;
+    }
+    ESP_LOGD(TAG, "Checkpoint of %u bytes at offset %u", header.records_size, offset);
+    checkpoint_records_size = records_end;
+    memcpy(&checkpoint_meta, &meta, sizeof(capture_store_meta_t));
+    checkpoint_deltas = full ? 0 : checkpoint_deltas + 1;
+}
 
-    nvs_close(nvs_handle);
-    return ESP_OK;
+/**
+ * @brief Callback function for checkpoint timer. Runs in esp_timer task, so it only posts ATTACK_CMD_CHECKPOINT.
+ * @param arg not used
+ */
+static void checkpoint_timer_callback(void *arg) {
+    post_command(ATTACK_CMD_CHECKPOINT, 0, NULL);
 }
 
 /**
  * @brief Callback function for attack timeout timer.
  * 
- * This function is called when attack times out. 
- * It updates attack status state to TIMEOUT.
- * It calls appropriate abort functions based on current attack type.
- * @param arg not used.
+ * Runs in esp_timer task, so it only posts ATTACK_CMD_TIMEOUT to attack controller.
+ * @param arg run_id of attack run the timer was started for
  */
 static void attack_timeout(void* arg){
     ESP_LOGD(TAG, "Attack timed out");
-    
-    attack_update_status(TIMEOUT);
+    post_command(ATTACK_CMD_TIMEOUT, (uint32_t) (uintptr_t) arg, NULL);
+}
 
-    switch(attack_status.type) {
+/**
+ * @brief Stops running attack based on its type.
+ */
+static void stop_attack(uint8_t type) {
+    esp_timer_stop(attack_timeout_handle);
+    esp_timer_stop(checkpoint_timer_handle);
+    switch(type) {
         case ATTACK_TYPE_PMKID:
             ESP_LOGI(TAG, "Aborting PMKID attack...");
             attack_pmkid_stop();
@@ -271,43 +637,67 @@ static void attack_timeout(void* arg){
         default:
             ESP_LOGE(TAG, "Unknown attack type. Not aborting anything");
     }
-    
-    // Save results to flash after timeout
-    if (attack_status.content_size > 0) {
-        ESP_LOGI(TAG, "Saving timeout results to flash...");
+}
+
+/**
+ * @brief Finishes running attack with given final state and persists its results.
+ * 
+ * @param state final attack state
+ * @param job_state final state of the job if the run was started from job queue
+ */
+static void finish_attack(attack_state_t state, attack_job_state_t job_state) {
+    stop_attack(attack_status.type);
+    wifictl_resume_scans();
+    set_status(state, attack_status.type);
+    if (capture_store_get_view_size(CAPTURE_VIEW_STATUS) > 0) {
+        ESP_LOGI(TAG, "Saving results to flash...");
         attack_save_results_to_flash();
     }
+    if (job_running) {
+        attack_jobs_finish(job_state);
+        job_running = false;
+    }
 }
 
 /**
- * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
+ * @brief Handles ATTACK_CMD_START.
  * 
- * This function handles WEBSERVER_EVENT_ATTACK_REQUEST event from event loop.
- * It parses attack_request_t structure and set initial values to attack_status.
- * It sets attack state to RUNNING.
- * It starts attack timeout timer.
- * It starts attack based on chosen type.
+ * It sets initial values to attack_status, sets attack state to RUNNING,
+ * starts attack timeout timer and starts attack based on chosen type.
+ * Expects that no attack is running.
  * 
- * @param args not used
- * @param event_base expects WEBSERVER_EVENTS
- * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
- * @param event_data expects attack_request_t
+ * @param type attack type
+ * @param method attack method
+ * @param timeout attack timeout in seconds
+ * @param ap_record target AP, it's copied for the whole run
  */
-static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGI(TAG, "Starting attack...");
-    attack_request_t *attack_request = (attack_request_t *) event_data;
-    attack_config_t attack_config = { .type = attack_request->type, .method = attack_request->method, .timeout = attack_request->timeout };
-    attack_config.ap_record = wifictl_get_ap_record(attack_request->ap_record_id);
-    
-    attack_status.state = RUNNING;
-    attack_status.type = attack_config.type;
+static void start_attack(uint8_t type, uint8_t method, uint8_t timeout, const wifi_ap_record_t *ap_record) {
+    memcpy(&current_ap_record, ap_record, sizeof(wifi_ap_record_t));
+    attack_config_t attack_config = { .type = type, .method = method, .timeout = timeout, .ap_record = &current_ap_record };
 
-    if(attack_config.ap_record == NULL){
-        ESP_LOGE(TAG, "NPE: No attack_config.ap_record!");
-        return;
-    }
-    // set timeout
+    ESP_LOGI(TAG, "Starting attack...");
+    // background scan requested by /ap-list may still be hopping channels
+    wifictl_pause_scans();
+    run_id++;
+    attack_config.run_id = run_id;
+    attack_timing_start_run();
+    attack_telemetry_reset(current_ap_record.rssi);
+    reset_run_memory();
+    capture_store_reset(attack_config.ap_record->ssid, strlen((char *) attack_config.ap_record->ssid), attack_config.ap_record->bssid);
+    set_status(RUNNING, attack_config.type);
+
+    // set timeout, timer is recreated so it carries id of this run
+    esp_timer_delete(attack_timeout_handle);
+    const esp_timer_create_args_t attack_timeout_args = {
+        .callback = &attack_timeout,
+        .arg = (void *) (uintptr_t) run_id
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&attack_timeout_args, &attack_timeout_handle));
     ESP_ERROR_CHECK(esp_timer_start_once(attack_timeout_handle, attack_config.timeout * 1000000));
+    reset_checkpoints();
+    if (CONFIG_ATTACK_CHECKPOINT_INTERVAL > 0) {
+        esp_timer_start_periodic(checkpoint_timer_handle, CONFIG_ATTACK_CHECKPOINT_INTERVAL * 1000000ULL);
+    }
     // start attack based on it's type
     switch(attack_config.type) {
         case ATTACK_TYPE_PMKID:
@@ -325,12 +715,226 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
         default:
             ESP_LOGE(TAG, "Unknown attack type!");
     }
+    attack_timing_mark(ATTACK_PHASE_RADIO_SETUP);
+}
+
+/**
+ * @brief Copies AP record from slot of the request if the slot still holds requested BSSID.
+ *
+ * Slot of disappeared AP can be reused by background scan, attack never targets AP that wasn't selected.
+ * @return esp_err_t ESP_ERR_INVALID_STATE if slot holds another AP
+ */
+static esp_err_t get_requested_ap_record(const attack_request_t *attack_request, wifi_ap_record_t *ap_record) {
+    esp_err_t err = wifictl_get_ap_record(attack_request->ap_record_id, ap_record);
+    if (err == ESP_OK && memcmp(ap_record->bssid, attack_request->bssid, sizeof(attack_request->bssid)) != 0) {
+        ESP_LOGW(TAG, "AP slot %u holds another AP now", attack_request->ap_record_id);
+        err = ESP_ERR_INVALID_STATE;
+    }
+    return err;
+}
+
+/**
+ * @brief Handles ATTACK_CMD_START.
+ */
+static void start_requested_attack(const attack_request_t *attack_request) {
+    if (attack_status.state == RUNNING) {
+        ESP_LOGW(TAG, "Attack already running, request ignored");
+        return;
+    }
+    wifi_ap_record_t ap_record;
+    if(get_requested_ap_record(attack_request, &ap_record) != ESP_OK){
+        ESP_LOGE(TAG, "No AP record for attack!");
+        return;
+    }
+    start_attack(attack_request->type, attack_request->method, attack_request->timeout, &ap_record);
+}
+
+/**
+ * @brief Starts first pending job from job queue if no attack is running.
+ */
+static void start_next_job() {
+    if (attack_status.state == RUNNING) {
+        return;
+    }
+    attack_job_t job;
+    if (!attack_jobs_start_next(&job)) {
+        return;
+    }
+    ESP_LOGI(TAG, "Starting next job from queue");
+    job_running = true;
+    start_attack(job.type, job.method, job.timeout, &job.ap_record);
+}
+
+/**
+ * @brief Handles ATTACK_CMD_JOB_ADD.
+ */
+static void add_job(const attack_request_t *attack_request) {
+    wifi_ap_record_t ap_record;
+    if(get_requested_ap_record(attack_request, &ap_record) != ESP_OK){
+        ESP_LOGE(TAG, "No AP record for job!");
+        return;
+    }
+    if (attack_jobs_add(&ap_record, attack_request->type, attack_request->method, attack_request->timeout) == ESP_OK) {
+        start_next_job();
+    }
+}
+
+/**
+ * @brief Handles ATTACK_CMD_RESET.
+ * 
+ * Clears capture store, marks saved results as cleared and puts attack to READY state.
+ */
+static void reset_attack() {
+    ESP_LOGD(TAG, "Resetting attack status...");
+    reset_run_memory();
+    set_status(READY, -1);
+    
+    // Older results stay in result log history, marker only stops them from being restored at boot
+    if (result_log_append(RESULT_RECORD_CLEARED, NULL, 0, NULL) == ESP_OK) {
+        ESP_LOGI(TAG, "Cleared saved results from flash");
+    }
+}
+
+/**
+ * @brief Restores state of previous session. Runs in attack controller task before any command is processed.
+ * 
+ * Mounts results partition, rebuilds result log index and loads the newest results. Each step is logged with its duration.
+ */
+static void restore_session() {
+    UBaseType_t priority = uxTaskPriorityGet(NULL);
+    vTaskPrioritySet(NULL, ATTACK_RESTORE_PRIORITY);
+    int64_t restore_start = esp_timer_get_time();
+    int64_t step_start = restore_start;
+
+    if (file_manager_init() != ESP_OK) {
+        ESP_LOGW(TAG, "File manager initialization failed, results won't be saved to SPIFFS");
+    }
+    ESP_LOGI(TAG, "Restore: results partition mounted in %lld ms", (esp_timer_get_time() - step_start) / 1000);
+    step_start = esp_timer_get_time();
+
+    if (result_log_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Result log unavailable, results will not survive reboot");
+    }
+    ESP_LOGI(TAG, "Restore: result log index built in %lld ms", (esp_timer_get_time() - step_start) / 1000);
+    step_start = esp_timer_get_time();
+
+    if (attack_load_results_from_flash() == ESP_OK) {
+        ESP_LOGI(TAG, "Restored previous attack results from flash");
+    }
+    ESP_LOGI(TAG, "Restore: results loaded in %lld ms", (esp_timer_get_time() - step_start) / 1000);
+
+    ESP_LOGI(TAG, "Restore finished in %lld ms, %lld ms since boot", (esp_timer_get_time() - restore_start) / 1000, esp_timer_get_time() / 1000);
+    ESP_LOGI(TAG, "Restore: %u B of attack controller stack never used", uxTaskGetStackHighWaterMark(NULL));
+    xEventGroupSetBits(restore_events, RESTORE_DONE_BIT);
+    vTaskPrioritySet(NULL, priority);
+}
+
+void attack_start_restore() {
+    xEventGroupSetBits(restore_events, RESTORE_REQUESTED_BIT);
+}
+
+bool attack_is_restored() {
+    return (xEventGroupGetBits(restore_events) & RESTORE_DONE_BIT) != 0;
+}
+
+/**
+ * @brief Attack controller task.
+ * 
+ * This task owns all attack state. It consumes commands from command_queue one by one, 
+ * so every state transition happens in single context and blocking Wi-Fi calls never run inside default event loop.
+ * 
+ * State transitions:
+ * - START: READY/FINISHED/TIMEOUT -> RUNNING (ignored while RUNNING)
+ * - RESULT, STOP: RUNNING -> FINISHED
+ * - TIMEOUT: RUNNING -> TIMEOUT
+ * - RESET: any -> READY (running attack has to be stopped first)
+ * - JOBS_CLEAR: RUNNING job -> FINISHED
+ * - CHECKPOINT: no transition, results of RUNNING attack are checkpointed
+ * 
+ * RESULT and TIMEOUT commands of other than current run are dropped.
+ * After RESULT, TIMEOUT, RESET and JOB_ADD next pending job from job queue is started if no attack is running.
+ * When the task starts, it waits for attack_start_restore() and restores previous session first,
+ * commands posted meanwhile stay in the queue. Pending jobs are resumed afterwards (e.g. after reboot).
+ * @param arg not used
+ */
+static void attack_controller_task(void *arg) {
+    attack_command_t command;
+    xEventGroupWaitBits(restore_events, RESTORE_REQUESTED_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+    restore_session();
+    start_next_job();
+    while(true) {
+        if(xQueueReceive(command_queue, &command, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        ESP_LOGD(TAG, "Attack command %d (state %d)", command.type, attack_status.state);
+        bool current_run = (attack_status.state == RUNNING) && (command.run_id == run_id);
+        switch(command.type) {
+            case ATTACK_CMD_START:
+                start_requested_attack(&command.request);
+                break;
+            case ATTACK_CMD_STOP:
+                if(attack_status.state == RUNNING) {
+                    finish_attack(FINISHED, ATTACK_JOB_STOPPED);
+                }
+                break;
+            case ATTACK_CMD_TIMEOUT:
+                if(current_run) {
+                    finish_attack(TIMEOUT, ATTACK_JOB_TIMEOUT);
+                    start_next_job();
+                } else {
+                    ESP_LOGD(TAG, "Stale timeout dropped");
+                }
+                break;
+            case ATTACK_CMD_RESULT:
+                if(current_run) {
+                    finish_attack(FINISHED, ATTACK_JOB_FINISHED);
+                    start_next_job();
+                } else {
+                    ESP_LOGD(TAG, "Stale result dropped");
+                }
+                break;
+            case ATTACK_CMD_RESET:
+                reset_attack();
+                start_next_job();
+                break;
+            case ATTACK_CMD_JOB_ADD:
+                add_job(&command.request);
+                break;
+            case ATTACK_CMD_JOBS_CLEAR:
+                if(job_running) {
+                    finish_attack(FINISHED, ATTACK_JOB_STOPPED);
+                }
+                attack_jobs_clear();
+                break;
+            case ATTACK_CMD_CHECKPOINT:
+                if(attack_status.state == RUNNING) {
+                    checkpoint_attack();
+                }
+                break;
+            default:
+                ESP_LOGE(TAG, "Unknown attack command %d", command.type);
+        }
+    }
+}
+
+/**
+ * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
+ * 
+ * Forwards attack_request_t to attack controller as ATTACK_CMD_START.
+ * 
+ * @param args not used
+ * @param event_base expects WEBSERVER_EVENTS
+ * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
+ * @param event_data expects attack_request_t
+ */
+static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    post_command(ATTACK_CMD_START, 0, (attack_request_t *) event_data);
 }
 
 /**
  * @brief Callback for WEBSERVER_EVENT_ATTACK_RESET event.
  * 
- * This callback resets attack status by freeing previously allocated status content and putting attack to READY state.
+ * Posts ATTACK_CMD_STOP followed by ATTACK_CMD_RESET, so running attack is stopped before its results are cleared.
  * 
  * @param args not used
  * @param event_base expects WEBSERVER_EVENTS
@@ -338,44 +942,72 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
  * @param event_data not used
  */
 static void attack_reset_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGD(TAG, "Resetting attack status...");
-    if(attack_status.content){
-        free(attack_status.content);
-        attack_status.content = NULL;
-    }
-    attack_status.content_size = 0;
-    attack_status.type = -1;
-    attack_status.state = READY;
-    
-    // Clear saved results from flash
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err == ESP_OK) {
-        nvs_erase_all(nvs_handle);
-        nvs_commit(nvs_handle);
-        nvs_close(nvs_handle);
-        ESP_LOGI(TAG, "Cleared saved results from flash");
-    }
+    post_command(ATTACK_CMD_STOP, 0, NULL);
+    post_command(ATTACK_CMD_RESET, 0, NULL);
+}
+
+/**
+ * @brief Callback for WEBSERVER_EVENT_JOB_ADD event.
+ * 
+ * Forwards attack_request_t to attack controller as ATTACK_CMD_JOB_ADD.
+ * 
+ * @param args not used
+ * @param event_base expects WEBSERVER_EVENTS
+ * @param event_id expects WEBSERVER_EVENT_JOB_ADD
+ * @param event_data expects attack_request_t
+ */
+static void job_add_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    post_command(ATTACK_CMD_JOB_ADD, 0, (attack_request_t *) event_data);
+}
+
+/**
+ * @brief Callback for WEBSERVER_EVENT_JOBS_CLEAR event.
+ * 
+ * @param args not used
+ * @param event_base expects WEBSERVER_EVENTS
+ * @param event_id expects WEBSERVER_EVENT_JOBS_CLEAR
+ * @param event_data not used
+ */
+static void jobs_clear_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    post_command(ATTACK_CMD_JOBS_CLEAR, 0, NULL);
 }
 
 /**
  * @brief Initialises common attack resources.
  * 
- * Creates attack timeout timer.
- * Registers event loop event handlers.
+ * Reserves run arena, creates capture store, timing, telemetry, job queue, attack timeout and checkpoint timers, command queue and attack controller task.
+ * Registers event loop event handlers. Flash is not touched here, previous session is restored after attack_start_restore().
  */
 void attack_init(){
+    ESP_ERROR_CHECK(run_arena_init());
+    capture_store_init();
+    attack_timing_init();
+    attack_telemetry_init();
+    attack_jobs_init();
+    status_mutex = xSemaphoreCreateMutex();
+    command_queue = xQueueCreate(ATTACK_CONTROLLER_QUEUE_LENGTH, sizeof(attack_command_t));
+    restore_events = xEventGroupCreate();
+    if(status_mutex == NULL || command_queue == NULL || restore_events == NULL) {
+        ESP_LOGE(TAG, "Failed to create attack controller resources");
+        return;
+    }
+
     const esp_timer_create_args_t attack_timeout_args = {
-        .callback = &attack_timeout
+        .callback = &attack_timeout,
+        .arg = (void *) (uintptr_t) run_id
     };
     ESP_ERROR_CHECK(esp_timer_create(&attack_timeout_args, &attack_timeout_handle));
+    const esp_timer_create_args_t checkpoint_timer_args = {
+        .callback = &checkpoint_timer_callback
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&checkpoint_timer_args, &checkpoint_timer_handle));
 
+    if(xTaskCreate(attack_controller_task, "attack_ctrl", ATTACK_CONTROLLER_STACK_SIZE, NULL, ATTACK_CONTROLLER_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create attack controller task");
+        return;
+    }
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, &attack_request_handler, NULL));
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_RESET, &attack_reset_handler, NULL));
-    
-    // Try to load any saved results from previous session
-    esp_err_t err = attack_load_results_from_flash();
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Restored previous attack results from flash");
-    }
-}
\ No newline at end of file
+    ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_JOB_ADD, &job_add_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_JOBS_CLEAR, &jobs_clear_handler, NULL));
+}
@@ -13,8 +13,13 @@
 #ifndef ATTACK_H
 #define ATTACK_H
 
+#include <stddef.h>
+
 #include "esp_wifi_types.h"
 #include "esp_err.h"
+#include "esp_event.h"
+
+#include "attack_timing.h"
 
 /**
  * @brief Implemented attack types that can be chosen.
@@ -34,7 +39,7 @@ typedef enum {
  */
 typedef enum {
     READY,      ///< no attack is in progress and results from previous attack run are available.
-    RUNNING,    ///< attack is in progress, attack_status_t.content may not be consistent.
+    RUNNING,    ///< attack is in progress, captured content may not be consistent.
     FINISHED,   ///< last attack finsihed and results are available.
     TIMEOUT     ///< last attack timed out. This option will be moved as sub category of FINISHED state.
 } attack_state_t;
@@ -49,71 +54,106 @@ typedef struct {
     uint8_t method;
     uint8_t timeout;
     const wifi_ap_record_t *ap_record;
+    uint32_t run_id;    ///< id of this run, attack passes it back to attack_report_result()
 } attack_config_t;
 
 /**
  * @brief Contains current attack status.
  * 
- * This structure contains all information and data about latest attack.
+ * This structure contains all information about latest attack. 
+ * Captured data are held in capture_store and rendered as CAPTURE_VIEW_STATUS.
+ * First ATTACK_STATUS_HEADER_SIZE bytes are sent as is as header of \c /status response, so their layout is part of wire format.
  */
 typedef struct {
     uint8_t state;  ///< attack_state_t
     uint8_t type;   ///< attack_type_t
-    uint16_t content_size;
-    char *content;
+    uint8_t flags;      ///< ATTACK_STATUS_FLAG_* bits
+    uint8_t reserved;   ///< padding to keep content_size aligned, always 0
+    uint32_t content_size;  ///< size of CAPTURE_VIEW_STATUS
+    uint32_t phase_us[ATTACK_PHASE_COUNT];  ///< phase timing of current or last run, see attack_timing_get_run()
 } attack_status_t;
 
 /**
- * @brief Returns pointer to attack_status_t structure.
+ * @brief Capture ran out of memory (run arena and heap overflow limit) and some frames were not stored
+ */
+#define ATTACK_STATUS_FLAG_TRUNCATED (1 << 0)
+
+/**
+ * @brief Size of \c /status response header
+ */
+#define ATTACK_STATUS_HEADER_SIZE offsetof(attack_status_t, phase_us)
+
+ESP_EVENT_DECLARE_BASE(ATTACK_EVENTS);
+enum {
+    ATTACK_EVENT_STATUS_CHANGED    ///< attack state changed, event data are first ATTACK_STATUS_HEADER_SIZE bytes of attack_status_t
+};
+
+/**
+ * @brief Copies current attack status.
  * 
- * @return const attack_status_t*  pointer to the status strucutre
+ * Attack status is owned by attack controller task, so a consistent copy is returned instead of pointer.
+ * Content size is updated from capture_store on every call. It never blocks, while previous session is being restored
+ * READY without results is reported and restored results are announced by ATTACK_EVENT_STATUS_CHANGED.
+ * @param status output parameter for the status
  */
-const attack_status_t *attack_get_status();
+void attack_get_status(attack_status_t *status);
 
 /**
- * @brief Function to update current status of attack.
+ * @brief Checks whether attack is running.
  * 
- * If FINISHED state is passed, then the attack timeout timer is stopped.
- * @param state new attack state of type attack_state_t to be set
+ * Cheaper than attack_get_status(), it doesn't compute content size.
+ * @return true if attack is in RUNNING state
  */
-void attack_update_status(attack_state_t state);
+bool attack_is_running();
+
+/**
+ * @brief Reports that running attack obtained its result and should finish.
+ * 
+ * Can be called from any context (e.g. event loop handler). The attack is stopped and its state set to FINISHED
+ * asynchronously by attack controller task. Result of run that already finished is ignored.
+ * @param run_id attack_config_t::run_id of the run that obtained the result, captured when attack started
+ */
+void attack_report_result(uint32_t run_id);
 
 /**
  * @brief Initialises attack wrapper. This function should be callend only once.
  * 
- * This function creates all necessary resources for attack wrapper. It has to be called before any attack can be run.
+ * This function creates all necessary resources for attack wrapper and starts attack controller task
+ * that executes all attack state transitions. It has to be called before any attack can be run.
  */
 void attack_init();
 
 /**
- * @brief Allocates status content of given size.
- *  
- * @param size size to be allocated
- * @return char* pointer to newly allocated status content
+ * @brief Starts restoring results of previous session in background.
+ * 
+ * Called once management AP and webserver are running. Attack controller mounts results partition,
+ * rebuilds result log index and loads saved results at low priority, then resumes pending jobs and starts processing commands.
  */
-char *attack_alloc_result_content(unsigned size);
+void attack_start_restore();
 
 /**
- * @brief Reallocates current status content and appends new data.
- * 
- * @param buffer new data to be appended to status content
- * @param size size of the new data to be appended
+ * @brief Checks whether results of previous session are restored.
+ *
+ * Never blocks, so it can be called from httpd task. Callers answer with \c 503 and \c Retry-After until it returns true.
+ * @return true once restore finished
  */
-void attack_append_status_content(uint8_t *buffer, unsigned size);
+bool attack_is_restored();
 
 /**
- * @brief Save current attack results to NVS flash storage.
+ * @brief Save current attack results to result log on flash.
  * 
- * Persists results so they survive WiFi disconnections and can be retrieved later.
+ * Appends capture_store content as new result log record, so results survive reboot and older runs stay in history.
+ * PCAP and HCCAPX views are additionally saved as result files.
  * @return esp_err_t ESP_OK on success
  */
 esp_err_t attack_save_results_to_flash();
 
 /**
- * @brief Load last attack results from NVS flash storage.
+ * @brief Load last attack results from result log on flash.
  * 
- * Retrieves previously saved results from flash memory.
- * @return esp_err_t ESP_OK on success
+ * Restores the newest saved results unless they were cleared by reset afterwards.
+ * If the last run was interrupted (e.g. by power loss), its partial results are reconstructed from checkpoints.
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if there are no results to restore
  */
 esp_err_t attack_load_results_from_flash();
 
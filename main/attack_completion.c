@@ -0,0 +1,161 @@
+/**
+ * @file attack_completion.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements completion policy of handshake capture
+ */
+#include "attack_completion.h"
+
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+
+#include "frame_analyzer_parser.h"
+#include "hccapx_serializer.h"
+
+static const char *TAG = "main:attack_completion";
+
+/**
+ * @brief Number of recent M1 messages remembered to be matched with M2
+ */
+#define M1_TABLE_SIZE 4
+
+/**
+ * @brief M1 message seen from AP
+ */
+typedef struct {
+    uint8_t mac_sta[6];
+    uint8_t replay_counter[8];
+    bool valid;
+} m1_entry_t;
+
+static m1_entry_t m1_entries[M1_TABLE_SIZE];
+static unsigned next_m1_entry = 0;
+/**
+ * @brief Last matched M1+M2 exchange, so retransmitted M2 isn't counted as new session
+ */
+static m1_entry_t last_session;
+static unsigned session_count = 0;
+static bool completed = false;
+/**
+ * @brief Whether any crackable message pair was captured, cached so progress can be read from other tasks
+ */
+static bool pair_found = false;
+/**
+ * @brief Tracks whether any crackable message pair was captured (first pair policy)
+ */
+static hccapx_ctx_t *hccapx_ctx = NULL;
+
+static bool is_array_zero(const uint8_t *array, unsigned size){
+    for(unsigned i = 0; i < size; i++){
+        if(array[i] != 0){
+            return false;
+        }
+    }
+    return true;
+}
+
+void attack_completion_reset(const uint8_t *ssid, unsigned ssid_len){
+    memset(m1_entries, 0, sizeof(m1_entries));
+    memset(&last_session, 0, sizeof(last_session));
+    next_m1_entry = 0;
+    session_count = 0;
+    completed = false;
+    pair_found = false;
+    hccapx_serializer_destroy(hccapx_ctx);
+    hccapx_ctx = NULL;
+#ifdef CONFIG_ATTACK_HANDSHAKE_COMPLETION_FIRST_PAIR
+    hccapx_ctx = hccapx_serializer_create(ssid, ssid_len);
+#endif
+}
+
+/**
+ * @brief Remembers M1 sent by AP
+ */
+static void add_m1(data_frame_t *frame, eapol_key_packet_t *eapol_key_packet){
+    m1_entry_t *entry = &m1_entries[next_m1_entry];
+    memcpy(entry->mac_sta, frame->mac_header.addr1, 6);
+    memcpy(entry->replay_counter, eapol_key_packet->key_replay_counter, 8);
+    entry->valid = true;
+    next_m1_entry = (next_m1_entry + 1) % M1_TABLE_SIZE;
+}
+
+/**
+ * @brief Looks for M1 matching M2 sent by STA and counts new session if found
+ */
+static void match_m2(data_frame_t *frame, eapol_key_packet_t *eapol_key_packet){
+    for(unsigned i = 0; i < M1_TABLE_SIZE; i++){
+        m1_entry_t *entry = &m1_entries[i];
+        if(!entry->valid 
+            || (memcmp(entry->mac_sta, frame->mac_header.addr2, 6) != 0)
+            || (memcmp(entry->replay_counter, eapol_key_packet->key_replay_counter, 8) != 0)){
+            continue;
+        }
+        if(memcmp(&last_session, entry, sizeof(m1_entry_t)) == 0){
+            ESP_LOGV(TAG, "M2 of already counted session");
+            return;
+        }
+        memcpy(&last_session, entry, sizeof(m1_entry_t));
+        session_count++;
+        ESP_LOGI(TAG, "Captured M1+M2 with matching replay counter (session %u)", session_count);
+        return;
+    }
+}
+
+/**
+ * @brief Evaluates configured policy
+ */
+static bool is_policy_satisfied(){
+#if defined(CONFIG_ATTACK_HANDSHAKE_COMPLETION_FIRST_PAIR)
+    return (session_count > 0) || (hccapx_serializer_get(hccapx_ctx) != NULL);
+#elif defined(CONFIG_ATTACK_HANDSHAKE_COMPLETION_BEST_PAIR)
+    return session_count > 0;
+#elif defined(CONFIG_ATTACK_HANDSHAKE_COMPLETION_SESSIONS)
+    return session_count >= CONFIG_ATTACK_HANDSHAKE_COMPLETION_SESSION_COUNT;
+#else
+    return false;
+#endif
+}
+
+bool attack_completion_check(data_frame_t *frame){
+    if(completed){
+        return false;
+    }
+    eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
+    if(eapol_packet == NULL){
+        return false;
+    }
+    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+    if(eapol_key_packet == NULL){
+        return false;
+    }
+
+    if(hccapx_ctx != NULL){
+        hccapx_serializer_add_frame(hccapx_ctx, frame);
+    }
+    // Same message detection as in hccapx_serializer - Ref: 802.11i-2004 [8.5.3]
+    if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) == 0){
+        // From AP, M1 has empty Key MIC
+        if(is_array_zero(eapol_key_packet->key_mic, 16)){
+            add_m1(frame, eapol_key_packet);
+        }
+    }
+    else if(memcmp(frame->mac_header.addr1, frame->mac_header.addr3, 6) == 0){
+        // From STA, M2 has SNonce
+        if(!is_array_zero(eapol_key_packet->key_nonce, 16)){
+            match_m2(frame, eapol_key_packet);
+        }
+    }
+
+    pair_found = (session_count > 0) || ((hccapx_ctx != NULL) && (hccapx_serializer_get(hccapx_ctx) != NULL));
+    completed = is_policy_satisfied();
+    return completed;
+}
+
+void attack_completion_get_progress(uint8_t *sessions, bool *pair_found_out, bool *completed_out){
+    *sessions = (session_count > UINT8_MAX) ? UINT8_MAX : session_count;
+    *pair_found_out = pair_found;
+    *completed_out = completed;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file attack_completion.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to decide when handshake capture has enough data to finish early
+ * 
+ * Policy is selected by CONFIG_ATTACK_HANDSHAKE_COMPLETION_* options:
+ * - first pair: any message pair usable for cracking was captured
+ * - best pair: M1 and M2 with the same replay counter were captured
+ * - sessions: CONFIG_ATTACK_HANDSHAKE_COMPLETION_SESSION_COUNT distinct M1+M2 exchanges were captured
+ */
+#ifndef ATTACK_COMPLETION_H
+#define ATTACK_COMPLETION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "frame_analyzer_types.h"
+
+/**
+ * @brief Forgets progress of previous handshake capture.
+ * 
+ * Should be called at the beginning of every handshake attack run.
+ * 
+ * @param ssid SSID of target AP
+ * @param ssid_len length of SSID
+ */
+void attack_completion_reset(const uint8_t *ssid, unsigned ssid_len);
+
+/**
+ * @brief Updates capture progress with new EAPoL-Key frame and evaluates completion policy.
+ * 
+ * @param frame data frame with EAPoL-Key packet
+ * @return true if completion policy was satisfied by this frame. It's returned only once per run.
+ * @return false otherwise or if early completion is disabled
+ */
+bool attack_completion_check(data_frame_t *frame);
+
+/**
+ * @brief Returns progress of current capture. Can be called from any task.
+ * 
+ * @param sessions output parameter for number of M1+M2 exchanges with matching replay counter, saturates at 255
+ * @param pair_found output parameter, true if message pair usable for cracking was captured
+ * @param completed output parameter, true if completion policy was satisfied
+ */
+void attack_completion_get_progress(uint8_t *sessions, bool *pair_found, bool *completed);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file attack_dedup.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements duplicate EAPoL frames elimination
+ */
+#include "attack_dedup.h"
+
+#include <stdint.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "lwip/def.h"
+
+#include "frame_analyzer_parser.h"
+
+static const char *TAG = "main:attack_dedup";
+
+/**
+ * @brief Constants according to reference
+ * 
+ * @see Ref: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ */
+//@{
+#define XXH_PRIME32_1 0x9E3779B1U
+#define XXH_PRIME32_2 0x85EBCA77U
+#define XXH_PRIME32_3 0xC2B2AE3DU
+#define XXH_PRIME32_4 0x27D4EB2FU
+#define XXH_PRIME32_5 0x165667B1U
+//@}
+
+/**
+ * @brief Entry of recently seen EAPoL frames set
+ */
+typedef struct {
+    uint32_t hash;
+    uint8_t count;  ///< how many copies were seen, 0 means empty entry
+} dedup_entry_t;
+
+static dedup_entry_t entries[CONFIG_ATTACK_EAPOL_DEDUP_TABLE_SIZE];
+/**
+ * @brief Index of entry that will be replaced next when set is full (oldest one).
+ */
+static unsigned next_entry = 0;
+static unsigned dropped_count = 0;
+
+static uint32_t rotl32(uint32_t x, unsigned r){
+    return (x << r) | (x >> (32 - r));
+}
+
+static uint32_t read_u32_le(const uint8_t *p){
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint32_t xxh32_round(uint32_t acc, uint32_t lane){
+    acc += lane * XXH_PRIME32_2;
+    return rotl32(acc, 13) * XXH_PRIME32_1;
+}
+
+/**
+ * @brief Calculates xxHash32 of given buffer
+ * 
+ * @param data 
+ * @param size 
+ * @param seed 
+ * @return uint32_t 
+ */
+static uint32_t xxh32(const uint8_t *data, unsigned size, uint32_t seed){
+    const uint8_t *end = data + size;
+    uint32_t hash;
+
+    if(size >= 16){
+        uint32_t v1 = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+        uint32_t v2 = seed + XXH_PRIME32_2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - XXH_PRIME32_1;
+        do {
+            v1 = xxh32_round(v1, read_u32_le(data));
+            v2 = xxh32_round(v2, read_u32_le(data + 4));
+            v3 = xxh32_round(v3, read_u32_le(data + 8));
+            v4 = xxh32_round(v4, read_u32_le(data + 12));
+            data += 16;
+        } while(end - data >= 16);
+        hash = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+    }
+    else {
+        hash = seed + XXH_PRIME32_5;
+    }
+
+    hash += size;
+    while(end - data >= 4){
+        hash += read_u32_le(data) * XXH_PRIME32_3;
+        hash = rotl32(hash, 17) * XXH_PRIME32_4;
+        data += 4;
+    }
+    while(data < end){
+        hash += (*data) * XXH_PRIME32_5;
+        hash = rotl32(hash, 11) * XXH_PRIME32_1;
+        data++;
+    }
+
+    hash ^= hash >> 15;
+    hash *= XXH_PRIME32_2;
+    hash ^= hash >> 13;
+    hash *= XXH_PRIME32_3;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+void attack_dedup_reset(){
+    if(dropped_count > 0){
+        ESP_LOGI(TAG, "Dropped %u duplicate EAPoL frames in previous run", dropped_count);
+    }
+    memset(entries, 0, sizeof(entries));
+    next_entry = 0;
+    dropped_count = 0;
+}
+
+bool attack_dedup_check(data_frame_t *frame, unsigned size){
+    if(CONFIG_ATTACK_EAPOL_DEDUP_KEEP_FIRST == 0){
+        return true;
+    }
+
+    eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
+    if(eapol_packet == NULL){
+        return true;
+    }
+    unsigned eapol_offset = (uint8_t *) eapol_packet - (uint8_t *) frame;
+    unsigned eapol_size = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
+    if(eapol_offset + eapol_size > size){
+        ESP_LOGD(TAG, "EAPoL packet is truncated, hashing only captured part");
+        eapol_size = (eapol_offset < size) ? size - eapol_offset : 0;
+    }
+
+    // addr1 and addr2 are adjacent in MAC header - hash them together as a seed
+    uint32_t hash = xxh32((uint8_t *) eapol_packet, eapol_size, xxh32(frame->mac_header.addr1, 12, 0));
+
+    for(unsigned i = 0; i < CONFIG_ATTACK_EAPOL_DEDUP_TABLE_SIZE; i++){
+        if((entries[i].count == 0) || (entries[i].hash != hash)){
+            continue;
+        }
+        if(entries[i].count >= CONFIG_ATTACK_EAPOL_DEDUP_KEEP_FIRST){
+            ESP_LOGD(TAG, "Duplicate EAPoL frame (hash=%08x), dropping", hash);
+            dropped_count++;
+            return false;
+        }
+        entries[i].count++;
+        return true;
+    }
+
+    // New frame, replace oldest entry
+    entries[next_entry].hash = hash;
+    entries[next_entry].count = 1;
+    next_entry = (next_entry + 1) % CONFIG_ATTACK_EAPOL_DEDUP_TABLE_SIZE;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+ * @file attack_dedup.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to eliminate duplicate EAPoL frames before they are stored
+ * 
+ * During deauth-triggered reconnects AP usually resends identical EAPoL-Key messages (e.g. M1) many times.
+ * Content hash of every EAPoL frame is checked against bounded set of recently seen hashes and only first
+ * CONFIG_ATTACK_EAPOL_DEDUP_KEEP_FIRST copies are kept.
+ */
+#ifndef ATTACK_DEDUP_H
+#define ATTACK_DEDUP_H
+
+#include <stdbool.h>
+
+#include "frame_analyzer_types.h"
+
+/**
+ * @brief Forgets all previously seen EAPoL frames.
+ * 
+ * Should be called at the beginning of every attack run.
+ */
+void attack_dedup_reset();
+
+/**
+ * @brief Decides whether given EAPoL frame should be stored.
+ * 
+ * Hash is calculated over destination and source address and whole EAPoL packet.
+ * Frames without EAPoL packet are always kept.
+ * 
+ * @param frame data frame with EAPoL packet
+ * @param size size of the frame in bytes
+ * @return true frame is unique or still within keep-first-N limit
+ * @return false frame is duplicate and should be dropped
+ */
+bool attack_dedup_check(data_frame_t *frame, unsigned size);
+
+#endif
\ No newline at end of file
@@ -9,29 +9,49 @@
 
 #include "attack_handshake.h"
 
+#include <stdint.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_timer.h"
 #include "esp_wifi_types.h"
 
 #include "attack.h"
 #include "attack_method.h"
+#include "attack_dedup.h"
+#include "attack_completion.h"
+#include "attack_timing.h"
+#include "attack_telemetry.h"
 #include "wifi_controller.h"
 #include "frame_analyzer.h"
-#include "pcap_serializer.h"
-#include "hccapx_serializer.h"
+#include "capture_store.h"
 
 static const char *TAG = "main:attack_handshake";
 static attack_handshake_methods_t method = -1;
 static const wifi_ap_record_t *ap_record = NULL;
+static esp_timer_handle_t grace_timer_handle = NULL;
+
+/**
+ * @brief Callback for grace period timer.
+ * 
+ * Grace period after completion policy was satisfied elapsed, attack can finish.
+ * 
+ * @param arg run_id of attack run the timer was created for
+ */
+static void grace_period_elapsed(void *arg){
+    ESP_LOGI(TAG, "Handshake captured, finishing attack");
+    attack_report_result((uint32_t) (uintptr_t) arg);
+}
 
 /**
  * @brief Callback for DATA_FRAME_EVENT_EAPOLKEY_FRAME event.
  * 
  * If EAPOL-Key frame is captured and DATA_FRAME_EVENT_EAPOLKEY_FRAME event is received from event pool, this method
- * appends the frame to status content and serialize them into pcap and hccapx format.
+ * appends the frame to capture store. All export formats are rendered from the store on demand.
+ * Duplicate frames beyond CONFIG_ATTACK_EAPOL_DEDUP_KEEP_FIRST copies are dropped.
+ * When completion policy is satisfied, attack finishes after CONFIG_ATTACK_HANDSHAKE_GRACE_PERIOD_MS.
  * 
  * @param args not used
  * @param event_base expects FRAME_ANALYZER_EVENTS
@@ -42,17 +62,34 @@ static void eapolkey_frame_handler(void *args, esp_event_base_t event_base, int3
     ESP_LOGI(TAG, "Got EAPoL-Key frame");
     ESP_LOGD(TAG, "Processing handshake frame...");
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
-    attack_append_status_content(frame->payload, frame->rx_ctrl.sig_len);
-    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
-    hccapx_serializer_add_frame((data_frame_t *) frame->payload);
+    attack_telemetry_add_eapol(frame);
+    if(!attack_dedup_check((data_frame_t *) frame->payload, frame->rx_ctrl.sig_len)){
+        return;
+    }
+    capture_store_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
+    attack_timing_mark(ATTACK_PHASE_FIRST_EAPOL);
+    if(attack_completion_check((data_frame_t *) frame->payload)){
+        attack_timing_mark(ATTACK_PHASE_COMPLETE_PAIR);
+#ifdef CONFIG_ATTACK_HANDSHAKE_GRACE_PERIOD_MS
+        ESP_LOGI(TAG, "Completion policy satisfied, grace period %d ms", CONFIG_ATTACK_HANDSHAKE_GRACE_PERIOD_MS);
+        ESP_ERROR_CHECK(esp_timer_start_once(grace_timer_handle, CONFIG_ATTACK_HANDSHAKE_GRACE_PERIOD_MS * 1000));
+#endif
+    }
 }
 
 void attack_handshake_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting handshake attack...");
     method = attack_config->method;
     ap_record = attack_config->ap_record;
-    pcap_serializer_init();
-    hccapx_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
+    attack_dedup_reset();
+    attack_completion_reset(ap_record->ssid, strlen((char *) ap_record->ssid));
+    // timer is recreated so it carries id of this run
+    esp_timer_delete(grace_timer_handle);
+    const esp_timer_create_args_t grace_timer_args = {
+        .callback = &grace_period_elapsed,
+        .arg = (void *) (uintptr_t) attack_config->run_id
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&grace_timer_args, &grace_timer_handle));
     wifictl_sniffer_filter_frame_types(true, false, false);
     wifictl_sniffer_start(ap_record->primary);
     frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_record->bssid);
@@ -90,6 +127,7 @@ void attack_handshake_stop(){
         default:
             ESP_LOGE(TAG, "Unknown attack method! Attack may not be stopped properly.");
     }
+    esp_timer_stop(grace_timer_handle);
     wifictl_sniffer_stop();
     frame_analyzer_capture_stop();
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &eapolkey_frame_handler));
@@ -0,0 +1,165 @@
+/**
+ * @file attack_jobs.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements persisted queue of capture jobs
+ */
+#include "attack_jobs.h"
+
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define NVS_NAMESPACE "attack_jobs"
+#define NVS_KEY_JOBS "jobs"
+
+static const char *TAG = "main:attack_jobs";
+static SemaphoreHandle_t jobs_mutex = NULL;
+static attack_job_t jobs[CONFIG_ATTACK_JOB_QUEUE_SIZE];
+static unsigned job_count = 0;
+
+/**
+ * @brief Persists job table to NVS. Expects jobs_mutex to be taken.
+ */
+static void save_jobs(){
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to open NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    if(job_count > 0){
+        err = nvs_set_blob(nvs_handle, NVS_KEY_JOBS, jobs, job_count * sizeof(attack_job_t));
+    } else {
+        err = nvs_erase_key(nvs_handle, NVS_KEY_JOBS);
+        if(err == ESP_ERR_NVS_NOT_FOUND){
+            err = ESP_OK;
+        }
+    }
+    if(err == ESP_OK){
+        err = nvs_commit(nvs_handle);
+    }
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to save jobs to NVS: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+/**
+ * @brief Loads job table from NVS.
+ */
+static void load_jobs(){
+    nvs_handle_t nvs_handle;
+    if(nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK){
+        ESP_LOGD(TAG, "No saved jobs found");
+        return;
+    }
+    size_t size = sizeof(jobs);
+    esp_err_t err = nvs_get_blob(nvs_handle, NVS_KEY_JOBS, jobs, &size);
+    nvs_close(nvs_handle);
+    if((err != ESP_OK) || (size % sizeof(attack_job_t) != 0)){
+        ESP_LOGD(TAG, "No valid saved jobs found");
+        job_count = 0;
+        return;
+    }
+    job_count = size / sizeof(attack_job_t);
+    for(unsigned i = 0; i < job_count; i++){
+        if(jobs[i].state == ATTACK_JOB_RUNNING){
+            ESP_LOGI(TAG, "Job %u was interrupted, it will be executed again", i);
+            jobs[i].state = ATTACK_JOB_PENDING;
+        }
+    }
+    ESP_LOGI(TAG, "Loaded %u jobs", job_count);
+}
+
+void attack_jobs_init(){
+    jobs_mutex = xSemaphoreCreateMutex();
+    if(jobs_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create jobs mutex");
+        return;
+    }
+    load_jobs();
+}
+
+esp_err_t attack_jobs_add(const wifi_ap_record_t *ap_record, uint8_t type, uint8_t method, uint8_t timeout){
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    if(job_count == CONFIG_ATTACK_JOB_QUEUE_SIZE){
+        // drop the oldest completed job
+        unsigned i;
+        for(i = 0; i < job_count; i++){
+            if(jobs[i].state > ATTACK_JOB_RUNNING){
+                break;
+            }
+        }
+        if(i == job_count){
+            ESP_LOGE(TAG, "Job queue is full");
+            err = ESP_ERR_NO_MEM;
+            goto exit;
+        }
+        memmove(&jobs[i], &jobs[i + 1], (job_count - i - 1) * sizeof(attack_job_t));
+        job_count--;
+    }
+    attack_job_t *job = &jobs[job_count];
+    memcpy(&job->ap_record, ap_record, sizeof(wifi_ap_record_t));
+    job->type = type;
+    job->method = method;
+    job->timeout = timeout;
+    job->state = ATTACK_JOB_PENDING;
+    job_count++;
+    ESP_LOGI(TAG, "Added job %u (type %u) against %s", job_count - 1, type, ap_record->ssid);
+    save_jobs();
+exit:
+    xSemaphoreGive(jobs_mutex);
+    return err;
+}
+
+bool attack_jobs_start_next(attack_job_t *job){
+    bool started = false;
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < job_count; i++){
+        if(jobs[i].state == ATTACK_JOB_PENDING){
+            jobs[i].state = ATTACK_JOB_RUNNING;
+            memcpy(job, &jobs[i], sizeof(attack_job_t));
+            started = true;
+            save_jobs();
+            break;
+        }
+    }
+    xSemaphoreGive(jobs_mutex);
+    return started;
+}
+
+void attack_jobs_finish(attack_job_state_t state){
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    for(unsigned i = 0; i < job_count; i++){
+        if(jobs[i].state == ATTACK_JOB_RUNNING){
+            jobs[i].state = state;
+            save_jobs();
+            break;
+        }
+    }
+    xSemaphoreGive(jobs_mutex);
+}
+
+void attack_jobs_clear(){
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    job_count = 0;
+    save_jobs();
+    xSemaphoreGive(jobs_mutex);
+    ESP_LOGI(TAG, "Job queue cleared");
+}
+
+unsigned attack_jobs_get(attack_job_t *out_jobs, unsigned max_jobs){
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    unsigned count = (job_count < max_jobs) ? job_count : max_jobs;
+    memcpy(out_jobs, jobs, count * sizeof(attack_job_t));
+    xSemaphoreGive(jobs_mutex);
+    return count;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file attack_jobs.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to persisted queue of capture jobs
+ * 
+ * Capture job is attack against one explicitly selected AP. Jobs are executed back to back by attack controller.
+ * Job table is persisted to NVS on every change, so interrupted queue resumes after reboot.
+ */
+#ifndef ATTACK_JOBS_H
+#define ATTACK_JOBS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+
+/**
+ * @brief States of single capture job
+ */
+typedef enum {
+    ATTACK_JOB_PENDING,     ///< waiting for execution
+    ATTACK_JOB_RUNNING,     ///< currently executed. Running job found after reboot is executed again.
+    ATTACK_JOB_FINISHED,    ///< attack finished with result
+    ATTACK_JOB_TIMEOUT,     ///< attack timed out
+    ATTACK_JOB_STOPPED      ///< attack was stopped by operator
+} attack_job_state_t;
+
+/**
+ * @brief Capture job
+ * 
+ * Copy of AP record is kept, so job doesn't depend on latest AP scan and survives reboot.
+ */
+typedef struct {
+    wifi_ap_record_t ap_record;
+    uint8_t type;       ///< attack_type_t
+    uint8_t method;
+    uint8_t timeout;    ///< attack timeout in seconds
+    uint8_t state;      ///< attack_job_state_t
+} attack_job_t;
+
+/**
+ * @brief Initialises job queue and loads persisted jobs. This function should be called only once.
+ * 
+ * Job that was running when device rebooted is put back to ATTACK_JOB_PENDING.
+ */
+void attack_jobs_init();
+
+/**
+ * @brief Appends new pending job to the queue.
+ * 
+ * If the queue is full, the oldest completed job is dropped to make space.
+ * 
+ * @param ap_record target AP
+ * @param type attack type
+ * @param method attack method
+ * @param timeout attack timeout in seconds
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if queue is full of pending jobs
+ */
+esp_err_t attack_jobs_add(const wifi_ap_record_t *ap_record, uint8_t type, uint8_t method, uint8_t timeout);
+
+/**
+ * @brief Marks first pending job as running. Only one job can be running at a time.
+ * 
+ * @param job output parameter for copy of the job
+ * @return true if job was started
+ * @return false if there is no pending job
+ */
+bool attack_jobs_start_next(attack_job_t *job);
+
+/**
+ * @brief Sets final state of running job. Does nothing if no job is running (e.g. queue was cleared).
+ * 
+ * @param state final state
+ */
+void attack_jobs_finish(attack_job_state_t state);
+
+/**
+ * @brief Removes all jobs from the queue.
+ */
+void attack_jobs_clear();
+
+/**
+ * @brief Copies current jobs.
+ * 
+ * @param jobs output array
+ * @param max_jobs size of output array
+ * @return unsigned number of copied jobs
+ */
+unsigned attack_jobs_get(attack_job_t *jobs, unsigned max_jobs);
+
+#endif
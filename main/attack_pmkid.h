@@ -11,6 +11,14 @@
 
 #include "attack.h"
 
+/**
+ * @brief Available methods that can be chosen for the attack.
+ */
+typedef enum {
+    ATTACK_PMKID_METHOD_FIRST,  ///< attack finishes as soon as first PMKID is captured
+    ATTACK_PMKID_METHOD_COLLECT ///< STA keeps reassociating and collects distinct PMKIDs for CONFIG_ATTACK_PMKID_COLLECT_WINDOW seconds after the first one
+} attack_pmkid_methods_t;
+
 /**
  * @brief Starts PMKID attack with given attack_config_t.
  * 
@@ -0,0 +1,115 @@
+/**
+ * @file attack_telemetry.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements live progress of handshake capture
+ */
+#include "attack_telemetry.h"
+
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "frame_analyzer_parser.h"
+#include "attack_completion.h"
+
+static const char *TAG = "main:attack_telemetry";
+
+static SemaphoreHandle_t telemetry_mutex = NULL;
+static attack_telemetry_t telemetry;
+
+static bool is_array_zero(const uint8_t *array, unsigned size){
+    for(unsigned i = 0; i < size; i++){
+        if(array[i] != 0){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finds or adds STA entry. Expects telemetry_mutex to be taken.
+ * @return attack_telemetry_sta_t* entry, \c NULL if table is full
+ */
+static attack_telemetry_sta_t *get_sta(const uint8_t *mac){
+    for(unsigned i = 0; i < telemetry.sta_count; i++){
+        if(memcmp(telemetry.stas[i].mac, mac, 6) == 0){
+            return &telemetry.stas[i];
+        }
+    }
+    if(telemetry.sta_count >= ATTACK_TELEMETRY_MAX_STAS){
+        return NULL;
+    }
+    attack_telemetry_sta_t *sta = &telemetry.stas[telemetry.sta_count++];
+    memset(sta, 0, sizeof(attack_telemetry_sta_t));
+    memcpy(sta->mac, mac, 6);
+    return sta;
+}
+
+void attack_telemetry_init(){
+    telemetry_mutex = xSemaphoreCreateMutex();
+    if(telemetry_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create telemetry mutex");
+    }
+}
+
+void attack_telemetry_reset(int8_t ap_rssi){
+    xSemaphoreTake(telemetry_mutex, portMAX_DELAY);
+    memset(&telemetry, 0, sizeof(telemetry));
+    telemetry.ap_rssi = ap_rssi;
+    xSemaphoreGive(telemetry_mutex);
+}
+
+void attack_telemetry_add_eapol(const wifi_promiscuous_pkt_t *frame){
+    data_frame_t *data_frame = (data_frame_t *) frame->payload;
+    eapol_packet_t *eapol_packet = parse_eapol_packet(data_frame);
+    if(eapol_packet == NULL){
+        return;
+    }
+    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+    if(eapol_key_packet == NULL){
+        return;
+    }
+
+    // Same message detection as in hccapx_serializer - Ref: 802.11i-2004 [8.5.3]
+    const uint8_t *mac_sta;
+    unsigned message;
+    bool from_ap = (memcmp(data_frame->mac_header.addr2, data_frame->mac_header.addr3, 6) == 0);
+    if(from_ap){
+        mac_sta = data_frame->mac_header.addr1;
+        message = is_array_zero(eapol_key_packet->key_mic, 16) ? 0 : 2;
+    }
+    else if(memcmp(data_frame->mac_header.addr1, data_frame->mac_header.addr3, 6) == 0){
+        mac_sta = data_frame->mac_header.addr2;
+        message = is_array_zero(eapol_key_packet->key_nonce, 16) ? 3 : 1;
+    }
+    else {
+        return;
+    }
+
+    xSemaphoreTake(telemetry_mutex, portMAX_DELAY);
+    if(from_ap){
+        telemetry.ap_rssi = frame->rx_ctrl.rssi;
+    }
+    attack_telemetry_sta_t *sta = get_sta(mac_sta);
+    if(sta != NULL){
+        if(!from_ap){
+            sta->rssi = frame->rx_ctrl.rssi;
+        }
+        if(sta->messages[message] < UINT8_MAX){
+            sta->messages[message]++;
+        }
+    }
+    xSemaphoreGive(telemetry_mutex);
+}
+
+void attack_telemetry_get(attack_telemetry_t *telemetry_out){
+    xSemaphoreTake(telemetry_mutex, portMAX_DELAY);
+    memcpy(telemetry_out, &telemetry, sizeof(attack_telemetry_t));
+    xSemaphoreGive(telemetry_mutex);
+    attack_completion_get_progress(&telemetry_out->sessions, &telemetry_out->pair_found, &telemetry_out->completed);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file attack_telemetry.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to live progress of handshake capture
+ * 
+ * EAPoL-Key messages are counted per STA as they arrive (including duplicates dropped later),
+ * together with last RSSI of AP and every STA and current handshake completeness.
+ */
+#ifndef ATTACK_TELEMETRY_H
+#define ATTACK_TELEMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_wifi_types.h"
+
+/**
+ * @brief Maximum number of tracked STAs, EAPoL messages of other STAs are not counted
+ */
+#define ATTACK_TELEMETRY_MAX_STAS 8
+
+/**
+ * @brief EAPoL progress of single STA. Layout is part of \c /telemetry wire format.
+ */
+typedef struct {
+    uint8_t mac[6];
+    int8_t rssi;            ///< RSSI of last frame sent by STA, 0 if none yet
+    uint8_t reserved;
+    uint8_t messages[4];    ///< number of M1 to M4 messages, saturates at 255
+} attack_telemetry_sta_t;
+
+/**
+ * @brief Snapshot of capture progress
+ */
+typedef struct {
+    int8_t ap_rssi;         ///< RSSI of last frame sent by AP, from scan until then
+    uint8_t sessions;       ///< M1+M2 exchanges with matching replay counter
+    bool pair_found;        ///< message pair usable for cracking was captured
+    bool completed;         ///< completion policy was satisfied
+    uint8_t sta_count;
+    attack_telemetry_sta_t stas[ATTACK_TELEMETRY_MAX_STAS];
+} attack_telemetry_t;
+
+/**
+ * @brief Initialises telemetry module. This function should be called only once.
+ */
+void attack_telemetry_init();
+
+/**
+ * @brief Forgets progress of previous run. Called at the beginning of every attack run.
+ * 
+ * @param ap_rssi RSSI of target AP from scan
+ */
+void attack_telemetry_reset(int8_t ap_rssi);
+
+/**
+ * @brief Counts EAPoL-Key frame. Frames that aren't EAPoL-Key are ignored.
+ * 
+ * @param frame captured frame
+ */
+void attack_telemetry_add_eapol(const wifi_promiscuous_pkt_t *frame);
+
+/**
+ * @brief Copies current progress.
+ * 
+ * @param telemetry output parameter
+ */
+void attack_telemetry_get(attack_telemetry_t *telemetry);
+
+#endif
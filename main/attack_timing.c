@@ -0,0 +1,135 @@
+/**
+ * @file attack_timing.c
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Implements attack phase timing and rolling histograms
+ */
+#include "attack_timing.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "main:attack_timing";
+
+/**
+ * @brief Values of last CONFIG_ATTACK_TIMING_WINDOW runs of single phase
+ */
+typedef struct {
+    uint32_t values[CONFIG_ATTACK_TIMING_WINDOW];
+    unsigned next;  ///< index of value that will be replaced next
+} timing_window_t;
+
+static SemaphoreHandle_t timing_mutex = NULL;
+static int64_t run_start = 0;
+static uint32_t run_phase_us[ATTACK_PHASE_COUNT];
+static timing_window_t windows[ATTACK_PHASE_COUNT];
+static attack_timing_histogram_t histograms[ATTACK_PHASE_COUNT];
+
+static unsigned bucket_index(uint32_t value_us){
+    uint32_t value_ms = value_us / 1000;
+    unsigned index = 0;
+    while((value_ms > 0) && (index < ATTACK_TIMING_BUCKET_COUNT - 1)){
+        value_ms >>= 1;
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @brief Adds value to phase window and updates its histogram. Expects timing_mutex to be taken.
+ */
+static void add_sample(attack_phase_t phase, uint32_t value_us){
+    timing_window_t *window = &windows[phase];
+    attack_timing_histogram_t *histogram = &histograms[phase];
+    if(histogram->samples == CONFIG_ATTACK_TIMING_WINDOW){
+        histogram->buckets[bucket_index(window->values[window->next])]--;
+    } else {
+        histogram->samples++;
+    }
+    window->values[window->next] = value_us;
+    window->next = (window->next + 1) % CONFIG_ATTACK_TIMING_WINDOW;
+    histogram->buckets[bucket_index(value_us)]++;
+
+    histogram->min_us = UINT32_MAX;
+    histogram->max_us = 0;
+    for(unsigned i = 0; i < histogram->samples; i++){
+        if(window->values[i] < histogram->min_us){
+            histogram->min_us = window->values[i];
+        }
+        if(window->values[i] > histogram->max_us){
+            histogram->max_us = window->values[i];
+        }
+    }
+}
+
+/**
+ * @brief Stores phase value of current run if the phase wasn't reached yet.
+ * 
+ * @param phase phase
+ * @param value_us duration, or current time if since_start is true
+ * @param since_start whether phase is measured from attack start
+ */
+static void set_phase(attack_phase_t phase, int64_t value_us, bool since_start){
+    if(phase >= ATTACK_PHASE_COUNT){
+        return;
+    }
+    xSemaphoreTake(timing_mutex, portMAX_DELAY);
+    if(since_start){
+        value_us -= run_start;
+    }
+    if(value_us <= 0){
+        // 0 means phase not reached
+        value_us = 1;
+    }
+    if(value_us > UINT32_MAX){
+        value_us = UINT32_MAX;
+    }
+    if(run_phase_us[phase] == 0){
+        run_phase_us[phase] = value_us;
+        add_sample(phase, value_us);
+        ESP_LOGD(TAG, "Phase %d took %lld us", phase, value_us);
+    }
+    xSemaphoreGive(timing_mutex);
+}
+
+void attack_timing_init(){
+    timing_mutex = xSemaphoreCreateMutex();
+    if(timing_mutex == NULL){
+        ESP_LOGE(TAG, "Failed to create timing mutex");
+    }
+}
+
+void attack_timing_start_run(){
+    xSemaphoreTake(timing_mutex, portMAX_DELAY);
+    run_start = esp_timer_get_time();
+    memset(run_phase_us, 0, sizeof(run_phase_us));
+    xSemaphoreGive(timing_mutex);
+}
+
+void attack_timing_mark(attack_phase_t phase){
+    set_phase(phase, esp_timer_get_time(), true);
+}
+
+void attack_timing_record(attack_phase_t phase, int64_t duration_us){
+    set_phase(phase, duration_us, false);
+}
+
+void attack_timing_get_run(uint32_t *phase_us){
+    xSemaphoreTake(timing_mutex, portMAX_DELAY);
+    memcpy(phase_us, run_phase_us, sizeof(run_phase_us));
+    xSemaphoreGive(timing_mutex);
+}
+
+void attack_timing_get_histograms(attack_timing_histogram_t *histograms_out){
+    xSemaphoreTake(timing_mutex, portMAX_DELAY);
+    memcpy(histograms_out, histograms, sizeof(histograms));
+    xSemaphoreGive(timing_mutex);
+}
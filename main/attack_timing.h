@@ -0,0 +1,88 @@
+/**
+ * @file attack_timing.h
+ * @author risinek (risinek@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ * 
+ * @brief Provides interface to measure duration of attack phases
+ * 
+ * Every phase is measured once per run as time elapsed since attack start (flash save as its own duration).
+ * Measured values of last CONFIG_ATTACK_TIMING_WINDOW runs are kept in rolling histograms per phase,
+ * so attack timeouts can be tuned from real data.
+ */
+#ifndef ATTACK_TIMING_H
+#define ATTACK_TIMING_H
+
+#include <stdint.h>
+
+/**
+ * @brief Measured attack phases
+ */
+typedef enum {
+    ATTACK_PHASE_RADIO_SETUP,   ///< attack start until radio is reconfigured and attack method is running
+    ATTACK_PHASE_FIRST_EAPOL,   ///< attack start until first EAPoL frame is stored
+    ATTACK_PHASE_COMPLETE_PAIR, ///< attack start until handshake completion policy is satisfied
+    ATTACK_PHASE_PMKID,         ///< attack start until PMKID is captured
+    ATTACK_PHASE_FLASH_SAVE,    ///< duration of saving results to flash
+    ATTACK_PHASE_COUNT
+} attack_phase_t;
+
+/**
+ * @brief Number of histogram buckets.
+ * 
+ * Bucket 0 counts values under 1 ms, bucket i counts values in <2^(i-1), 2^i) ms and the last bucket counts all longer values.
+ */
+#define ATTACK_TIMING_BUCKET_COUNT 20
+
+/**
+ * @brief Rolling histogram of single phase. Layout is part of \c /timing response wire format.
+ */
+typedef struct {
+    uint32_t samples;   ///< number of values in the window
+    uint32_t min_us;    ///< minimal value in the window, 0 if there are no samples
+    uint32_t max_us;    ///< maximal value in the window
+    uint16_t buckets[ATTACK_TIMING_BUCKET_COUNT];
+} attack_timing_histogram_t;
+
+/**
+ * @brief Initialises timing module. This function should be called only once.
+ */
+void attack_timing_init();
+
+/**
+ * @brief Starts measuring new attack run. Phases of previous run are forgotten.
+ */
+void attack_timing_start_run();
+
+/**
+ * @brief Marks that given phase of current run was reached.
+ * 
+ * Only the first mark of every phase in a run is taken. Can be called from any task.
+ * 
+ * @param phase reached phase
+ */
+void attack_timing_mark(attack_phase_t phase);
+
+/**
+ * @brief Records duration of given phase of current run, used for phases not measured from attack start.
+ * 
+ * @param phase measured phase
+ * @param duration_us duration in microseconds
+ */
+void attack_timing_record(attack_phase_t phase, int64_t duration_us);
+
+/**
+ * @brief Copies phase values of current (or last) run.
+ * 
+ * @param phase_us output array of ATTACK_PHASE_COUNT values in microseconds, 0 for phases not reached
+ */
+void attack_timing_get_run(uint32_t *phase_us);
+
+/**
+ * @brief Copies rolling histograms of all phases.
+ * 
+ * @param histograms output array of ATTACK_PHASE_COUNT histograms
+ */
+void attack_timing_get_histograms(attack_timing_histogram_t *histograms);
+
+#endif
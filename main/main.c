@@ -15,6 +15,7 @@
 #include "esp_log.h"
 #include "esp_event.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 
 #include "attack.h"
 #include "wifi_controller.h"
@@ -23,6 +24,17 @@
 
 static const char* TAG = "main";
 
+/**
+ * @brief Logs duration of finished boot step and time since boot.
+ * @param step name of finished step
+ * @param step_start time when the step started, updated to current time
+ */
+static void log_boot_step(const char *step, int64_t *step_start){
+    int64_t now = esp_timer_get_time();
+    ESP_LOGI(TAG, "Boot: %s in %lld ms (%lld ms since boot)", step, (now - *step_start) / 1000, now / 1000);
+    *step_start = now;
+}
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "%s v%s", APP_NAME, APP_VERSION);
@@ -30,6 +42,8 @@ void app_main(void)
     ESP_LOGI(TAG, "ESP-IDF Version: %s", esp_get_idf_version());
     
     ESP_LOGD(TAG, "app_main started");
+    int64_t step_start = esp_timer_get_time();
+    ESP_LOGI(TAG, "Boot: app_main reached %lld ms since boot", step_start / 1000);
     esp_err_t ret = esp_event_loop_create_default();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to create event loop: %s", esp_err_to_name(ret));
@@ -37,8 +51,13 @@ void app_main(void)
     }
     
     wifictl_mgmt_ap_start();
+    log_boot_step("management AP started", &step_start);
     attack_init();
+    log_boot_step("attack initialised", &step_start);
     webserver_run();
+    log_boot_step("webserver started", &step_start);
+    // device is usable now, previous results are restored in background
+    attack_start_restore();
     
     ESP_LOGI(TAG, "Application started successfully");
 }